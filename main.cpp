@@ -4,6 +4,7 @@
 #include "server/Profiler.hpp"
 #include "postgres/PostgresPool.hpp"
 #include "plugin_init.hpp"
+#include "nodes/nodes/common/CsvNodes.hpp"
 #include <iostream>
 #include <fstream>
 #include <csignal>
@@ -25,6 +26,17 @@ int main(int argc, char* argv[]) {
         std::string address = "0.0.0.0";
         unsigned short port = 8080;
         std::string datasetPath = "";
+        std::string datasetSortedBy = "";
+        std::string datasetIndex = "";
+        std::string datasetSchema = "";
+        std::string csvRoot = "";
+        std::string snapshotDir = "";
+        size_t executorThreads = 1;
+        size_t graphCache = 64;
+        size_t resultCache = 0;
+        size_t resultCacheMb = 256;
+        size_t executionTimeout = 0;  // Secondes, 0 : aucun délai
+        std::string retention = "all";
         std::string graphsDbPath = "../examples/graphs.db";
         std::string postgresConn = "";  // Connection string or path to config file
         std::string configFile = "";   // App parameters config file
@@ -38,6 +50,28 @@ int main(int argc, char* argv[]) {
                 port = static_cast<unsigned short>(std::stoi(argv[++i]));
             } else if ((arg == "-d" || arg == "--dataset") && i + 1 < argc) {
                 datasetPath = argv[++i];
+            } else if (arg == "--dataset-sorted-by" && i + 1 < argc) {
+                datasetSortedBy = argv[++i];
+            } else if (arg == "--dataset-index" && i + 1 < argc) {
+                datasetIndex = argv[++i];
+            } else if (arg == "--dataset-schema" && i + 1 < argc) {
+                datasetSchema = argv[++i];
+            } else if (arg == "--snapshot-dir" && i + 1 < argc) {
+                snapshotDir = argv[++i];
+            } else if (arg == "--executor-threads" && i + 1 < argc) {
+                executorThreads = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--retention" && i + 1 < argc) {
+                retention = argv[++i];
+            } else if (arg == "--graph-cache" && i + 1 < argc) {
+                graphCache = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--result-cache" && i + 1 < argc) {
+                resultCache = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--result-cache-mb" && i + 1 < argc) {
+                resultCacheMb = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--execution-timeout" && i + 1 < argc) {
+                executionTimeout = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--csv-root" && i + 1 < argc) {
+                csvRoot = argv[++i];
             } else if ((arg == "-a" || arg == "--address") && i + 1 < argc) {
                 address = argv[++i];
             } else if ((arg == "-l" || arg == "--log-level") && i + 1 < argc) {
@@ -59,7 +93,29 @@ int main(int argc, char* argv[]) {
                           << "Options:\n"
                           << "  -p, --port PORT      Port to listen on (default: 8080)\n"
                           << "  -a, --address ADDR   Address to bind to (default: 0.0.0.0)\n"
-                          << "  -d, --dataset PATH   Path to CSV dataset\n"
+                          << "  -d, --dataset PATH   Path to CSV dataset, or .adf binary columnar file\n"
+                          << "  --dataset-sorted-by SPEC\n"
+                          << "                       Declared sort order of the dataset, e.g. \"region, amount desc\"\n"
+                          << "  --dataset-index SPEC Enable dataset indexes: \"auto\" (built on first query)\n"
+                          << "                       or columns built at startup, e.g. \"region:hash, amount:sorted, email:trigram\"\n"
+                          << "  --dataset-schema SPEC\n"
+                          << "                       Column types forced instead of inferred, e.g. \"id:int, amount:double, zip:string\"\n"
+                          << "  --snapshot-dir DIR   Binary snapshots of the dataset and plugin caches:\n"
+                          << "                       restored at startup if their source is unchanged,\n"
+                          << "                       saved at shutdown and on POST /api/snapshot\n"
+                          << "  --executor-threads N Worker threads per graph execution: independent branches\n"
+                          << "                       run in parallel (default: 1, 0 = hardware concurrency)\n"
+                          << "  --retention MODE     Intermediate DataFrames during executions: \"all\" (debug,\n"
+                          << "                       default) or \"outputs\" (dropped after their last consumer)\n"
+                          << "  --graph-cache N      Parsed and compiled graph versions kept in memory\n"
+                          << "                       (default: 64, 0 = disabled)\n"
+                          << "  --result-cache N     Node results memoized across executions: only nodes\n"
+                          << "                       downstream of a change run (default: 0 = disabled)\n"
+                          << "  --result-cache-mb MB DataFrame memory held by the result cache (default: 256)\n"
+                          << "  --execution-timeout SEC\n"
+                          << "                       Graph executions are cancelled after SEC seconds unless the\n"
+                          << "                       graph sets execution_timeout_ms (default: 0 = no timeout)\n"
+                          << "  --csv-root DIR       Directory csv_source nodes may load files from (_path property)\n"
                           << "  -g, --graphs-db PATH Path to graphs SQLite database (default: ../examples/graphs.db)\n"
                           << "  --postgres CONN      PostgreSQL connection string or path to config file\n"
                           << "                       String: \"host=localhost port=5432 dbname=mydb user=postgres\"\n"
@@ -141,12 +197,45 @@ int main(int argc, char* argv[]) {
             LOG_INFO("PostgreSQL configured");
         }
 
+        // Fichiers accessibles aux nœuds csv_source (désactivé par défaut)
+        if (!csvRoot.empty()) {
+            nodes::setCsvSourceRoot(csvRoot);
+        }
+
         // Initialiser le stockage de graphes
         RequestHandler::instance().initGraphStorage(graphsDbPath);
+        RequestHandler::instance().getGraphStorage()->setCompiledCacheCapacity(graphCache);
+        nodes::ExecutionOptions executionOptions;
+        executionOptions.threads = executorThreads;
+        if (resultCache > 0) {
+            executionOptions.cache = std::make_shared<nodes::ResultCache>(resultCache, resultCacheMb << 20);
+        }
+        if (retention == "outputs") {
+            executionOptions.retention = nodes::Retention::Outputs;
+        } else if (retention != "all") {
+            std::cerr << "Error: --retention must be \"all\" or \"outputs\"" << std::endl;
+            return 1;
+        }
+        RequestHandler::instance().setExecutionOptions(executionOptions);
+        RequestHandler::instance().setExecutionTimeout(std::chrono::seconds(executionTimeout));
+
+        // Snapshots binaires (optionnel) : avant le chargement du dataset et des plugins
+        if (!snapshotDir.empty()) {
+            RequestHandler::instance().enableSnapshots(snapshotDir);
+        }
+
+        // Index secondaires du dataset (optionnel)
+        if (!datasetIndex.empty()) {
+            RequestHandler::instance().enableDatasetIndex(
+                datasetIndex == "auto" ? dataframe::DataFrameIndex::Spec{}
+                                       : dataframe::DataFrameIndex::parseSpec(datasetIndex));
+        }
 
         // Charger le dataset (optionnel)
         if (!datasetPath.empty()) {
-            RequestHandler::instance().loadDataset(datasetPath);
+            RequestHandler::instance().loadDataset(
+                datasetPath, dataframe::DataFrameSorter::parseSortSpec(datasetSortedBy),
+                dataframe::CsvReader::parseSchema(datasetSchema));
             std::cout << std::endl;
         }
 
@@ -176,6 +265,14 @@ int main(int argc, char* argv[]) {
             LOG_INFO("Shutting down...");
 
             stopPluginListeners();
+
+            // Exécutions en flux annulées et terminées avant la fermeture
+            RequestHandler::instance().stopExecutionWorkers();
+
+            // Sauvegarder les snapshots tant que les caches plugins existent
+            if (RequestHandler::instance().hasSnapshots()) {
+                RequestHandler::instance().saveSnapshots();
+            }
             shutdownNodePlugins();
 
             // Afficher les stats du profiler
@@ -194,6 +291,7 @@ int main(int argc, char* argv[]) {
         std::cout << "  GET  /api/health              - Health check" << std::endl;
         std::cout << "  GET  /api/dataset/info        - Dataset information" << std::endl;
         std::cout << "  POST /api/dataset/query       - Execute query pipeline" << std::endl;
+        std::cout << "  POST /api/snapshot            - Save dataset and cache snapshots" << std::endl;
         std::cout << std::endl;
         std::cout << "  GET  /api/nodes               - List node definitions" << std::endl;
         std::cout << std::endl;
@@ -204,6 +302,7 @@ int main(int argc, char* argv[]) {
         std::cout << "  DELETE /api/graph/:slug       - Delete a graph" << std::endl;
         std::cout << "  GET  /api/graph/:slug/versions - List graph versions" << std::endl;
         std::cout << "  POST /api/graph/:slug/execute - Execute a graph" << std::endl;
+        std::cout << "  PUT  /api/graph/:slug/inputs/:id - Upload a csv_source input (CSV, .adf, Arrow)" << std::endl;
         std::cout << std::endl;
         std::cout << "Press Ctrl+C to stop" << std::endl;
         std::cout << std::endl;
@@ -0,0 +1,975 @@
+#include "ArrowIpc.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace dataframe {
+
+namespace {
+
+using StringId = StringPool::StringId;
+
+// Constantes du format (Schema.fbs, Message.fbs)
+constexpr uint32_t CONTINUATION = 0xFFFFFFFF;
+constexpr int16_t METADATA_V5 = 4;
+constexpr size_t BODY_ALIGNMENT = 8;
+
+constexpr uint8_t HEADER_SCHEMA = 1;
+constexpr uint8_t HEADER_DICTIONARY_BATCH = 2;
+constexpr uint8_t HEADER_RECORD_BATCH = 3;
+
+constexpr uint8_t TYPE_INT = 2;
+constexpr uint8_t TYPE_FLOATING_POINT = 3;
+constexpr uint8_t TYPE_UTF8 = 5;
+constexpr uint8_t TYPE_BOOL = 6;
+constexpr uint8_t TYPE_LARGE_UTF8 = 20;
+constexpr uint8_t TYPE_UTF8_VIEW = 24;
+
+constexpr int16_t PRECISION_SINGLE = 1;
+constexpr int16_t PRECISION_DOUBLE = 2;
+
+// Slots des champs de chaque table (un union occupe deux slots : type puis valeur)
+enum MessageSlot : uint16_t { MESSAGE_VERSION = 0, MESSAGE_HEADER_TYPE = 1, MESSAGE_HEADER = 2, MESSAGE_BODY_LENGTH = 3 };
+enum SchemaSlot : uint16_t { SCHEMA_ENDIANNESS = 0, SCHEMA_FIELDS = 1, SCHEMA_CUSTOM_METADATA = 2 };
+enum FieldSlot : uint16_t {
+    FIELD_NAME = 0, FIELD_NULLABLE = 1, FIELD_TYPE_TYPE = 2, FIELD_TYPE = 3, FIELD_DICTIONARY = 4, FIELD_CHILDREN = 5
+};
+enum IntSlot : uint16_t { INT_BIT_WIDTH = 0, INT_IS_SIGNED = 1 };
+enum FloatSlot : uint16_t { FLOAT_PRECISION = 0 };
+enum DictionaryEncodingSlot : uint16_t { ENCODING_ID = 0, ENCODING_INDEX_TYPE = 1, ENCODING_IS_ORDERED = 2 };
+enum RecordBatchSlot : uint16_t {
+    BATCH_LENGTH = 0, BATCH_NODES = 1, BATCH_BUFFERS = 2, BATCH_COMPRESSION = 3, BATCH_VARIADIC_COUNTS = 4
+};
+enum DictionaryBatchSlot : uint16_t { DICTIONARY_ID = 0, DICTIONARY_DATA = 1, DICTIONARY_IS_DELTA = 2 };
+enum KeyValueSlot : uint16_t { KV_KEY = 0, KV_VALUE = 1 };
+
+// FieldNode {length, null_count} et Buffer {offset, length}
+struct Int64Pair {
+    int64_t first;
+    int64_t second;
+};
+static_assert(sizeof(Int64Pair) == 16);
+
+size_t padded(size_t size) {
+    return (size + BODY_ALIGNMENT - 1) / BODY_ALIGNMENT * BODY_ALIGNMENT;
+}
+
+// =============================================================================
+// Écriture
+// =============================================================================
+
+/**
+ * Construction d'un flatbuffer de la fin vers le début (comme flatc) :
+ * les enfants sont écrits avant leurs parents, les références sont des
+ * positions comptées depuis la fin du buffer
+ */
+class FlatBuilder {
+public:
+    using Ref = uint32_t;
+
+    Ref string(std::string_view s) {
+        prealign(s.size() + 1, 4);
+        pad(1);
+        pushBytes(s.data(), s.size());
+        push(static_cast<uint32_t>(s.size()));
+        return size();
+    }
+
+    Ref offsets(const std::vector<Ref>& refs) {
+        prealign(refs.size() * sizeof(uint32_t), 4);
+        for (auto it = refs.rbegin(); it != refs.rend(); ++it) {
+            push(static_cast<uint32_t>(size() + sizeof(uint32_t) - *it));
+        }
+        push(static_cast<uint32_t>(refs.size()));
+        return size();
+    }
+
+    Ref structs(const std::vector<Int64Pair>& items) {
+        prealign(items.size() * sizeof(Int64Pair), 4);
+        prealign(items.size() * sizeof(Int64Pair), alignof(Int64Pair));
+        pushBytes(items.data(), items.size() * sizeof(Int64Pair));
+        push(static_cast<uint32_t>(items.size()));
+        return size();
+    }
+
+    void startTable() {
+        m_fields.clear();
+        m_tableStart = size();
+    }
+
+    template<typename T>
+    void add(uint16_t slot, T value) {
+        align(sizeof(T));
+        push(value);
+        m_fields.push_back({slot, size()});
+    }
+
+    void addRef(uint16_t slot, Ref ref) {
+        align(sizeof(uint32_t));
+        push(static_cast<uint32_t>(size() + sizeof(uint32_t) - ref));
+        m_fields.push_back({slot, size()});
+    }
+
+    Ref endTable() {
+        align(sizeof(int32_t));
+        push(int32_t{0});
+        Ref table = size();
+
+        uint16_t slots = 0;
+        for (const auto& [slot, ref] : m_fields) slots = std::max<uint16_t>(slots, slot + 1);
+        std::vector<uint16_t> vtable(slots, 0);
+        for (const auto& [slot, ref] : m_fields) vtable[slot] = static_cast<uint16_t>(table - ref);
+        for (auto it = vtable.rbegin(); it != vtable.rend(); ++it) push(*it);
+        push(static_cast<uint16_t>(table - m_tableStart));
+        push(static_cast<uint16_t>((slots + 2) * sizeof(uint16_t)));
+
+        // soffset de la table vers sa vtable, écrite juste avant
+        int32_t toVtable = static_cast<int32_t>(size() - table);
+        std::memcpy(m_buf.data() + m_buf.size() - table, &toVtable, sizeof(toVtable));
+        return table;
+    }
+
+    std::string_view finish(Ref root) {
+        prealign(sizeof(uint32_t), m_minAlign);
+        push(static_cast<uint32_t>(size() + sizeof(uint32_t) - root));
+        return {reinterpret_cast<const char*>(m_buf.data() + m_head), size()};
+    }
+
+private:
+    uint32_t size() const { return static_cast<uint32_t>(m_buf.size() - m_head); }
+
+    void reserve(size_t bytes) {
+        if (m_head >= bytes) return;
+        size_t used = size();
+        std::vector<uint8_t> grown(std::max(m_buf.size() * 2, used + bytes + 256));
+        std::memcpy(grown.data() + grown.size() - used, m_buf.data() + m_head, used);
+        m_head = grown.size() - used;
+        m_buf = std::move(grown);
+    }
+
+    void pushBytes(const void* data, size_t bytes) {
+        reserve(bytes);
+        m_head -= bytes;
+        if (bytes) std::memcpy(m_buf.data() + m_head, data, bytes);
+    }
+
+    template<typename T>
+    void push(T value) {
+        pushBytes(&value, sizeof(T));
+    }
+
+    void pad(size_t bytes) {
+        reserve(bytes);
+        m_head -= bytes;
+        std::memset(m_buf.data() + m_head, 0, bytes);
+    }
+
+    void align(size_t alignment) {
+        prealign(0, alignment);
+    }
+
+    // Bourrage tel que size() + bytes soit un multiple de alignment
+    void prealign(size_t bytes, size_t alignment) {
+        m_minAlign = std::max(m_minAlign, alignment);
+        pad((alignment - (size() + bytes) % alignment) % alignment);
+    }
+
+    struct FieldRef {
+        uint16_t slot;
+        Ref ref;
+    };
+
+    std::vector<uint8_t> m_buf;
+    size_t m_head = 0;
+    size_t m_minAlign = 1;
+    Ref m_tableStart = 0;
+    std::vector<FieldRef> m_fields;
+};
+
+using Ref = FlatBuilder::Ref;
+
+// Corps d'un message : buffers référencés, copiés une seule fois dans le flux
+struct Body {
+    std::vector<Int64Pair> nodes;
+    std::vector<Int64Pair> buffers;
+    std::vector<std::string_view> parts;
+    size_t length = 0;
+
+    void add(const void* data, size_t bytes) {
+        buffers.push_back({static_cast<int64_t>(length), static_cast<int64_t>(bytes)});
+        parts.emplace_back(static_cast<const char*>(data), bytes);
+        length += padded(bytes);
+    }
+};
+
+Ref intType(FlatBuilder& fb, int32_t bitWidth, bool isSigned) {
+    fb.startTable();
+    fb.add<int32_t>(INT_BIT_WIDTH, bitWidth);
+    fb.add<uint8_t>(INT_IS_SIGNED, isSigned ? 1 : 0);
+    return fb.endTable();
+}
+
+Ref recordBatch(FlatBuilder& fb, int64_t length, const Body& body) {
+    Ref nodes = fb.structs(body.nodes);
+    Ref buffers = fb.structs(body.buffers);
+    fb.startTable();
+    fb.add<int64_t>(BATCH_LENGTH, length);
+    fb.addRef(BATCH_NODES, nodes);
+    fb.addRef(BATCH_BUFFERS, buffers);
+    return fb.endTable();
+}
+
+std::string_view finishMessage(FlatBuilder& fb, uint8_t headerType, Ref header, const Body& body) {
+    fb.startTable();
+    fb.add<int64_t>(MESSAGE_BODY_LENGTH, static_cast<int64_t>(body.length));
+    fb.addRef(MESSAGE_HEADER, header);
+    fb.add<int16_t>(MESSAGE_VERSION, METADATA_V5);
+    fb.add<uint8_t>(MESSAGE_HEADER_TYPE, headerType);
+    return fb.finish(fb.endTable());
+}
+
+// Message encapsulé : continuation, taille des métadonnées, métadonnées, corps
+void appendMessage(std::string& out, std::string_view metadata, const Body& body) {
+    static const char zeros[BODY_ALIGNMENT] = {};
+    uint32_t metadataLength = static_cast<uint32_t>(padded(metadata.size()));
+    out.append(reinterpret_cast<const char*>(&CONTINUATION), sizeof(CONTINUATION));
+    out.append(reinterpret_cast<const char*>(&metadataLength), sizeof(metadataLength));
+    out.append(metadata);
+    out.append(zeros, metadataLength - metadata.size());
+    for (auto part : body.parts) {
+        out.append(part);
+        out.append(zeros, padded(part.size()) - part.size());
+    }
+}
+
+// Colonne prête à écrire
+struct ColumnOut {
+    IColumnPtr column;
+    const void* values = nullptr;    // int32, float64 ou indices int32
+    std::vector<int32_t> indices;    // Indices renumérotés (dictionnaire compacté)
+    std::vector<int32_t> offsets;    // Dictionnaire Utf8
+    std::string bytes;
+};
+
+// =============================================================================
+// Lecture
+// =============================================================================
+
+[[noreturn]] void invalid(const std::string& what) {
+    throw std::runtime_error("Invalid Arrow IPC stream: " + what);
+}
+
+template<typename T>
+T load(std::string_view buf, size_t pos) {
+    if (pos > buf.size() || sizeof(T) > buf.size() - pos) {
+        invalid("truncated metadata");
+    }
+    T value;
+    std::memcpy(&value, buf.data() + pos, sizeof(T));
+    return value;
+}
+
+/**
+ * Table flatbuffer en lecture, toutes les positions bornées par le buffer
+ */
+class FlatTable {
+public:
+    FlatTable(std::string_view buf, size_t pos) : m_buf(buf), m_pos(pos) {
+        int64_t vtable = static_cast<int64_t>(pos) - load<int32_t>(buf, pos);
+        if (vtable < 0) invalid("vtable out of bounds");
+        m_vtable = static_cast<size_t>(vtable);
+        m_vtableSize = load<uint16_t>(buf, m_vtable);
+        if (m_vtableSize > buf.size() - m_vtable) invalid("vtable out of bounds");
+    }
+
+    template<typename T>
+    T scalar(uint16_t slot, T fallback) const {
+        size_t at = field(slot);
+        return at ? load<T>(m_buf, at) : fallback;
+    }
+
+    bool has(uint16_t slot) const { return field(slot) != 0; }
+
+    std::optional<FlatTable> table(uint16_t slot) const {
+        size_t at = field(slot);
+        if (!at) return std::nullopt;
+        return FlatTable(m_buf, at + load<uint32_t>(m_buf, at));
+    }
+
+    std::string_view string(uint16_t slot) const {
+        auto [start, count] = vector(slot, 1);
+        return m_buf.substr(start, count);
+    }
+
+    // Position du premier élément et nombre d'éléments (0 si absent)
+    std::pair<size_t, size_t> vector(uint16_t slot, size_t elementSize) const {
+        size_t at = field(slot);
+        if (!at) return {0, 0};
+        size_t start = at + load<uint32_t>(m_buf, at);
+        size_t count = load<uint32_t>(m_buf, start);
+        start += sizeof(uint32_t);
+        if (count > (m_buf.size() - start) / elementSize) invalid("truncated vector");
+        return {start, count};
+    }
+
+    std::vector<FlatTable> tables(uint16_t slot) const {
+        auto [start, count] = vector(slot, sizeof(uint32_t));
+        std::vector<FlatTable> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            size_t at = start + i * sizeof(uint32_t);
+            result.emplace_back(m_buf, at + load<uint32_t>(m_buf, at));
+        }
+        return result;
+    }
+
+    std::vector<Int64Pair> structs(uint16_t slot) const {
+        auto [start, count] = vector(slot, sizeof(Int64Pair));
+        std::vector<Int64Pair> result(count);
+        if (count) std::memcpy(result.data(), m_buf.data() + start, count * sizeof(Int64Pair));
+        return result;
+    }
+
+    std::vector<int64_t> longs(uint16_t slot) const {
+        auto [start, count] = vector(slot, sizeof(int64_t));
+        std::vector<int64_t> result(count);
+        if (count) std::memcpy(result.data(), m_buf.data() + start, count * sizeof(int64_t));
+        return result;
+    }
+
+private:
+    // Position absolue du champ, 0 s'il est absent
+    size_t field(uint16_t slot) const {
+        size_t entry = 4 + 2 * size_t{slot};
+        if (entry + 2 > m_vtableSize) return 0;
+        uint16_t offset = load<uint16_t>(m_buf, m_vtable + entry);
+        return offset ? m_pos + offset : 0;
+    }
+
+    std::string_view m_buf;
+    size_t m_pos;
+    size_t m_vtable = 0;
+    uint16_t m_vtableSize = 0;
+};
+
+enum class ValueKind { Int, Bool, Float, Utf8, LargeUtf8, Utf8View };
+
+struct FieldSpec {
+    std::string name;
+    ValueKind kind = ValueKind::Int;
+    int32_t bitWidth = 0;        // Int et FloatingPoint
+    bool isSigned = true;
+    bool dictionary = false;
+    int64_t dictionaryId = 0;
+    int32_t indexWidth = 32;
+    bool indexSigned = true;
+
+    bool isString() const {
+        return kind == ValueKind::Utf8 || kind == ValueKind::LargeUtf8 || kind == ValueKind::Utf8View;
+    }
+
+    // int64, uint32, uint64 : INT seulement si toutes les valeurs tiennent
+    bool isWideInt() const {
+        return kind == ValueKind::Int && (bitWidth == 64 || (bitWidth == 32 && !isSigned));
+    }
+};
+
+// Valeurs accumulées sur tous les RecordBatch
+struct ColumnBuilder {
+    std::vector<int> ints;
+    std::vector<double> doubles;     // Float, et entiers larges avant conversion
+    std::vector<StringId> ids;
+    bool fitsInt = true;
+};
+
+bool validIntWidth(int32_t width) {
+    return width == 8 || width == 16 || width == 32 || width == 64;
+}
+
+// Appelle f avec une valeur du type entier C++ correspondant
+template<typename F>
+void withIntType(int32_t bitWidth, bool isSigned, F&& f) {
+    switch (bitWidth) {
+        case 8: isSigned ? f(int8_t{}) : f(uint8_t{}); break;
+        case 16: isSigned ? f(int16_t{}) : f(uint16_t{}); break;
+        case 32: isSigned ? f(int32_t{}) : f(uint32_t{}); break;
+        default: isSigned ? f(int64_t{}) : f(uint64_t{}); break;
+    }
+}
+
+// Noeud d'un tableau et son bitmap de validité
+struct ArrayView {
+    size_t length = 0;
+    size_t nullCount = 0;
+    std::string_view validity;
+
+    bool isNull(size_t i) const {
+        return nullCount > 0 && !((static_cast<uint8_t>(validity[i >> 3]) >> (i & 7)) & 1);
+    }
+};
+
+/**
+ * Parcours des noeuds et buffers d'un RecordBatch, dans l'ordre des champs
+ */
+class BatchCursor {
+public:
+    BatchCursor(const FlatTable& batch, std::string_view body)
+        : m_body(body),
+          m_length(batch.scalar<int64_t>(BATCH_LENGTH, 0)),
+          m_nodes(batch.structs(BATCH_NODES)),
+          m_buffers(batch.structs(BATCH_BUFFERS)),
+          m_variadicCounts(batch.longs(BATCH_VARIADIC_COUNTS)) {
+        if (batch.has(BATCH_COMPRESSION)) {
+            throw std::runtime_error("Compressed Arrow IPC bodies are not supported");
+        }
+        if (m_length < 0) invalid("negative batch length");
+    }
+
+    size_t length() const { return static_cast<size_t>(m_length); }
+
+    ArrayView nextArray() {
+        if (m_node >= m_nodes.size()) invalid("missing field node");
+        auto [length, nullCount] = m_nodes[m_node++];
+        if (length != m_length || nullCount < 0 || nullCount > length) {
+            invalid("field node does not match the batch length");
+        }
+        // Au moins un bit par valeur (bool) : borne les calculs de tailles
+        if (static_cast<uint64_t>(length) > uint64_t{m_body.size()} * 8) {
+            invalid("array longer than the message body");
+        }
+        ArrayView array{static_cast<size_t>(length), static_cast<size_t>(nullCount), nextBuffer()};
+        if (array.nullCount > 0 && array.validity.size() < (array.length + 7) / 8) {
+            invalid("validity bitmap too short");
+        }
+        return array;
+    }
+
+    std::string_view nextBuffer() {
+        if (m_buffer >= m_buffers.size()) invalid("missing buffer");
+        auto [offset, length] = m_buffers[m_buffer++];
+        if (offset < 0 || length < 0 || static_cast<uint64_t>(offset) > m_body.size() ||
+            static_cast<uint64_t>(length) > m_body.size() - static_cast<uint64_t>(offset)) {
+            invalid("buffer out of bounds");
+        }
+        return m_body.substr(static_cast<size_t>(offset), static_cast<size_t>(length));
+    }
+
+    size_t nextVariadicCount() {
+        if (m_variadic >= m_variadicCounts.size() || m_variadicCounts[m_variadic] < 0 ||
+            static_cast<uint64_t>(m_variadicCounts[m_variadic]) > m_buffers.size() - m_buffer) {
+            invalid("bad variadic buffer count");
+        }
+        return static_cast<size_t>(m_variadicCounts[m_variadic++]);
+    }
+
+private:
+    std::string_view m_body;
+    int64_t m_length;
+    std::vector<Int64Pair> m_nodes;
+    std::vector<Int64Pair> m_buffers;
+    std::vector<int64_t> m_variadicCounts;
+    size_t m_node = 0;
+    size_t m_buffer = 0;
+    size_t m_variadic = 0;
+};
+
+void requireBytes(std::string_view buffer, size_t bytes) {
+    if (buffer.size() < bytes) invalid("values buffer too short");
+}
+
+template<typename T>
+void bulkAppend(std::vector<T>& target, std::string_view values, size_t count) {
+    size_t old = target.size();
+    target.resize(old + count);
+    if (count) std::memcpy(target.data() + old, values.data(), count * sizeof(T));
+}
+
+template<typename T>
+void appendNumbers(ColumnBuilder& col, const FieldSpec& spec, const ArrayView& array, std::string_view values) {
+    requireBytes(values, array.length * sizeof(T));
+    // Sans valeurs nulles, int32 et float64 sont copiés en bloc
+    if constexpr (std::is_same_v<T, int32_t>) {
+        if (array.nullCount == 0) return bulkAppend(col.ints, values, array.length);
+    } else if constexpr (std::is_same_v<T, double>) {
+        if (array.nullCount == 0) return bulkAppend(col.doubles, values, array.length);
+    }
+    for (size_t i = 0; i < array.length; ++i) {
+        T value{};
+        if (!array.isNull(i)) std::memcpy(&value, values.data() + i * sizeof(T), sizeof(T));
+        if constexpr (std::is_floating_point_v<T>) {
+            col.doubles.push_back(static_cast<double>(value));
+        } else if (spec.isWideInt()) {
+            col.doubles.push_back(static_cast<double>(value));
+            col.fitsInt = col.fitsInt && std::in_range<int>(value);
+        } else {
+            col.ints.push_back(static_cast<int>(value));
+        }
+    }
+}
+
+void appendBools(ColumnBuilder& col, const ArrayView& array, std::string_view values) {
+    requireBytes(values, (array.length + 7) / 8);
+    for (size_t i = 0; i < array.length; ++i) {
+        bool set = !array.isNull(i) && ((static_cast<uint8_t>(values[i >> 3]) >> (i & 7)) & 1);
+        col.ints.push_back(set ? 1 : 0);
+    }
+}
+
+template<typename Offset>
+void appendOffsetStrings(std::vector<StringId>& ids, StringPool& pool, const ArrayView& array,
+                         std::string_view offsets, std::string_view data) {
+    if (array.length == 0) return;
+    requireBytes(offsets, (array.length + 1) * sizeof(Offset));
+    ids.reserve(ids.size() + array.length);
+    Offset begin;
+    std::memcpy(&begin, offsets.data(), sizeof(Offset));
+    for (size_t i = 0; i < array.length; ++i) {
+        Offset end;
+        std::memcpy(&end, offsets.data() + (i + 1) * sizeof(Offset), sizeof(Offset));
+        if (begin < 0 || end < begin || static_cast<uint64_t>(end) > data.size()) {
+            invalid("string offsets out of bounds");
+        }
+        ids.push_back(array.isNull(i) ? pool.intern(std::string())
+                                      : pool.intern(std::string(data.substr(begin, end - begin))));
+        begin = end;
+    }
+}
+
+// Utf8View : 16 octets par valeur, inline jusqu'à 12 octets, sinon
+// (préfixe, index du buffer de données, offset)
+void appendViewStrings(std::vector<StringId>& ids, StringPool& pool, const ArrayView& array,
+                       std::string_view views, const std::vector<std::string_view>& data) {
+    requireBytes(views, array.length * 16);
+    ids.reserve(ids.size() + array.length);
+    for (size_t i = 0; i < array.length; ++i) {
+        if (array.isNull(i)) {
+            ids.push_back(pool.intern(std::string()));
+            continue;
+        }
+        const char* view = views.data() + i * 16;
+        int32_t length;
+        std::memcpy(&length, view, sizeof(length));
+        if (length < 0) invalid("negative string view length");
+        if (length <= 12) {
+            ids.push_back(pool.intern(std::string(view + 4, static_cast<size_t>(length))));
+            continue;
+        }
+        int32_t bufferIndex, offset;
+        std::memcpy(&bufferIndex, view + 8, sizeof(bufferIndex));
+        std::memcpy(&offset, view + 12, sizeof(offset));
+        if (bufferIndex < 0 || static_cast<size_t>(bufferIndex) >= data.size() || offset < 0 ||
+            static_cast<size_t>(offset) + static_cast<size_t>(length) > data[bufferIndex].size()) {
+            invalid("string view out of bounds");
+        }
+        ids.push_back(pool.intern(std::string(data[bufferIndex].substr(offset, length))));
+    }
+}
+
+void appendStrings(std::vector<StringId>& ids, StringPool& pool, ValueKind kind,
+                   const ArrayView& array, BatchCursor& cursor) {
+    if (kind == ValueKind::Utf8View) {
+        auto views = cursor.nextBuffer();
+        std::vector<std::string_view> data(cursor.nextVariadicCount());
+        for (auto& buffer : data) buffer = cursor.nextBuffer();
+        appendViewStrings(ids, pool, array, views, data);
+        return;
+    }
+    auto offsets = cursor.nextBuffer();
+    auto data = cursor.nextBuffer();
+    if (kind == ValueKind::LargeUtf8) {
+        appendOffsetStrings<int64_t>(ids, pool, array, offsets, data);
+    } else {
+        appendOffsetStrings<int32_t>(ids, pool, array, offsets, data);
+    }
+}
+
+template<typename Index>
+void appendIndices(std::vector<StringId>& ids, StringPool& pool, const std::vector<StringId>& dictionary,
+                   const ArrayView& array, std::string_view indices) {
+    requireBytes(indices, array.length * sizeof(Index));
+    ids.reserve(ids.size() + array.length);
+    for (size_t i = 0; i < array.length; ++i) {
+        if (array.isNull(i)) {
+            ids.push_back(pool.intern(std::string()));
+            continue;
+        }
+        Index index;
+        std::memcpy(&index, indices.data() + i * sizeof(Index), sizeof(Index));
+        if (!std::in_range<size_t>(index) || static_cast<size_t>(index) >= dictionary.size()) {
+            invalid("dictionary index out of range");
+        }
+        ids.push_back(dictionary[static_cast<size_t>(index)]);
+    }
+}
+
+/**
+ * Décodage d'un flux : Schema, puis DictionaryBatch / RecordBatch dans
+ * l'ordre, jusqu'au marqueur de fin (ou la fin des données)
+ */
+class StreamDecoder {
+public:
+    explicit StreamDecoder(std::string_view stream)
+        : m_stream(stream), m_df(std::make_shared<DataFrame>()) {}
+
+    std::shared_ptr<DataFrame> decode() {
+        while (auto metadata = nextMessage()) {
+            FlatTable message(*metadata, load<uint32_t>(*metadata, 0));
+            int64_t bodyLength = message.scalar<int64_t>(MESSAGE_BODY_LENGTH, 0);
+            if (bodyLength < 0 || static_cast<uint64_t>(bodyLength) > m_stream.size() - m_pos) {
+                invalid("truncated message body");
+            }
+            auto body = m_stream.substr(m_pos, static_cast<size_t>(bodyLength));
+            m_pos += static_cast<size_t>(bodyLength);
+
+            auto header = message.table(MESSAGE_HEADER);
+            if (!header) invalid("message without header");
+            uint8_t headerType = message.scalar<uint8_t>(MESSAGE_HEADER_TYPE, 0);
+            if (headerType != HEADER_SCHEMA && !m_hasSchema) invalid("schema must come first");
+
+            switch (headerType) {
+                case HEADER_SCHEMA: readSchema(*header); break;
+                case HEADER_DICTIONARY_BATCH: readDictionary(*header, body); break;
+                case HEADER_RECORD_BATCH: readBatch(*header, body); break;
+                default:
+                    throw std::runtime_error("Unsupported Arrow IPC message type " + std::to_string(headerType));
+            }
+        }
+        if (!m_hasSchema) invalid("missing schema");
+        return finish();
+    }
+
+private:
+    // Métadonnées du message suivant, nullopt en fin de flux
+    std::optional<std::string_view> nextMessage() {
+        if (m_pos == m_stream.size()) return std::nullopt;
+        uint32_t length = load<uint32_t>(m_stream, m_pos);
+        m_pos += sizeof(uint32_t);
+        // Avant Arrow 0.15 : pas de marqueur de continuation
+        if (length == CONTINUATION) {
+            length = load<uint32_t>(m_stream, m_pos);
+            m_pos += sizeof(uint32_t);
+        }
+        if (length == 0) return std::nullopt;
+        if (length > m_stream.size() - m_pos) invalid("truncated message");
+        auto metadata = m_stream.substr(m_pos, length);
+        m_pos += length;
+        return metadata;
+    }
+
+    void readSchema(const FlatTable& schema) {
+        if (m_hasSchema) invalid("duplicate schema");
+        m_hasSchema = true;
+        if (schema.scalar<int16_t>(SCHEMA_ENDIANNESS, 0) != 0) {
+            throw std::runtime_error("Big-endian Arrow IPC streams are not supported");
+        }
+        for (const auto& field : schema.tables(SCHEMA_FIELDS)) {
+            m_fields.push_back(parseField(field));
+        }
+        m_columns.resize(m_fields.size());
+    }
+
+    FieldSpec parseField(const FlatTable& field) const {
+        FieldSpec spec;
+        spec.name = std::string(field.string(FIELD_NAME));
+        auto type = field.table(FIELD_TYPE);
+        uint8_t typeId = field.scalar<uint8_t>(FIELD_TYPE_TYPE, 0);
+
+        switch (typeId) {
+            case TYPE_INT:
+                spec.kind = ValueKind::Int;
+                spec.bitWidth = type ? type->scalar<int32_t>(INT_BIT_WIDTH, 0) : 0;
+                spec.isSigned = type && type->scalar<uint8_t>(INT_IS_SIGNED, 0) != 0;
+                if (!validIntWidth(spec.bitWidth)) invalid("bad integer width for column '" + spec.name + "'");
+                break;
+            case TYPE_FLOATING_POINT: {
+                int16_t precision = type ? type->scalar<int16_t>(FLOAT_PRECISION, 0) : 0;
+                if (precision != PRECISION_SINGLE && precision != PRECISION_DOUBLE) {
+                    throw std::runtime_error("Unsupported Arrow float precision for column '" + spec.name + "'");
+                }
+                spec.kind = ValueKind::Float;
+                spec.bitWidth = precision == PRECISION_SINGLE ? 32 : 64;
+                break;
+            }
+            case TYPE_BOOL: spec.kind = ValueKind::Bool; break;
+            case TYPE_UTF8: spec.kind = ValueKind::Utf8; break;
+            case TYPE_LARGE_UTF8: spec.kind = ValueKind::LargeUtf8; break;
+            case TYPE_UTF8_VIEW: spec.kind = ValueKind::Utf8View; break;
+            default:
+                throw std::runtime_error("Unsupported Arrow type " + std::to_string(typeId) +
+                                         " for column '" + spec.name + "'");
+        }
+
+        if (auto encoding = field.table(FIELD_DICTIONARY)) {
+            if (!spec.isString()) {
+                throw std::runtime_error("Unsupported dictionary-encoded column '" + spec.name + "'");
+            }
+            spec.dictionary = true;
+            spec.dictionaryId = encoding->scalar<int64_t>(ENCODING_ID, 0);
+            if (auto index = encoding->table(ENCODING_INDEX_TYPE)) {
+                spec.indexWidth = index->scalar<int32_t>(INT_BIT_WIDTH, 0);
+                spec.indexSigned = index->scalar<uint8_t>(INT_IS_SIGNED, 0) != 0;
+            }
+            if (!validIntWidth(spec.indexWidth)) invalid("bad dictionary index width for column '" + spec.name + "'");
+        }
+        return spec;
+    }
+
+    void readDictionary(const FlatTable& batch, std::string_view body) {
+        int64_t id = batch.scalar<int64_t>(DICTIONARY_ID, 0);
+        auto spec = std::find_if(m_fields.begin(), m_fields.end(), [id](const FieldSpec& f) {
+            return f.dictionary && f.dictionaryId == id;
+        });
+        if (spec == m_fields.end()) invalid("unknown dictionary id " + std::to_string(id));
+        auto data = batch.table(DICTIONARY_DATA);
+        if (!data) invalid("dictionary batch without data");
+
+        BatchCursor cursor(*data, body);
+        auto& values = m_dictionaries[id];
+        if (batch.scalar<uint8_t>(DICTIONARY_IS_DELTA, 0) == 0) values.clear();
+        auto array = cursor.nextArray();
+        appendStrings(values, *m_df->getStringPool(), spec->kind, array, cursor);
+    }
+
+    void readBatch(const FlatTable& batch, std::string_view body) {
+        BatchCursor cursor(batch, body);
+        auto& pool = *m_df->getStringPool();
+
+        for (size_t f = 0; f < m_fields.size(); ++f) {
+            const auto& spec = m_fields[f];
+            auto& col = m_columns[f];
+            auto array = cursor.nextArray();
+
+            if (spec.dictionary) {
+                auto it = m_dictionaries.find(spec.dictionaryId);
+                if (it == m_dictionaries.end()) invalid("missing dictionary for column '" + spec.name + "'");
+                auto indices = cursor.nextBuffer();
+                withIntType(spec.indexWidth, spec.indexSigned, [&](auto index) {
+                    appendIndices<decltype(index)>(col.ids, pool, it->second, array, indices);
+                });
+            } else if (spec.isString()) {
+                appendStrings(col.ids, pool, spec.kind, array, cursor);
+            } else if (spec.kind == ValueKind::Bool) {
+                appendBools(col, array, cursor.nextBuffer());
+            } else if (spec.kind == ValueKind::Float) {
+                auto values = cursor.nextBuffer();
+                if (spec.bitWidth == 32) {
+                    appendNumbers<float>(col, spec, array, values);
+                } else {
+                    appendNumbers<double>(col, spec, array, values);
+                }
+            } else {
+                auto values = cursor.nextBuffer();
+                withIntType(spec.bitWidth, spec.isSigned, [&](auto value) {
+                    appendNumbers<decltype(value)>(col, spec, array, values);
+                });
+            }
+        }
+    }
+
+    std::shared_ptr<DataFrame> finish() {
+        for (size_t f = 0; f < m_fields.size(); ++f) {
+            const auto& spec = m_fields[f];
+            auto& col = m_columns[f];
+            if (spec.isString()) {
+                auto column = std::make_shared<StringColumn>(spec.name, m_df->getStringPool());
+                column->appendIds(col.ids);
+                m_df->addColumn(column);
+            } else if (spec.kind == ValueKind::Float || (spec.isWideInt() && !col.fitsInt)) {
+                auto column = std::make_shared<DoubleColumn>(spec.name);
+                column->append(col.doubles);
+                m_df->addColumn(column);
+            } else {
+                auto column = std::make_shared<IntColumn>(spec.name);
+                if (spec.isWideInt()) {
+                    column->reserve(col.doubles.size());
+                    for (double value : col.doubles) column->push_back(static_cast<int>(value));
+                } else {
+                    column->append(col.ints);
+                }
+                m_df->addColumn(column);
+            }
+        }
+        return m_df;
+    }
+
+    std::string_view m_stream;
+    size_t m_pos = 0;
+    std::shared_ptr<DataFrame> m_df;
+    bool m_hasSchema = false;
+    std::vector<FieldSpec> m_fields;
+    std::vector<ColumnBuilder> m_columns;
+    std::unordered_map<int64_t, std::vector<StringId>> m_dictionaries;
+};
+
+} // namespace
+
+std::string ArrowIpc::write(const DataFrame& df) {
+    return write(df, df.getColumnNames(), 0, df.rowCount());
+}
+
+std::string ArrowIpc::write(const DataFrame& df, const std::vector<std::string>& columns,
+                            size_t startRow, size_t endRow, const Metadata& metadata) {
+    endRow = std::min(endRow, df.rowCount());
+    startRow = std::min(startRow, endRow);
+    size_t rows = endRow - startRow;
+
+    std::vector<ColumnOut> outs(columns.size());
+    size_t estimate = 4096;
+    for (size_t c = 0; c < columns.size(); ++c) {
+        auto& out = outs[c];
+        out.column = df.getColumn(columns[c]);
+        visitColumn(*out.column, [&](const auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            const auto* values = typed.data().data() + startRow;
+            if constexpr (std::is_same_v<Col, StringColumn>) {
+                const auto& pool = *typed.getStringPool();
+                std::vector<const std::string*> strings;
+
+                // Pool entier : les StringId sont directement les indices
+                if (pool.size() <= rows && pool.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                    strings.reserve(pool.size());
+                    for (StringId id = 0; id < pool.size(); ++id) strings.push_back(&pool.getString(id));
+                    out.values = values;
+                } else {
+                    std::unordered_map<StringId, int32_t> remap;
+                    out.indices.resize(rows);
+                    for (size_t i = 0; i < rows; ++i) {
+                        auto [it, inserted] = remap.try_emplace(values[i], static_cast<int32_t>(strings.size()));
+                        if (inserted) strings.push_back(&pool.getString(values[i]));
+                        out.indices[i] = it->second;
+                    }
+                    out.values = out.indices.data();
+                }
+
+                out.offsets.reserve(strings.size() + 1);
+                out.offsets.push_back(0);
+                for (const auto* s : strings) {
+                    out.bytes += *s;
+                    if (out.bytes.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                        throw std::runtime_error("Arrow dictionary exceeds 2 GiB for column '" + columns[c] + "'");
+                    }
+                    out.offsets.push_back(static_cast<int32_t>(out.bytes.size()));
+                }
+                estimate += out.bytes.size() + out.offsets.size() * sizeof(int32_t) + rows * sizeof(int32_t);
+            } else {
+                out.values = values;
+                estimate += rows * sizeof(values[0]);
+            }
+        });
+    }
+
+    std::string result;
+    result.reserve(estimate);
+
+    // Schema
+    {
+        FlatBuilder fb;
+        std::vector<Ref> fields;
+        for (size_t c = 0; c < columns.size(); ++c) {
+            auto type = outs[c].column->getType();
+            Ref name = fb.string(columns[c]);
+            Ref typeTable;
+            uint8_t typeId;
+            Ref encoding = 0;
+            if (type == ColumnTypeOpt::INT) {
+                typeId = TYPE_INT;
+                typeTable = intType(fb, 32, true);
+            } else if (type == ColumnTypeOpt::DOUBLE) {
+                typeId = TYPE_FLOATING_POINT;
+                fb.startTable();
+                fb.add<int16_t>(FLOAT_PRECISION, PRECISION_DOUBLE);
+                typeTable = fb.endTable();
+            } else {
+                typeId = TYPE_UTF8;
+                fb.startTable();
+                typeTable = fb.endTable();
+                Ref indexType = intType(fb, 32, true);
+                fb.startTable();
+                fb.add<int64_t>(ENCODING_ID, static_cast<int64_t>(c));
+                fb.addRef(ENCODING_INDEX_TYPE, indexType);
+                fb.add<uint8_t>(ENCODING_IS_ORDERED, 0);
+                encoding = fb.endTable();
+            }
+            Ref children = fb.offsets({});
+            fb.startTable();
+            fb.addRef(FIELD_NAME, name);
+            fb.addRef(FIELD_TYPE, typeTable);
+            if (encoding) fb.addRef(FIELD_DICTIONARY, encoding);
+            fb.addRef(FIELD_CHILDREN, children);
+            fb.add<uint8_t>(FIELD_NULLABLE, 0);
+            fb.add<uint8_t>(FIELD_TYPE_TYPE, typeId);
+            fields.push_back(fb.endTable());
+        }
+        Ref fieldVector = fb.offsets(fields);
+
+        std::vector<Ref> entries;
+        for (const auto& [key, value] : metadata) {
+            Ref keyRef = fb.string(key);
+            Ref valueRef = fb.string(value);
+            fb.startTable();
+            fb.addRef(KV_KEY, keyRef);
+            fb.addRef(KV_VALUE, valueRef);
+            entries.push_back(fb.endTable());
+        }
+        Ref entryVector = entries.empty() ? 0 : fb.offsets(entries);
+
+        fb.startTable();
+        fb.addRef(SCHEMA_FIELDS, fieldVector);
+        if (entryVector) fb.addRef(SCHEMA_CUSTOM_METADATA, entryVector);
+        fb.add<int16_t>(SCHEMA_ENDIANNESS, 0);
+        Ref schema = fb.endTable();
+        appendMessage(result, finishMessage(fb, HEADER_SCHEMA, schema, Body{}), Body{});
+    }
+
+    // Un dictionnaire par colonne string (id = position de la colonne)
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const auto& out = outs[c];
+        if (out.column->getType() != ColumnTypeOpt::STRING) continue;
+        int64_t count = static_cast<int64_t>(out.offsets.size() - 1);
+        Body body;
+        body.nodes.push_back({count, 0});
+        body.add(nullptr, 0);
+        body.add(out.offsets.data(), out.offsets.size() * sizeof(int32_t));
+        body.add(out.bytes.data(), out.bytes.size());
+
+        FlatBuilder fb;
+        Ref data = recordBatch(fb, count, body);
+        fb.startTable();
+        fb.add<int64_t>(DICTIONARY_ID, static_cast<int64_t>(c));
+        fb.addRef(DICTIONARY_DATA, data);
+        fb.add<uint8_t>(DICTIONARY_IS_DELTA, 0);
+        Ref batch = fb.endTable();
+        appendMessage(result, finishMessage(fb, HEADER_DICTIONARY_BATCH, batch, body), body);
+    }
+
+    // RecordBatch : buffers des colonnes sans bitmap de validité
+    {
+        Body body;
+        for (const auto& out : outs) {
+            size_t width = out.column->getType() == ColumnTypeOpt::DOUBLE ? sizeof(double) : sizeof(int32_t);
+            body.nodes.push_back({static_cast<int64_t>(rows), 0});
+            body.add(nullptr, 0);
+            body.add(out.values, rows * width);
+        }
+        FlatBuilder fb;
+        Ref batch = recordBatch(fb, static_cast<int64_t>(rows), body);
+        appendMessage(result, finishMessage(fb, HEADER_RECORD_BATCH, batch, body), body);
+    }
+
+    // Fin de flux
+    const uint32_t eos[2] = {CONTINUATION, 0};
+    result.append(reinterpret_cast<const char*>(eos), sizeof(eos));
+    return result;
+}
+
+std::shared_ptr<DataFrame> ArrowIpc::read(std::string_view stream) {
+    return StreamDecoder(stream).decode();
+}
+
+} // namespace dataframe
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "DataFrame.hpp"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dataframe {
+
+/**
+ * Flux Arrow IPC (format "stream") : échange colonnaire binaire avec
+ * pyarrow / Polars, sans passer par JSON
+ *
+ * Écriture : un message Schema, un DictionaryBatch par colonne string puis un
+ * RecordBatch. Les buffers int32 / float64 sont copiés tels quels depuis les
+ * colonnes. Les colonnes string sont dictionary-encoded (indices int32) : le
+ * dictionnaire est le StringPool entier s'il n'est pas plus grand que la plage
+ * écrite (les StringId servent alors d'indices), sinon les seules strings
+ * référencées, renumérotées.
+ *
+ * Lecture : Int (toutes largeurs), Bool, FloatingPoint (float / double), Utf8,
+ * LargeUtf8, Utf8View et leurs versions dictionary-encoded, sur un ou plusieurs
+ * RecordBatch. int8..int32, uint8, uint16 et bool → INT ; int64, uint32 et
+ * uint64 → INT si toutes les valeurs tiennent sur 32 bits, DOUBLE sinon.
+ * Les valeurs nulles deviennent 0, 0.0 ou "".
+ *
+ * Lève std::runtime_error pour un flux invalide ou tronqué, un corps compressé
+ * ou un type non supporté (listes, structs, dates...).
+ */
+class ArrowIpc {
+public:
+    static constexpr const char* MIME_TYPE = "application/vnd.apache.arrow.stream";
+
+    // custom_metadata du schéma (clé, valeur)
+    using Metadata = std::vector<std::pair<std::string, std::string>>;
+
+    // DataFrame complet, colonnes dans l'ordre du DataFrame
+    static std::string write(const DataFrame& df);
+
+    // Lignes [startRow, endRow) des colonnes données
+    static std::string write(const DataFrame& df, const std::vector<std::string>& columns,
+                             size_t startRow, size_t endRow, const Metadata& metadata = {});
+
+    static std::shared_ptr<DataFrame> read(std::string_view stream);
+};
+
+} // namespace dataframe
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace dataframe {
+
+/**
+ * Levée par une opération annulée ou arrivée à échéance
+ */
+class OperationCancelled : public std::runtime_error {
+public:
+    explicit OperationCancelled(const std::string& message) : std::runtime_error(message) {}
+};
+
+/**
+ * Jeton d'annulation coopérative : annulation explicite et/ou échéance
+ *
+ * Partagé entre celui qui annule (client déconnecté, endpoint cancel,
+ * timeout) et l'exécution, qui le consulte entre deux nœuds et
+ * périodiquement dans les boucles longues (checkCancelled).
+ * Thread-safe.
+ */
+class CancellationToken {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+
+    void setDeadline(Clock::time_point deadline) {
+        m_deadline.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    bool isCancelled() const { return m_cancelled.load(std::memory_order_relaxed) || isExpired(); }
+
+    bool isExpired() const {
+        return Clock::now().time_since_epoch().count() >= m_deadline.load(std::memory_order_relaxed);
+    }
+
+    void throwIfCancelled() const {
+        if (m_cancelled.load(std::memory_order_relaxed)) {
+            throw OperationCancelled("Execution cancelled");
+        }
+        if (isExpired()) {
+            throw OperationCancelled("Execution timed out");
+        }
+    }
+
+private:
+    std::atomic<bool> m_cancelled{false};
+    std::atomic<Clock::rep> m_deadline{Clock::time_point::max().time_since_epoch().count()};
+};
+
+namespace detail {
+inline thread_local const CancellationToken* currentCancellation = nullptr;
+}
+
+/**
+ * Jeton consulté par checkCancelled() sur le thread courant (nullptr si aucun)
+ */
+inline const CancellationToken* currentCancellation() {
+    return detail::currentCancellation;
+}
+
+/**
+ * Installe un jeton sur le thread courant le temps d'une portée
+ * (l'exécuteur de nœuds autour de compile, runParallel dans ses workers)
+ */
+class CancellationScope {
+public:
+    explicit CancellationScope(const CancellationToken* token)
+        : m_previous(detail::currentCancellation) {
+        detail::currentCancellation = token;
+    }
+    ~CancellationScope() { detail::currentCancellation = m_previous; }
+
+    CancellationScope(const CancellationScope&) = delete;
+    CancellationScope& operator=(const CancellationScope&) = delete;
+
+private:
+    const CancellationToken* m_previous;
+};
+
+// Lignes traitées entre deux consultations du jeton dans les boucles
+constexpr size_t CANCEL_CHECK_ROWS = size_t(1) << 16;
+
+// Lève OperationCancelled si le jeton du thread courant est annulé ou expiré
+inline void checkCancelled() {
+    if (const auto* token = detail::currentCancellation) {
+        token->throwIfCancelled();
+    }
+}
+
+// Variante pour les boucles : ne consulte le jeton que toutes les CANCEL_CHECK_ROWS itérations
+inline void checkCancelled(size_t iteration) {
+    if ((iteration & (CANCEL_CHECK_ROWS - 1)) == 0) {
+        checkCancelled();
+    }
+}
+
+} // namespace dataframe
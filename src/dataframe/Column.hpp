@@ -1,12 +1,15 @@
 #pragma once
 
 #include "StringPool.hpp"
+#include "StringMatcher.hpp"
 #include <vector>
 #include <string>
 #include <memory>
+#include <span>
 #include <cstdint>
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
 
 namespace dataframe {
 
@@ -69,6 +72,8 @@ public:
     void clear() override { m_data.clear(); }
 
     void push_back(int value) { m_data.push_back(value); }
+    // Ajout en bloc (lecteurs CSV / binaires)
+    void append(std::span<const int> values) { m_data.insert(m_data.end(), values.begin(), values.end()); }
     void set(size_t index, int value) { m_data[index] = value; }
     int at(size_t index) const { return m_data[index]; }
     const std::vector<int>& data() const { return m_data; }
@@ -209,6 +214,8 @@ public:
     void clear() override { m_data.clear(); }
 
     void push_back(double value) { m_data.push_back(value); }
+    // Ajout en bloc (lecteurs CSV / binaires)
+    void append(std::span<const double> values) { m_data.insert(m_data.end(), values.begin(), values.end()); }
     void set(size_t index, double value) { m_data[index] = value; }
     double at(size_t index) const { return m_data[index]; }
     const std::vector<double>& data() const { return m_data; }
@@ -362,6 +369,11 @@ public:
         m_data.push_back(id);
     }
 
+    // Ajout en bloc d'IDs déjà internés dans le pool de la colonne
+    void appendIds(std::span<const StringId> ids) {
+        m_data.insert(m_data.end(), ids.begin(), ids.end());
+    }
+
     void set(size_t index, const std::string& value) {
         StringId id = m_string_pool->intern(value);
         m_data[index] = id;
@@ -383,8 +395,12 @@ public:
     std::shared_ptr<StringPool> getStringPool() const { return m_string_pool; }
 
     std::vector<size_t> filterEqual(const std::string& value) const override {
-        StringId targetId = m_string_pool->intern(value);
+        // Chaîne absente du pool : aucune ligne, sans l'internaliser
+        StringId targetId = m_string_pool->find(value);
         std::vector<size_t> result;
+        if (targetId == StringPool::INVALID_ID) {
+            return result;
+        }
         result.reserve(m_data.size() / 10);
 
         // Comparaison d'entiers → ultra rapide !
@@ -397,7 +413,7 @@ public:
     }
 
     std::vector<size_t> filterNotEqual(const std::string& value) const override {
-        StringId targetId = m_string_pool->intern(value);
+        StringId targetId = m_string_pool->find(value);
         std::vector<size_t> result;
         result.reserve(m_data.size());
 
@@ -410,67 +426,56 @@ public:
     }
 
     std::vector<size_t> filterLessThan(const std::string& value) const override {
-        std::vector<size_t> result;
-        result.reserve(m_data.size() / 2);
-
-        for (size_t i = 0; i < m_data.size(); ++i) {
-            const std::string& str = m_string_pool->getString(m_data[i]);
-            if (str < value) {
-                result.push_back(i);
-            }
-        }
-        return result;
+        return filterMatching(*StringMatcher::create("<", value));
     }
 
     std::vector<size_t> filterLessOrEqual(const std::string& value) const override {
-        std::vector<size_t> result;
-        result.reserve(m_data.size() / 2);
-
-        for (size_t i = 0; i < m_data.size(); ++i) {
-            const std::string& str = m_string_pool->getString(m_data[i]);
-            if (str <= value) {
-                result.push_back(i);
-            }
-        }
-        return result;
+        return filterMatching(*StringMatcher::create("<=", value));
     }
 
     std::vector<size_t> filterGreaterThan(const std::string& value) const override {
-        std::vector<size_t> result;
-        result.reserve(m_data.size() / 2);
-
-        for (size_t i = 0; i < m_data.size(); ++i) {
-            const std::string& str = m_string_pool->getString(m_data[i]);
-            if (str > value) {
-                result.push_back(i);
-            }
-        }
-        return result;
+        return filterMatching(*StringMatcher::create(">", value));
     }
 
     std::vector<size_t> filterGreaterOrEqual(const std::string& value) const override {
-        std::vector<size_t> result;
-        result.reserve(m_data.size() / 2);
-
-        for (size_t i = 0; i < m_data.size(); ++i) {
-            const std::string& str = m_string_pool->getString(m_data[i]);
-            if (str >= value) {
-                result.push_back(i);
-            }
-        }
-        return result;
+        return filterMatching(*StringMatcher::create(">=", value));
     }
 
     std::vector<size_t> filterContains(const std::string& substring) const override {
-        std::vector<size_t> result;
-        result.reserve(m_data.size() / 10);
-
-        for (size_t i = 0; i < m_data.size(); ++i) {
-            const std::string& str = m_string_pool->getString(m_data[i]);
-            if (str.find(substring) != std::string::npos) {
-                result.push_back(i);
+        return filterMatching(*StringMatcher::create("contains", substring));
+    }
+
+    /**
+     * Filtre par prédicat de chaîne évalué une fois par StringId
+     * - Pool pas plus grand que la colonne : bitmap sur tout le dictionnaire,
+     *   puis gather sans branchement sur les ids
+     * - Pool partagé beaucoup plus grand : évaluation paresseuse des seuls ids
+     *   rencontrés (mémoïsée), sauf si le pool a un index de trigrammes
+     */
+    std::vector<size_t> filterMatching(const StringMatcher& matcher) const {
+        std::vector<size_t> result(m_data.size());
+        size_t count = 0;
+
+        if (m_string_pool->size() <= m_data.size() || m_string_pool->trigramIndexEnabled()) {
+            auto bitmap = matcher.evaluate(*m_string_pool);
+            for (size_t i = 0; i < m_data.size(); ++i) {
+                result[count] = i;
+                count += bitmap[m_data[i]];
+            }
+        } else {
+            enum : uint8_t { NO = 0, YES = 1, UNKNOWN = 2 };
+            std::vector<uint8_t> memo(m_string_pool->size(), UNKNOWN);
+            for (size_t i = 0; i < m_data.size(); ++i) {
+                uint8_t& match = memo[m_data[i]];
+                if (match == UNKNOWN) {
+                    match = matcher.matches(m_string_pool->getString(m_data[i])) ? YES : NO;
+                }
+                result[count] = i;
+                count += match;
             }
         }
+
+        result.resize(count);
         return result;
     }
 
@@ -518,4 +523,48 @@ private:
 
 using IColumnPtr = std::shared_ptr<IColumn>;
 
+/**
+ * Dispatch typé sur une colonne : un seul switch sur getType(), puis le
+ * visiteur reçoit la colonne concrète (IntColumn&, DoubleColumn&, StringColumn&)
+ *
+ * À utiliser hors des boucles par ligne : la boucle est écrite dans le
+ * visiteur générique (auto& typed) et instanciée une fois par type, sans
+ * dynamic_pointer_cast ni appel virtuel par cellule.
+ *
+ *   visitColumn(*col, [&](auto& typed) {
+ *       for (size_t i = 0; i < typed.size(); ++i) out.push_back(typed.at(i));
+ *   });
+ *
+ * Le visiteur doit renvoyer le même type pour les trois colonnes.
+ */
+template<typename F>
+decltype(auto) visitColumn(IColumn& col, F&& visitor) {
+    switch (col.getType()) {
+        case ColumnTypeOpt::INT:
+            return visitor(static_cast<IntColumn&>(col));
+        case ColumnTypeOpt::DOUBLE:
+            return visitor(static_cast<DoubleColumn&>(col));
+        case ColumnTypeOpt::STRING:
+        default:
+            return visitor(static_cast<StringColumn&>(col));
+    }
+}
+
+template<typename F>
+decltype(auto) visitColumn(const IColumn& col, F&& visitor) {
+    switch (col.getType()) {
+        case ColumnTypeOpt::INT:
+            return visitor(static_cast<const IntColumn&>(col));
+        case ColumnTypeOpt::DOUBLE:
+            return visitor(static_cast<const DoubleColumn&>(col));
+        case ColumnTypeOpt::STRING:
+        default:
+            return visitor(static_cast<const StringColumn&>(col));
+    }
+}
+
+// Type concret d'une colonne visitée (ex: std::is_same_v<ColumnT<decltype(typed)>, IntColumn>)
+template<typename T>
+using ColumnT = std::remove_cv_t<std::remove_reference_t<T>>;
+
 } // namespace dataframe
\ No newline at end of file
@@ -0,0 +1,566 @@
+#include "ColumnarFile.hpp"
+#include "MappedFile.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace dataframe {
+
+namespace {
+
+using StringId = StringPool::StringId;
+
+constexpr char MAGIC[8] = {'A', 'N', 'O', 'D', 'E', 'D', 'F', '\0'};
+constexpr uint64_t ALIGNMENT = 64;
+constexpr uint32_t FLAG_STATS = 1;
+constexpr uint32_t FLAG_CHECKSUMS = 2;
+constexpr StringId UNUSED = std::numeric_limits<StringId>::max();
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t rowCount;
+    uint32_t columnCount;
+    uint32_t chunkRows;
+    uint64_t columnTableOffset;
+    uint64_t namesOffset;
+    uint64_t namesBytes;
+    uint64_t stringCount;
+    uint64_t stringOffsetsOffset;   // uint64[stringCount + 1], relatifs aux octets
+    uint64_t stringBytesOffset;
+    uint64_t stringBytes;
+    uint64_t stringChecksum;
+    uint64_t reserved[4];
+};
+static_assert(sizeof(FileHeader) == 128);
+
+struct ColumnEntry {
+    uint8_t type;
+    uint8_t descending;
+    uint16_t reserved0;
+    int32_t sortRank;               // -1 : hors de l'ordre de tri déclaré
+    uint32_t nameOffset;            // Relatif au bloc des noms
+    uint32_t nameLength;
+    uint64_t dataOffset;
+    uint64_t dataBytes;
+    uint64_t statsOffset;           // 0 : pas de stats
+    uint64_t reserved[3];
+};
+static_assert(sizeof(ColumnEntry) == 64);
+static_assert(sizeof(ColumnarFile::ChunkStats) == 32);
+
+uint64_t alignUp(uint64_t offset) {
+    return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// Checksum 64 bits mot par mot (détection de corruption, pas cryptographique)
+uint64_t checksum(const char* data, size_t size) {
+    constexpr uint64_t K1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t K2 = 0xC2B2AE3D27D4EB4FULL;
+    uint64_t h = K2 ^ size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        h = rotl(h ^ (word * K1), 31) * K2;
+    }
+    uint64_t tail = 0;
+    if (i < size) std::memcpy(&tail, data + i, size - i);
+    h = rotl(h ^ (tail * K1), 31) * K2;
+    h ^= h >> 33;
+    h *= K1;
+    h ^= h >> 29;
+    return h;
+}
+
+size_t elementSize(ColumnTypeOpt type) {
+    switch (type) {
+        case ColumnTypeOpt::INT: return sizeof(int);
+        case ColumnTypeOpt::DOUBLE: return sizeof(double);
+        case ColumnTypeOpt::STRING: return sizeof(StringId);
+    }
+    return 0;
+}
+
+// Écriture séquentielle avec bourrage jusqu'aux offsets alignés
+class FileOut {
+public:
+    explicit FileOut(const std::string& path) : m_path(path) {
+        m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (m_fd < 0) {
+            throw std::runtime_error("Cannot create file: " + path);
+        }
+    }
+
+    ~FileOut() {
+        if (m_fd >= 0) ::close(m_fd);
+    }
+
+    void write(const void* data, size_t size) {
+        const char* p = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t written = ::write(m_fd, p, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("Cannot write file: " + m_path);
+            }
+            p += written;
+            size -= static_cast<size_t>(written);
+            m_position += static_cast<uint64_t>(written);
+        }
+    }
+
+    void padTo(uint64_t offset) {
+        static const char zeros[ALIGNMENT] = {};
+        while (m_position < offset) {
+            write(zeros, std::min<uint64_t>(offset - m_position, ALIGNMENT));
+        }
+    }
+
+    // Données sur disque avant le rename() qui les publie
+    void close() {
+        int fd = m_fd;
+        m_fd = -1;
+        bool synced = ::fsync(fd) == 0;
+        if (::close(fd) != 0 || !synced) {
+            throw std::runtime_error("Cannot write file: " + m_path);
+        }
+    }
+
+private:
+    std::string m_path;
+    int m_fd = -1;
+    uint64_t m_position = 0;
+};
+
+// Nom temporaire propre à chaque écriture : deux écrivains du même
+// fichier (processus ou threads) ne partagent jamais leur fichier temporaire
+std::string temporaryPath(const std::string& path) {
+    static std::atomic<uint64_t> counter{0};
+    return path + "." + std::to_string(::getpid()) + "." + std::to_string(counter++) + ".tmp";
+}
+
+// Rend durable l'entrée créée par rename() dans le répertoire
+void syncDirectory(const std::string& path) {
+    auto directory = std::filesystem::path(path).parent_path();
+    if (directory.empty()) directory = ".";
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot sync directory: " + directory.string());
+    }
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    if (!synced) {
+        throw std::runtime_error("Cannot sync directory: " + directory.string());
+    }
+}
+
+// Colonne prête à écrire : pointeur vers les octets et stats
+struct ColumnOut {
+    ColumnEntry entry{};
+    const char* bytes = nullptr;
+    std::vector<StringId> remapped;  // IDs renumérotés (colonnes string)
+    std::vector<ColumnarFile::ChunkStats> stats;
+};
+
+template<typename T>
+void numericStats(std::span<const T> values, size_t chunkRows, std::vector<ColumnarFile::ChunkStats>& stats) {
+    for (size_t c = 0; c < stats.size(); ++c) {
+        size_t begin = c * chunkRows;
+        size_t end = std::min(values.size(), begin + chunkRows);
+        double min = std::numeric_limits<double>::infinity();
+        double max = -min;
+        for (size_t i = begin; i < end; ++i) {
+            double v = static_cast<double>(values[i]);
+            if (v < min) min = v;
+            if (v > max) max = v;
+        }
+        stats[c].min = min;
+        stats[c].max = max;
+    }
+}
+
+/**
+ * Vue validée d'un fichier projeté
+ */
+class MappedColumnarFile {
+public:
+    explicit MappedColumnarFile(const std::string& path) : m_path(path), m_file(path) {
+        if (m_file.size() < sizeof(FileHeader)) {
+            throw std::runtime_error("Not a columnar DataFrame file: " + path);
+        }
+        std::memcpy(&m_header, m_file.data(), sizeof(FileHeader));
+        if (std::memcmp(m_header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("Not a columnar DataFrame file: " + path);
+        }
+        if (m_header.version != ColumnarFile::VERSION) {
+            throw std::runtime_error("Unsupported columnar file version " +
+                                     std::to_string(m_header.version) + ": " + path);
+        }
+        if (m_header.chunkRows == 0 || m_header.rowCount > m_file.size() ||
+            m_header.stringOffsetsOffset % sizeof(uint64_t) != 0) {
+            throw std::runtime_error("Corrupted columnar file: " + path);
+        }
+
+        check(m_header.columnTableOffset, uint64_t{m_header.columnCount} * sizeof(ColumnEntry));
+        check(m_header.namesOffset, m_header.namesBytes);
+        m_entries.resize(m_header.columnCount);
+        std::memcpy(m_entries.data(), at(m_header.columnTableOffset), m_entries.size() * sizeof(ColumnEntry));
+
+        size_t chunks = chunkCount();
+        for (const auto& entry : m_entries) {
+            if (entry.type > static_cast<uint8_t>(ColumnTypeOpt::STRING) ||
+                uint64_t{entry.nameOffset} + entry.nameLength > m_header.namesBytes ||
+                entry.dataOffset % ALIGNMENT != 0 ||
+                entry.dataBytes != m_header.rowCount * elementSize(static_cast<ColumnTypeOpt>(entry.type))) {
+                throw std::runtime_error("Corrupted columnar file: " + path);
+            }
+            check(entry.dataOffset, entry.dataBytes);
+            if (entry.statsOffset != 0) {
+                check(entry.statsOffset, chunks * sizeof(ColumnarFile::ChunkStats));
+            }
+        }
+
+        if (m_header.stringCount > (m_file.size() / sizeof(uint64_t))) {
+            throw std::runtime_error("Corrupted columnar file: " + path);
+        }
+        check(m_header.stringOffsetsOffset, (m_header.stringCount + 1) * sizeof(uint64_t));
+        check(m_header.stringBytesOffset, m_header.stringBytes);
+    }
+
+    const FileHeader& header() const { return m_header; }
+    const std::vector<ColumnEntry>& entries() const { return m_entries; }
+
+    size_t chunkCount() const {
+        return static_cast<size_t>((m_header.rowCount + m_header.chunkRows - 1) / m_header.chunkRows);
+    }
+
+    const char* at(uint64_t offset) const { return m_file.data() + offset; }
+
+    std::string name(const ColumnEntry& entry) const {
+        return std::string(at(m_header.namesOffset + entry.nameOffset), entry.nameLength);
+    }
+
+    std::vector<ColumnarFile::ChunkStats> stats(const ColumnEntry& entry) const {
+        std::vector<ColumnarFile::ChunkStats> result;
+        if (entry.statsOffset == 0) return result;
+        result.resize(chunkCount());
+        std::memcpy(result.data(), at(entry.statsOffset), result.size() * sizeof(ColumnarFile::ChunkStats));
+        return result;
+    }
+
+    SortOrder sortedBy() const {
+        std::vector<std::pair<int32_t, SortKey>> keys;
+        for (const auto& entry : m_entries) {
+            if (entry.sortRank >= 0) {
+                keys.push_back({entry.sortRank, SortKey{name(entry), entry.descending == 0}});
+            }
+        }
+        std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        SortOrder order;
+        for (auto& [rank, key] : keys) order.push_back(std::move(key));
+        return order;
+    }
+
+    void verify(const ColumnEntry& entry) const {
+        if (!(m_header.flags & FLAG_CHECKSUMS) || entry.statsOffset == 0) return;
+        auto chunks = stats(entry);
+        size_t rowBytes = elementSize(static_cast<ColumnTypeOpt>(entry.type));
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            uint64_t begin = c * uint64_t{m_header.chunkRows};
+            uint64_t rows = std::min<uint64_t>(m_header.chunkRows, m_header.rowCount - begin);
+            if (checksum(at(entry.dataOffset + begin * rowBytes), rows * rowBytes) != chunks[c].checksum) {
+                throw std::runtime_error("Checksum mismatch in column '" + name(entry) + "': " + m_path);
+            }
+        }
+    }
+
+    void verifyStrings() const {
+        if (!(m_header.flags & FLAG_CHECKSUMS)) return;
+        uint64_t sum = checksum(at(m_header.stringOffsetsOffset), (m_header.stringCount + 1) * sizeof(uint64_t)) ^
+                       checksum(at(m_header.stringBytesOffset), m_header.stringBytes);
+        if (sum != m_header.stringChecksum) {
+            throw std::runtime_error("Checksum mismatch in string pool: " + m_path);
+        }
+    }
+
+private:
+    void check(uint64_t offset, uint64_t bytes) const {
+        if (offset > m_file.size() || bytes > m_file.size() - offset) {
+            throw std::runtime_error("Truncated columnar file: " + m_path);
+        }
+    }
+
+    std::string m_path;
+    MappedFile m_file;
+    FileHeader m_header{};
+    std::vector<ColumnEntry> m_entries;
+};
+
+} // namespace
+
+void ColumnarFile::write(const DataFrame& df, const std::string& path, const WriteOptions& options) {
+    if (options.chunkRows == 0) {
+        throw std::invalid_argument("ColumnarFile chunkRows must be positive");
+    }
+
+    auto names = df.getColumnNames();
+    uint64_t rows = df.rowCount();
+    size_t chunks = static_cast<size_t>((rows + options.chunkRows - 1) / options.chunkRows);
+    bool withStats = options.stats || options.checksums;
+
+    std::unordered_map<std::string, size_t> sortRanks;
+    const auto& sortedBy = df.getSortedBy();
+    for (size_t i = 0; i < sortedBy.size(); ++i) {
+        sortRanks[sortedBy[i].column] = i;
+    }
+
+    // Strings référencées, renumérotées dans l'ordre de leurs IDs : un pool
+    // entièrement utilisé garde ses IDs à la relecture (index du pool réutilisables)
+    std::unordered_map<const StringPool*, std::vector<StringId>> remaps;
+    std::vector<const StringPool*> pools;
+    std::vector<const std::string*> strings;
+    for (const auto& name : names) {
+        auto stringCol = std::dynamic_pointer_cast<StringColumn>(df.getColumn(name));
+        if (!stringCol) continue;
+        const auto& pool = *stringCol->getStringPool();
+        auto [it, inserted] = remaps.try_emplace(&pool, pool.size(), UNUSED);
+        if (inserted) pools.push_back(&pool);
+        for (StringId id : stringCol->data()) it->second[id] = 0;
+    }
+    for (const auto* pool : pools) {
+        auto& remap = remaps[pool];
+        for (StringId id = 0; id < remap.size(); ++id) {
+            if (remap[id] == UNUSED) continue;
+            remap[id] = static_cast<StringId>(strings.size());
+            strings.push_back(&pool->getString(id));
+        }
+    }
+
+    std::vector<IColumnPtr> holders;
+    std::vector<ColumnOut> columns(names.size());
+    std::string namesBlob;
+
+    for (size_t c = 0; c < names.size(); ++c) {
+        auto col = df.getColumn(names[c]);
+        auto& out = columns[c];
+        out.entry.type = static_cast<uint8_t>(col->getType());
+        out.entry.sortRank = -1;
+        if (auto it = sortRanks.find(names[c]); it != sortRanks.end()) {
+            out.entry.sortRank = static_cast<int32_t>(it->second);
+            out.entry.descending = sortedBy[it->second].ascending ? 0 : 1;
+        }
+        out.entry.nameOffset = static_cast<uint32_t>(namesBlob.size());
+        out.entry.nameLength = static_cast<uint32_t>(names[c].size());
+        namesBlob += names[c];
+        out.entry.dataBytes = rows * elementSize(col->getType());
+        if (withStats) out.stats.resize(chunks);
+
+        visitColumn(*col, [&](const auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            const auto& values = typed.data();
+            if constexpr (std::is_same_v<Col, StringColumn>) {
+                const auto& remap = remaps.at(typed.getStringPool().get());
+                out.remapped.resize(values.size());
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out.remapped[i] = remap[values[i]];
+                }
+                out.bytes = reinterpret_cast<const char*>(out.remapped.data());
+            } else {
+                out.bytes = reinterpret_cast<const char*>(values.data());
+                if (options.stats) {
+                    numericStats(std::span(values), options.chunkRows, out.stats);
+                }
+            }
+        });
+        holders.push_back(std::move(col));
+
+        if (options.checksums) {
+            size_t rowBytes = elementSize(static_cast<ColumnTypeOpt>(out.entry.type));
+            for (size_t k = 0; k < chunks; ++k) {
+                uint64_t begin = k * uint64_t{options.chunkRows};
+                uint64_t count = std::min<uint64_t>(options.chunkRows, rows - begin);
+                out.stats[k].checksum = checksum(out.bytes + begin * rowBytes, count * rowBytes);
+            }
+        }
+    }
+
+    // StringPool : offsets puis octets
+    std::vector<uint64_t> stringOffsets(strings.size() + 1, 0);
+    std::string stringBytes;
+    for (size_t i = 0; i < strings.size(); ++i) {
+        stringBytes += *strings[i];
+        stringOffsets[i + 1] = stringBytes.size();
+    }
+
+    // Disposition
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.flags = (options.stats ? FLAG_STATS : 0) | (options.checksums ? FLAG_CHECKSUMS : 0);
+    header.rowCount = rows;
+    header.columnCount = static_cast<uint32_t>(names.size());
+    header.chunkRows = options.chunkRows;
+    header.columnTableOffset = alignUp(sizeof(FileHeader));
+    header.namesOffset = header.columnTableOffset + columns.size() * sizeof(ColumnEntry);
+    header.namesBytes = namesBlob.size();
+    header.stringCount = strings.size();
+    header.stringOffsetsOffset = alignUp(header.namesOffset + header.namesBytes);
+    header.stringBytesOffset = header.stringOffsetsOffset + stringOffsets.size() * sizeof(uint64_t);
+    header.stringBytes = stringBytes.size();
+    if (options.checksums) {
+        header.stringChecksum =
+            checksum(reinterpret_cast<const char*>(stringOffsets.data()), stringOffsets.size() * sizeof(uint64_t)) ^
+            checksum(stringBytes.data(), stringBytes.size());
+    }
+
+    uint64_t offset = header.stringBytesOffset + header.stringBytes;
+    for (auto& out : columns) {
+        if (withStats) {
+            out.entry.statsOffset = alignUp(offset);
+            offset = out.entry.statsOffset + out.stats.size() * sizeof(ChunkStats);
+        }
+        out.entry.dataOffset = alignUp(offset);
+        offset = out.entry.dataOffset + out.entry.dataBytes;
+    }
+
+    // Écriture dans un fichier temporaire, synchronisé puis renommé une fois complet
+    std::string tmpPath = temporaryPath(path);
+    try {
+        FileOut file(tmpPath);
+        file.write(&header, sizeof(header));
+        file.padTo(header.columnTableOffset);
+        for (const auto& out : columns) {
+            file.write(&out.entry, sizeof(ColumnEntry));
+        }
+        file.write(namesBlob.data(), namesBlob.size());
+        file.padTo(header.stringOffsetsOffset);
+        file.write(stringOffsets.data(), stringOffsets.size() * sizeof(uint64_t));
+        file.write(stringBytes.data(), stringBytes.size());
+        for (const auto& out : columns) {
+            if (withStats) {
+                file.padTo(out.entry.statsOffset);
+                file.write(out.stats.data(), out.stats.size() * sizeof(ChunkStats));
+            }
+            file.padTo(out.entry.dataOffset);
+            file.write(out.bytes, out.entry.dataBytes);
+        }
+        file.close();
+    } catch (...) {
+        ::unlink(tmpPath.c_str());
+        throw;
+    }
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        ::unlink(tmpPath.c_str());
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    syncDirectory(path);
+}
+
+std::shared_ptr<DataFrame> ColumnarFile::read(const std::string& path, const ReadOptions& options) {
+    MappedColumnarFile file(path);
+    const auto& header = file.header();
+
+    if (options.verifyChecksums) {
+        file.verifyStrings();
+        for (const auto& entry : file.entries()) {
+            file.verify(entry);
+        }
+    }
+
+    auto df = std::make_shared<DataFrame>();
+
+    // StringPool : IDs du fichier → IDs du pool (identité pour un pool vide)
+    const auto* offsets = reinterpret_cast<const uint64_t*>(file.at(header.stringOffsetsOffset));
+    const char* bytes = file.at(header.stringBytesOffset);
+    std::vector<StringId> remap(header.stringCount);
+    bool identity = true;
+    auto& pool = *df->getStringPool();
+    for (uint64_t i = 0; i < header.stringCount; ++i) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > header.stringBytes) {
+            throw std::runtime_error("Corrupted columnar file: " + path);
+        }
+        remap[i] = pool.intern(std::string(bytes + offsets[i], offsets[i + 1] - offsets[i]));
+        identity = identity && remap[i] == i;
+    }
+
+    // Une copie en bloc par colonne depuis le mapping
+    for (const auto& entry : file.entries()) {
+        auto name = file.name(entry);
+        const char* data = file.at(entry.dataOffset);
+        size_t rows = static_cast<size_t>(header.rowCount);
+
+        switch (static_cast<ColumnTypeOpt>(entry.type)) {
+            case ColumnTypeOpt::INT: {
+                auto col = std::make_shared<IntColumn>(name);
+                col->append(std::span(reinterpret_cast<const int*>(data), rows));
+                df->addColumn(col);
+                break;
+            }
+            case ColumnTypeOpt::DOUBLE: {
+                auto col = std::make_shared<DoubleColumn>(name);
+                col->append(std::span(reinterpret_cast<const double*>(data), rows));
+                df->addColumn(col);
+                break;
+            }
+            case ColumnTypeOpt::STRING: {
+                std::span ids(reinterpret_cast<const StringId*>(data), rows);
+                for (StringId id : ids) {
+                    if (id >= header.stringCount) {
+                        throw std::runtime_error("Corrupted columnar file: " + path);
+                    }
+                }
+                auto col = std::make_shared<StringColumn>(name, df->getStringPool());
+                if (identity) {
+                    col->appendIds(ids);
+                } else {
+                    col->reserve(rows);
+                    for (StringId id : ids) col->push_back(remap[id]);
+                }
+                df->addColumn(col);
+                break;
+            }
+        }
+    }
+
+    auto sortedBy = file.sortedBy();
+    if (!sortedBy.empty()) {
+        df->declareSortedBy(sortedBy);
+    }
+    return df;
+}
+
+ColumnarFile::Info ColumnarFile::inspect(const std::string& path) {
+    MappedColumnarFile file(path);
+    const auto& header = file.header();
+
+    Info info;
+    info.version = header.version;
+    info.rowCount = header.rowCount;
+    info.chunkRows = header.chunkRows;
+    info.stringCount = header.stringCount;
+    info.sortedBy = file.sortedBy();
+    for (const auto& entry : file.entries()) {
+        info.columns.push_back({file.name(entry), static_cast<ColumnTypeOpt>(entry.type), file.stats(entry)});
+    }
+    return info;
+}
+
+} // namespace dataframe
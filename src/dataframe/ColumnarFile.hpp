@@ -0,0 +1,80 @@
+#pragma once
+
+#include "DataFrame.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dataframe {
+
+/**
+ * Format binaire colonnaire compact et versionné (.adf) : persistance d'un
+ * DataFrame relue sans parsing
+ *
+ * Disposition (little-endian, offsets absolus, buffers alignés sur 64 octets) :
+ *   FileHeader   magic "ANODEDF", version, flags, lignes, colonnes,
+ *                emplacement du StringPool et de la table des colonnes
+ *   ColumnEntry  une par colonne : type, rang dans l'ordre de tri déclaré,
+ *                nom, buffer de données, stats par chunk
+ *   Noms         octets des noms de colonnes
+ *   StringPool   offsets uint64[n + 1] puis octets concaténés ; seules les
+ *                strings référencées sont écrites (IDs renumérotés)
+ *   Colonnes     int32, double ou StringId (uint32) contigus
+ *   Stats        par chunk de chunkRows lignes : min, max (colonnes
+ *                numériques) et checksum 64 bits des octets du chunk
+ *
+ * Lecture : fichier projeté (MappedFile), tailles et offsets validés, puis
+ * une copie en bloc par colonne depuis le mapping (pas de parsing). Le
+ * DataFrame chargé possède ses données (std::vector) : le fichier peut être
+ * remplacé ou supprimé ensuite.
+ *
+ * Écriture atomique et durable : fichier temporaire unique par écriture,
+ * fsync, rename() puis fsync du répertoire.
+ * Lève std::runtime_error si le fichier est illisible, tronqué, d'une
+ * version inconnue ou si un checksum ne correspond pas.
+ */
+class ColumnarFile {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr const char* MIME_TYPE = "application/vnd.anode.dataframe";
+
+    struct WriteOptions {
+        uint32_t chunkRows = 65536;
+        bool stats = true;       // min/max par chunk
+        bool checksums = true;   // checksum par chunk et du StringPool
+    };
+
+    struct ReadOptions {
+        bool verifyChecksums = true;
+    };
+
+    struct ChunkStats {
+        double min = 0.0;           // Colonnes numériques uniquement
+        double max = 0.0;
+        uint64_t checksum = 0;
+        uint64_t reserved = 0;
+    };
+
+    struct ColumnInfo {
+        std::string name;
+        ColumnTypeOpt type = ColumnTypeOpt::INT;
+        std::vector<ChunkStats> chunks;  // Vide si écrit sans stats ni checksums
+    };
+
+    // En-tête et stats, sans charger les colonnes
+    struct Info {
+        uint32_t version = 0;
+        uint64_t rowCount = 0;
+        uint32_t chunkRows = 0;
+        uint64_t stringCount = 0;
+        SortOrder sortedBy;
+        std::vector<ColumnInfo> columns;
+    };
+
+    static void write(const DataFrame& df, const std::string& path, const WriteOptions& options);
+    static std::shared_ptr<DataFrame> read(const std::string& path, const ReadOptions& options);
+    static Info inspect(const std::string& path);
+};
+
+} // namespace dataframe
@@ -0,0 +1,667 @@
+#include "CsvReader.hpp"
+#include "MappedFile.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dataframe {
+
+namespace {
+
+using StringId = StringPool::StringId;
+
+// En dessous, le coût des threads dépasse le gain du parsing parallèle
+constexpr size_t MIN_CHUNK_BYTES = size_t{1} << 20;
+
+// Fenêtres d'échantillonnage réparties sur les fichiers de plus d'un chunk
+constexpr size_t SAMPLE_WINDOWS = 16;
+
+// Taille d'une fenêtre d'échantillonnage en lecture par lots
+constexpr size_t SAMPLE_WINDOW_BYTES = size_t{256} << 10;
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+std::string_view trim(std::string_view s) {
+    size_t begin = 0;
+    size_t end = s.size();
+    while (begin < end && isBlank(s[begin])) ++begin;
+    while (end > begin && isBlank(s[end - 1])) --end;
+    return s.substr(begin, end - begin);
+}
+
+const char* findChar(const char* p, const char* end, char c) {
+    auto* hit = static_cast<const char*>(std::memchr(p, c, static_cast<size_t>(end - p)));
+    return hit ? hit : end;
+}
+
+// Premier délimiteur, guillemet ou '\n' de [p, end), 16 octets par itération
+const char* findSpecial(const char* p, const char* end, char delimiter) {
+#if defined(__SSE2__)
+    const __m128i delim = _mm_set1_epi8(delimiter);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    while (end - p >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, delim),
+                                                _mm_cmpeq_epi8(block, quote)),
+                                   _mm_cmpeq_epi8(block, newline));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#endif
+    while (p < end && *p != delimiter && *p != '"' && *p != '\n') {
+        ++p;
+    }
+    return p;
+}
+
+size_t countQuotes(const char* p, const char* end) {
+    size_t count = 0;
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    while (end - p >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        count += static_cast<size_t>(__builtin_popcount(
+            static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, quote)))));
+        p += 16;
+    }
+#endif
+    for (; p < end; ++p) {
+        count += (*p == '"');
+    }
+    return count;
+}
+
+// Début du premier enregistrement après p : premier '\n' hors guillemets
+const char* nextRecordStart(const char* p, const char* end, bool inQuotes) {
+    while (p < end) {
+        if (inQuotes) {
+            p = findChar(p, end, '"');
+            if (p == end) return end;
+            ++p;
+            inQuotes = false;
+        } else {
+            const char* newline = findChar(p, end, '\n');
+            const char* quote = findChar(p, newline, '"');
+            if (quote == newline) {
+                return newline == end ? end : newline + 1;
+            }
+            p = quote + 1;
+            inQuotes = true;
+        }
+    }
+    return end;
+}
+
+/**
+ * Découpe d'un enregistrement en champs (vues trimées)
+ * Les champs sans guillemet pointent dans le buffer source ; les champs
+ * quotés sont déséchappés dans des buffers internes, valides jusqu'au
+ * prochain appel.
+ */
+class RecordParser {
+public:
+    explicit RecordParser(char delimiter) : m_delimiter(delimiter) {}
+
+    // Parse l'enregistrement commençant en p, renvoie le début du suivant
+    const char* parse(const char* p, const char* end, std::vector<std::string_view>& fields) {
+        fields.clear();
+        size_t quoted = 0;
+
+        while (true) {
+            const char* hit = findSpecial(p, end, m_delimiter);
+            if (hit < end && *hit == '"') {
+                if (m_buffers.size() <= quoted) {
+                    m_buffers.emplace_back();
+                }
+                std::string& buffer = m_buffers[quoted++];
+                hit = parseQuoted(p, end, buffer);
+                fields.push_back(trim(buffer));
+            } else {
+                fields.push_back(trim(std::string_view(p, static_cast<size_t>(hit - p))));
+            }
+
+            if (hit >= end) return end;
+            if (*hit == '\n') return hit + 1;
+            p = hit + 1;
+        }
+    }
+
+private:
+    // Champ contenant des guillemets ("" = guillemet littéral dans un champ quoté)
+    // Renvoie la position du délimiteur, du '\n' ou de la fin qui le termine
+    const char* parseQuoted(const char* p, const char* end, std::string& buffer) {
+        buffer.clear();
+        bool inQuotes = false;
+
+        while (p < end) {
+            if (inQuotes) {
+                const char* quote = findChar(p, end, '"');
+                buffer.append(p, quote);
+                if (quote == end) return end;
+                if (quote + 1 < end && quote[1] == '"') {
+                    buffer.push_back('"');
+                    p = quote + 2;
+                } else {
+                    inQuotes = false;
+                    p = quote + 1;
+                }
+            } else {
+                const char* hit = findSpecial(p, end, m_delimiter);
+                buffer.append(p, hit);
+                if (hit == end || *hit != '"') return hit;
+                inQuotes = true;
+                p = hit + 1;
+            }
+        }
+        return end;
+    }
+
+    char m_delimiter;
+    std::deque<std::string> m_buffers;  // deque : références stables
+};
+
+// Saute les lignes vides avant un enregistrement. Seuls '\r' et '\n' sont
+// sautés : un blanc ou un délimiteur (tabulation en TSV) ouvre le premier champ.
+const char* skipEmptyLines(const char* p, const char* end) {
+    while (p < end && (*p == '\r' || *p == '\n')) ++p;
+    return p;
+}
+
+// Entier 32 bits ("+" accepté) ; false si invalide, incomplet ou hors plage
+bool parseInt(std::string_view s, int& value) {
+    if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+    return ec == std::errc() && ptr == s.data() + s.size();
+}
+
+// Décimal ("1.5", "1,5", "2e3", "+.5") ; false si invalide, incomplet ou hors
+// plage. "inf" et "nan" sont refusés : ce sont des chaînes dans un CSV.
+bool parseDouble(std::string_view s, double& value) {
+    if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+    size_t first = (!s.empty() && s.front() == '-') ? 1 : 0;
+    if (first >= s.size() || (s[first] != '.' && !std::isdigit(static_cast<unsigned char>(s[first])))) {
+        return false;
+    }
+
+    const char* end = s.data() + s.size();
+    auto [ptr, ec] = std::from_chars(s.data(), end, value);
+    if (ec == std::errc() && ptr == end) return true;
+
+    // Virgule décimale : reparse avec un point
+    if (ptr == end || *ptr != ',' || s.size() > 64) return false;
+    char buffer[64];
+    std::memcpy(buffer, s.data(), s.size());
+    buffer[ptr - s.data()] = '.';
+    auto [bufferPtr, bufferEc] = std::from_chars(buffer, buffer + s.size(), value);
+    return bufferEc == std::errc() && bufferPtr == buffer + s.size();
+}
+
+// Type le plus étroit d'une valeur trimée non vide
+ColumnTypeOpt valueType(std::string_view value) {
+    int intValue = 0;
+    if (parseInt(value, intValue)) return ColumnTypeOpt::INT;
+    double doubleValue = 0.0;
+    if (parseDouble(value, doubleValue)) return ColumnTypeOpt::DOUBLE;
+    return ColumnTypeOpt::STRING;
+}
+
+/**
+ * Dictionnaire local à un thread : string → ID local, dans l'ordre
+ * de première apparition (fusionné ensuite dans le StringPool)
+ */
+class LocalDictionary {
+public:
+    StringId intern(std::string_view str) {
+        auto it = m_ids.find(str);
+        if (it != m_ids.end()) {
+            return it->second;
+        }
+        auto id = static_cast<StringId>(m_strings.size());
+        auto inserted = m_ids.emplace(std::string(str), id).first;
+        m_strings.push_back(&inserted->first);
+        return id;
+    }
+
+    size_t size() const { return m_strings.size(); }
+    const std::string& string(StringId id) const { return *m_strings[id]; }
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
+    std::unordered_map<std::string, StringId, Hash, std::equal_to<>> m_ids;
+    std::vector<const std::string*> m_strings;  // nœuds de la map : adresses stables
+};
+
+// Valeurs d'une colonne pour un chunk (seul le vecteur du type est utilisé)
+struct ColumnChunk {
+    std::vector<int> ints;
+    std::vector<double> doubles;
+    std::vector<StringId> ids;
+    LocalDictionary dictionary;
+    // Type le plus large exigé par les valeurs non conformes au type parsé
+    ColumnTypeOpt required = ColumnTypeOpt::INT;
+};
+
+// Parse au plus maxRecords enregistrements, renvoie le début du suivant
+const char* parseChunk(
+    const char* p,
+    const char* end,
+    char delimiter,
+    const std::vector<ColumnTypeOpt>& types,
+    size_t expectedRows,
+    std::vector<ColumnChunk>& columns,
+    size_t maxRecords = std::numeric_limits<size_t>::max()
+) {
+    columns.clear();
+    columns.resize(types.size());
+    for (size_t c = 0; c < types.size(); ++c) {
+        switch (types[c]) {
+            case ColumnTypeOpt::INT: columns[c].ints.reserve(expectedRows); break;
+            case ColumnTypeOpt::DOUBLE: columns[c].doubles.reserve(expectedRows); break;
+            case ColumnTypeOpt::STRING: columns[c].ids.reserve(expectedRows); break;
+        }
+    }
+
+    RecordParser parser(delimiter);
+    std::vector<std::string_view> fields;
+
+    for (size_t record = 0; record < maxRecords && (p = skipEmptyLines(p, end)) < end; ++record) {
+        p = parser.parse(p, end, fields);
+
+        for (size_t c = 0; c < types.size(); ++c) {
+            std::string_view value = c < fields.size() ? fields[c] : std::string_view{};
+            auto& column = columns[c];
+            switch (types[c]) {
+                case ColumnTypeOpt::INT: {
+                    int number = 0;
+                    if (!parseInt(value, number)) {
+                        number = 0;
+                        if (!value.empty()) {
+                            column.required = std::max(column.required, valueType(value));
+                        }
+                    }
+                    column.ints.push_back(number);
+                    break;
+                }
+                case ColumnTypeOpt::DOUBLE: {
+                    double number = 0.0;
+                    if (!parseDouble(value, number)) {
+                        number = 0.0;
+                        if (!value.empty()) {
+                            column.required = std::max(column.required, valueType(value));
+                        }
+                    }
+                    column.doubles.push_back(number);
+                    break;
+                }
+                case ColumnTypeOpt::STRING:
+                    column.ids.push_back(column.dictionary.intern(value));
+                    break;
+            }
+        }
+    }
+    return p;
+}
+
+// En-tête (ou noms "colN" sans en-tête) et fin du premier enregistrement
+// Renvoie le début des données, end s'il n'y en a pas
+const char* readHeader(
+    RecordParser& parser,
+    const char* p,
+    const char* end,
+    bool hasHeader,
+    std::vector<std::string>& headers,
+    const char*& firstRecordEnd
+) {
+    std::vector<std::string_view> fields;
+    if (hasHeader) {
+        p = skipEmptyLines(p, end);
+        if (p >= end) return end;
+        p = parser.parse(p, end, fields);
+        headers.assign(fields.begin(), fields.end());
+    }
+
+    const char* dataStart = skipEmptyLines(p, end);
+    if (dataStart >= end) return end;
+    firstRecordEnd = parser.parse(dataStart, end, fields);
+
+    if (!hasHeader) {
+        for (size_t i = 0; i < fields.size(); ++i) {
+            headers.push_back("col" + std::to_string(i));
+        }
+    }
+    return dataStart;
+}
+
+// Échantillonne au plus maxRecords enregistrements de [p, end) :
+// chaque valeur non vide promeut le type de sa colonne
+void sampleTypes(
+    RecordParser& parser,
+    const char* p,
+    const char* end,
+    size_t maxRecords,
+    std::vector<std::optional<ColumnTypeOpt>>& inferred
+) {
+    std::vector<std::string_view> fields;
+    for (size_t record = 0; record < maxRecords && (p = skipEmptyLines(p, end)) < end; ++record) {
+        p = parser.parse(p, end, fields);
+        for (size_t c = 0; c < inferred.size() && c < fields.size(); ++c) {
+            if (fields[c].empty() || inferred[c] == ColumnTypeOpt::STRING) continue;
+            ColumnTypeOpt type = valueType(fields[c]);
+            inferred[c] = inferred[c] ? std::max(*inferred[c], type) : type;
+        }
+    }
+}
+
+// Types finaux : schéma imposé, sinon inféré (colonne sans valeur → STRING)
+// fixed[c] : type imposé, jamais promu
+void resolveTypes(
+    const std::vector<std::string>& headers,
+    const std::vector<std::optional<ColumnTypeOpt>>& inferred,
+    const CsvReader::Schema& schema,
+    std::vector<ColumnTypeOpt>& types,
+    std::vector<bool>& fixed
+) {
+    for (const auto& [name, type] : schema) {
+        if (std::find(headers.begin(), headers.end(), name) == headers.end()) {
+            throw std::runtime_error("Unknown column in CSV schema: " + name);
+        }
+    }
+
+    types.clear();
+    fixed.clear();
+    for (size_t i = 0; i < headers.size(); ++i) {
+        auto it = schema.find(headers[i]);
+        fixed.push_back(it != schema.end());
+        types.push_back(fixed.back() ? it->second : inferred[i].value_or(ColumnTypeOpt::STRING));
+    }
+}
+
+void addColumns(DataFrame& df, const std::vector<std::string>& headers,
+                const std::vector<ColumnTypeOpt>& types) {
+    for (size_t i = 0; i < headers.size(); ++i) {
+        if (types[i] == ColumnTypeOpt::INT) {
+            df.addIntColumn(headers[i]);
+        } else if (types[i] == ColumnTypeOpt::DOUBLE) {
+            df.addDoubleColumn(headers[i]);
+        } else {
+            df.addStringColumn(headers[i]);
+        }
+    }
+}
+
+// Ajoute les chunks dans l'ordre : IDs locaux remappés vers le pool du DataFrame
+void appendChunks(DataFrame& df, const std::vector<std::string>& headers,
+                  std::vector<std::vector<ColumnChunk>>& chunks) {
+    for (size_t c = 0; c < headers.size(); ++c) {
+        auto col = df.getColumn(headers[c]);
+
+        size_t total = col->size();
+        for (const auto& chunk : chunks) {
+            const auto& part = chunk[c];
+            total += part.ints.size() + part.doubles.size() + part.ids.size();
+        }
+        col->reserve(total);
+
+        visitColumn(*col, [&](auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            for (auto& chunk : chunks) {
+                auto& part = chunk[c];
+                if constexpr (std::is_same_v<Col, IntColumn>) {
+                    typed.append(part.ints);
+                    std::vector<int>().swap(part.ints);
+                } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                    typed.append(part.doubles);
+                    std::vector<double>().swap(part.doubles);
+                } else {
+                    auto& pool = *typed.getStringPool();
+                    std::vector<StringId> remap(part.dictionary.size());
+                    for (size_t id = 0; id < remap.size(); ++id) {
+                        remap[id] = pool.intern(part.dictionary.string(static_cast<StringId>(id)));
+                    }
+                    for (auto& id : part.ids) {
+                        id = remap[id];
+                    }
+                    typed.appendIds(part.ids);
+                    std::vector<StringId>().swap(part.ids);
+                }
+            }
+        });
+    }
+}
+
+} // namespace
+
+std::shared_ptr<DataFrame> CsvReader::read(const std::string& filepath, const Options& options) {
+    MappedFile file(filepath);
+    return parse(file.view(), options);
+}
+
+std::shared_ptr<DataFrame> CsvReader::parse(std::string_view data, const Options& options) {
+    auto df = std::make_shared<DataFrame>();
+    const char* p = data.data();
+    const char* end = data.data() + data.size();
+
+    RecordParser parser(options.delimiter);
+    std::vector<std::string> headers;
+    const char* firstRecordEnd = nullptr;
+    const char* dataStart = readHeader(parser, p, end, options.hasHeader, headers, firstRecordEnd);
+    if (dataStart >= end) {
+        return df;  // Pas de données : types inconnus, pas de colonnes
+    }
+
+    // Grille de découpage aux frontières d'enregistrement : un chunk de
+    // parsing par thread, au moins SAMPLE_WINDOWS fenêtres d'échantillonnage
+    size_t bytes = static_cast<size_t>(end - dataStart);
+    size_t threads = std::clamp<size_t>(bytes / MIN_CHUNK_BYTES, 1, resolveThreads(options.threads));
+    size_t perChunk = bytes > MIN_CHUNK_BYTES ? (SAMPLE_WINDOWS + threads - 1) / threads : 1;
+    size_t segments = threads * perChunk;
+
+    std::vector<const char*> bounds{dataStart};
+    if (segments > 1) {
+        std::vector<const char*> nominal(segments + 1);
+        for (size_t k = 0; k <= segments; ++k) {
+            nominal[k] = dataStart + bytes * k / segments;
+        }
+
+        // Parité des guillemets avant chaque coupure : dans un champ quoté ?
+        std::vector<size_t> quotes(segments);
+        runParallel(threads, [&](size_t k) {
+            for (size_t s = k * perChunk; s < (k + 1) * perChunk; ++s) {
+                quotes[s] = countQuotes(nominal[s], nominal[s + 1]);
+            }
+        });
+
+        size_t quotesBefore = 0;
+        for (size_t k = 1; k < segments; ++k) {
+            quotesBefore += quotes[k - 1];
+            const char* bound = nextRecordStart(nominal[k], end, quotesBefore % 2 == 1);
+            bounds.push_back(std::max(bound, bounds.back()));
+        }
+    }
+    bounds.push_back(end);
+
+    // Inférence sur des fenêtres réparties sur tout le fichier
+    std::vector<std::optional<ColumnTypeOpt>> inferred(headers.size());
+    size_t perWindow = std::max<size_t>(1, options.sampleRows / segments);
+    for (size_t w = 0; w < segments; ++w) {
+        sampleTypes(parser, bounds[w], bounds[w + 1], perWindow, inferred);
+    }
+
+    std::vector<ColumnTypeOpt> types;
+    std::vector<bool> fixed;
+    resolveTypes(headers, inferred, options.schema, types, fixed);
+
+    // Parsing parallèle ; une valeur non conforme (hors échantillon) promeut
+    // sa colonne et le fichier est reparsé avec les types corrigés
+    size_t recordBytes = std::max<size_t>(1, static_cast<size_t>(firstRecordEnd - dataStart));
+    std::vector<std::vector<ColumnChunk>> chunks(threads);
+    while (true) {
+        runParallel(threads, [&](size_t k) {
+            const char* chunkBegin = bounds[k * perChunk];
+            const char* chunkEnd = bounds[(k + 1) * perChunk];
+            size_t chunkBytes = static_cast<size_t>(chunkEnd - chunkBegin);
+            parseChunk(chunkBegin, chunkEnd, options.delimiter, types,
+                       chunkBytes / recordBytes + 1, chunks[k]);
+        });
+
+        bool promoted = false;
+        for (size_t c = 0; c < types.size(); ++c) {
+            if (fixed[c]) continue;
+            for (const auto& chunk : chunks) {
+                if (chunk[c].required > types[c]) {
+                    types[c] = chunk[c].required;
+                    promoted = true;
+                }
+            }
+        }
+        if (!promoted) break;
+    }
+
+    addColumns(*df, headers, types);
+    df->getStringPool()->reserve(10000);
+    appendChunks(*df, headers, chunks);
+
+    return df;
+}
+
+// ============================================================================
+// Lecture par lots
+// ============================================================================
+
+CsvBatchReader::CsvBatchReader(const std::string& filepath, const Options& options)
+    : m_file(filepath)
+    , m_options(options)
+    , m_pool(std::make_shared<StringPool>()) {
+    m_options.batchRows = std::max<size_t>(1, m_options.batchRows);
+    m_end = m_file.data() + m_file.size();
+
+    RecordParser parser(options.delimiter);
+    const char* firstRecordEnd = nullptr;
+    m_pos = readHeader(parser, m_file.data(), m_end, options.hasHeader, m_headers, firstRecordEnd);
+
+    std::vector<std::optional<ColumnTypeOpt>> inferred(m_headers.size());
+    if (m_pos < m_end) {
+        size_t bytes = static_cast<size_t>(m_end - m_pos);
+        size_t windows = bytes > MIN_CHUNK_BYTES ? SAMPLE_WINDOWS : 1;
+        size_t perWindow = std::max<size_t>(1, options.sampleRows / windows);
+
+        // Première fenêtre : début des données, hors guillemets par construction
+        sampleTypes(parser, m_pos, m_end, perWindow, inferred);
+
+        // Autres fenêtres : sans guillemet, une coupure ne peut pas tomber
+        // dans un champ quoté (sauf champ plus long que la fenêtre)
+        for (size_t w = 1; w < windows; ++w) {
+            const char* windowBegin = m_pos + bytes * w / windows;
+            const char* windowEnd = std::min(m_end, windowBegin + SAMPLE_WINDOW_BYTES);
+            if (findChar(windowBegin, windowEnd, '"') != windowEnd) continue;
+
+            const char* newline = findChar(windowBegin, windowEnd, '\n');
+            if (newline == windowEnd) continue;
+            const char* recordsBegin = newline + 1;
+            const char* recordsEnd = windowEnd;
+            while (recordsEnd > recordsBegin && recordsEnd[-1] != '\n') --recordsEnd;
+
+            sampleTypes(parser, recordsBegin, recordsEnd, perWindow, inferred);
+        }
+    }
+
+    resolveTypes(m_headers, inferred, options.schema, m_types, m_fixed);
+}
+
+std::shared_ptr<DataFrame> CsvBatchReader::emptyFrame() const {
+    auto df = std::make_shared<DataFrame>();
+    df->setStringPool(m_pool);
+    addColumns(*df, m_headers, m_types);
+    return df;
+}
+
+std::shared_ptr<DataFrame> CsvBatchReader::next() {
+    m_pos = skipEmptyLines(m_pos, m_end);
+    if (m_pos >= m_end) {
+        return nullptr;
+    }
+
+    std::vector<std::vector<ColumnChunk>> chunks(1);
+    const char* stop = parseChunk(m_pos, m_end, m_options.delimiter, m_types,
+                                  m_options.batchRows, chunks[0], m_options.batchRows);
+
+    for (size_t c = 0; c < m_types.size(); ++c) {
+        if (!m_fixed[c] && chunks[0][c].required > m_types[c]) {
+            throw std::runtime_error(
+                "CSV column '" + m_headers[c] + "' has a value that does not fit the type "
+                "inferred from the sample (batch starting at row " + std::to_string(m_rowsRead) +
+                "); declare the column type in the schema");
+        }
+    }
+
+    auto df = emptyFrame();
+    appendChunks(*df, m_headers, chunks);
+
+    m_rowsRead += df->rowCount();
+    m_pos = stop;
+    m_file.releaseBefore(static_cast<size_t>(m_pos - m_file.data()));
+    return df;
+}
+
+ColumnTypeOpt CsvReader::detectType(std::string_view value) {
+    std::string_view trimmed = trim(value);
+    return trimmed.empty() ? ColumnTypeOpt::STRING : valueType(trimmed);
+}
+
+CsvReader::Schema CsvReader::parseSchema(const std::string& spec) {
+    Schema schema;
+    std::istringstream stream(spec);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        std::string_view entry = trim(item);
+        if (entry.empty()) continue;
+
+        auto colon = entry.rfind(':');
+        if (colon == std::string_view::npos) {
+            throw std::runtime_error("Invalid CSV schema entry (expected column:type): " + std::string(entry));
+        }
+        std::string name(trim(entry.substr(0, colon)));
+        std::string typeStr(trim(entry.substr(colon + 1)));
+        std::transform(typeStr.begin(), typeStr.end(), typeStr.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+
+        if (typeStr == "int") {
+            schema[name] = ColumnTypeOpt::INT;
+        } else if (typeStr == "double" || typeStr == "float") {
+            schema[name] = ColumnTypeOpt::DOUBLE;
+        } else if (typeStr == "string" || typeStr == "str" || typeStr == "text") {
+            schema[name] = ColumnTypeOpt::STRING;
+        } else {
+            throw std::runtime_error("Unknown CSV column type: " + typeStr);
+        }
+    }
+    return schema;
+}
+
+} // namespace dataframe
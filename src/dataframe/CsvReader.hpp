@@ -0,0 +1,119 @@
+#pragma once
+
+#include "DataFrame.hpp"
+#include "MappedFile.hpp"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace dataframe {
+
+/**
+ * Lecteur CSV rapide : fichier projeté en mémoire, parsing parallèle
+ *
+ * 1. mmap du fichier (MappedFile), aucune copie ligne par ligne
+ * 2. Recherche des délimiteurs, guillemets et fins de ligne par blocs SSE2
+ * 3. Découpage en chunks aux frontières d'enregistrement sûres : la parité
+ *    des guillemets avant chaque coupure indique si elle tombe dans un
+ *    champ quoté (les retours à la ligne quotés restent dans le champ)
+ * 4. Un thread par chunk : nombres parsés avec std::from_chars, strings
+ *    dans un dictionnaire local au thread
+ * 5. Fusion dans l'ordre des chunks : dictionnaires internés dans le
+ *    StringPool du DataFrame, IDs remappés, colonnes ajoutées en bloc
+ *
+ * Inférence du schéma : sampleRows enregistrements échantillonnés dans des
+ * fenêtres réparties sur tout le fichier, chaque valeur promeut le type de
+ * sa colonne (int → double → string ; valeurs vides ignorées). Les entiers
+ * hors de la plage int 32 bits promeuvent en double (pas de colonne int64).
+ * Filet de sécurité : une valeur non conforme rencontrée au parsing complet
+ * promeut la colonne et le fichier est reparsé une fois.
+ *
+ * Schéma imposé (Options::schema) : type fixé sans inférence ni promotion,
+ * valeur invalide → 0. Champs trimés, lignes vides ignorées, champ
+ * manquant → 0 ou "".
+ */
+class CsvReader {
+public:
+    // Type imposé par nom de colonne
+    using Schema = std::unordered_map<std::string, ColumnTypeOpt>;
+
+    struct Options {
+        char delimiter = ',';
+        bool hasHeader = true;
+        size_t threads = 0;         // 0 : std::thread::hardware_concurrency()
+        size_t sampleRows = 10000;  // Enregistrements échantillonnés pour l'inférence
+        Schema schema;              // Colonnes absentes : type inféré
+    };
+
+    // Lève std::runtime_error si le fichier ne peut pas être ouvert
+    static std::shared_ptr<DataFrame> read(const std::string& filepath, const Options& options);
+
+    // Parse un CSV déjà en mémoire
+    static std::shared_ptr<DataFrame> parse(std::string_view data, const Options& options);
+
+    // Type d'une valeur : INT (32 bits), DOUBLE ("1.5", "1,5", "2e3", entier
+    // hors plage) ou STRING
+    static ColumnTypeOpt detectType(std::string_view value);
+
+    /**
+     * Parse une spécification de schéma : "id:int, amount:double, code:string"
+     * Types acceptés : int, double (float), string (str, text)
+     * Lève std::runtime_error si le format ou le type est invalide
+     */
+    static Schema parseSchema(const std::string& spec);
+};
+
+/**
+ * Lecture en flux d'un CSV par lots de batchRows lignes, mémoire bornée
+ *
+ * - Schéma fixé à l'ouverture : échantillon réparti sur le fichier (fenêtres
+ *   sans guillemet, la parité n'y étant pas connue sans tout relire) puis
+ *   Options::schema. Une valeur qui ne tient pas dans le type de sa colonne
+ *   lève std::runtime_error : les lots déjà produits ne peuvent plus être
+ *   promus, il faut alors imposer le type dans le schéma.
+ * - Tous les lots partagent le StringPool du lecteur : les IDs restent
+ *   comparables d'un lot à l'autre, le pool ne croît qu'avec les valeurs
+ *   distinctes.
+ * - Les pages déjà parsées sont rendues au noyau (MappedFile::releaseBefore) :
+ *   la mémoire résidente ne dépend pas de la taille du fichier.
+ */
+class CsvBatchReader {
+public:
+    struct Options {
+        char delimiter = ',';
+        bool hasHeader = true;
+        size_t batchRows = 65536;
+        size_t sampleRows = 10000;
+        CsvReader::Schema schema;
+    };
+
+    // Lève std::runtime_error si le fichier ne peut pas être ouvert
+    CsvBatchReader(const std::string& filepath, const Options& options);
+
+    const std::vector<std::string>& getColumnNames() const { return m_headers; }
+    const std::vector<ColumnTypeOpt>& getColumnTypes() const { return m_types; }
+    std::shared_ptr<StringPool> getStringPool() const { return m_pool; }
+
+    // Lot suivant (au plus batchRows lignes), nullptr en fin de fichier
+    std::shared_ptr<DataFrame> next();
+
+    // DataFrame vide avec les colonnes du fichier et le pool partagé
+    std::shared_ptr<DataFrame> emptyFrame() const;
+
+    size_t rowsRead() const { return m_rowsRead; }
+
+private:
+    MappedFile m_file;
+    Options m_options;
+    std::vector<std::string> m_headers;
+    std::vector<ColumnTypeOpt> m_types;
+    std::vector<bool> m_fixed;
+    std::shared_ptr<StringPool> m_pool;
+    const char* m_pos = nullptr;
+    const char* m_end = nullptr;
+    size_t m_rowsRead = 0;
+};
+
+} // namespace dataframe
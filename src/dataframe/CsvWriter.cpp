@@ -0,0 +1,191 @@
+#include "CsvWriter.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+#include <vector>
+
+namespace dataframe {
+
+namespace {
+
+using StringId = StringPool::StringId;
+
+// Lignes par bloc : assez pour amortir un write(), assez peu pour borner la mémoire
+constexpr size_t BLOCK_ROWS = 16384;
+
+// Données typées d'une colonne, résolues une fois pour tout l'export
+struct ColumnData {
+    ColumnTypeOpt type = ColumnTypeOpt::STRING;
+    const int* ints = nullptr;
+    const double* doubles = nullptr;
+    const StringId* ids = nullptr;
+    const StringPool* pool = nullptr;
+};
+
+bool needsQuoting(std::string_view value, char delimiter) {
+    for (char c : value) {
+        if (c == delimiter || c == '"' || c == '\n' || c == '\r') return true;
+    }
+    return false;
+}
+
+// Champ texte RFC 4180 : quoté si nécessaire, guillemets doublés
+void appendField(std::string& out, std::string_view value, char delimiter) {
+    if (!needsQuoting(value, delimiter)) {
+        out.append(value);
+        return;
+    }
+    out.push_back('"');
+    for (char c : value) {
+        if (c == '"') out.push_back('"');
+        out.push_back(c);
+    }
+    out.push_back('"');
+}
+
+void appendInt(std::string& out, int value) {
+    char buffer[16];
+    auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, ptr);
+}
+
+// Représentation la plus courte qui se relit à l'identique
+void appendDouble(std::string& out, double value) {
+    char buffer[32];
+    auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, ptr);
+
+    // "3" serait relu comme INT : "3.0" garde le type DOUBLE
+    size_t length = static_cast<size_t>(ptr - buffer);
+    if (std::isfinite(value) && !std::memchr(buffer, '.', length) && !std::memchr(buffer, 'e', length)) {
+        out.append(".0");
+    }
+}
+
+void encodeBlock(
+    const std::vector<ColumnData>& columns,
+    size_t begin,
+    size_t end,
+    char delimiter,
+    std::string& out
+) {
+    out.clear();
+    for (size_t i = begin; i < end; ++i) {
+        for (size_t c = 0; c < columns.size(); ++c) {
+            if (c > 0) out.push_back(delimiter);
+            const auto& column = columns[c];
+            switch (column.type) {
+                case ColumnTypeOpt::INT:
+                    appendInt(out, column.ints[i]);
+                    break;
+                case ColumnTypeOpt::DOUBLE:
+                    appendDouble(out, column.doubles[i]);
+                    break;
+                case ColumnTypeOpt::STRING:
+                    appendField(out, column.pool->getString(column.ids[i]), delimiter);
+                    break;
+            }
+        }
+        out.push_back('\n');
+    }
+}
+
+// write() complet : reprend après une écriture partielle ou EINTR
+void writeAll(int fd, std::string_view data, const std::string& filepath) {
+    while (!data.empty()) {
+        ssize_t written = ::write(fd, data.data(), data.size());
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Cannot write file: " + filepath);
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+}
+
+} // namespace
+
+void CsvWriter::encode(const DataFrame& df, const Options& options, const Sink& sink) {
+    auto columnNames = df.getColumnNames();
+
+    if (options.includeHeader) {
+        std::string header;
+        for (size_t c = 0; c < columnNames.size(); ++c) {
+            if (c > 0) header.push_back(options.delimiter);
+            appendField(header, columnNames[c], options.delimiter);
+        }
+        header.push_back('\n');
+        sink(header);
+    }
+
+    // Colonnes résolues une fois ; les IColumnPtr gardent les données en vie
+    std::vector<IColumnPtr> holders;
+    std::vector<ColumnData> columns;
+    for (const auto& name : columnNames) {
+        auto col = df.getColumn(name);
+        ColumnData data;
+        data.type = col->getType();
+        visitColumn(*col, [&](const auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            if constexpr (std::is_same_v<Col, IntColumn>) {
+                data.ints = typed.data().data();
+            } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                data.doubles = typed.data().data();
+            } else {
+                data.ids = typed.data().data();
+                data.pool = typed.getStringPool().get();
+            }
+        });
+        holders.push_back(std::move(col));
+        columns.push_back(data);
+    }
+
+    // Vagues d'un bloc par thread, écrites dans l'ordre
+    size_t rows = df.rowCount();
+    size_t blocks = (rows + BLOCK_ROWS - 1) / BLOCK_ROWS;
+    size_t threads = std::clamp<size_t>(blocks, 1, resolveThreads(options.threads));
+    std::vector<std::string> buffers(threads);
+
+    for (size_t first = 0; first < blocks; first += threads) {
+        size_t wave = std::min(threads, blocks - first);
+        runParallel(wave, [&](size_t k) {
+            size_t block = first + k;
+            encodeBlock(columns, block * BLOCK_ROWS, std::min(rows, (block + 1) * BLOCK_ROWS),
+                        options.delimiter, buffers[k]);
+        });
+        for (size_t k = 0; k < wave; ++k) {
+            sink(buffers[k]);
+        }
+    }
+}
+
+void CsvWriter::write(const DataFrame& df, const std::string& filepath, const Options& options) {
+    int fd = ::open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot create file: " + filepath);
+    }
+
+    try {
+        encode(df, options, [&](std::string_view block) { writeAll(fd, block, filepath); });
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    if (::close(fd) != 0) {
+        throw std::runtime_error("Cannot write file: " + filepath);
+    }
+}
+
+std::string CsvWriter::toString(const DataFrame& df, const Options& options) {
+    std::string csv;
+    encode(df, options, [&csv](std::string_view block) { csv.append(block); });
+    return csv;
+}
+
+} // namespace dataframe
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "DataFrame.hpp"
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace dataframe {
+
+/**
+ * Écriture CSV rapide : blocs de lignes encodés en parallèle
+ *
+ * 1. Colonnes résolues une fois (pointeurs vers les données typées)
+ * 2. Lignes découpées en blocs de BLOCK_ROWS, encodés par vagues d'un bloc
+ *    par thread dans des buffers : std::to_chars pour les nombres (doubles
+ *    au plus court aller-retour, ".0" ajouté aux doubles entiers pour que le
+ *    type survive à la relecture), quoting RFC 4180 des strings
+ * 3. Blocs écrits dans l'ordre, un seul write() par bloc
+ *
+ * Mémoire bornée : seuls les buffers de la vague en cours existent.
+ * Strings quotées si elles contiennent le délimiteur, un guillemet ou un
+ * retour à la ligne ; les guillemets sont doublés. Fins de ligne "\n".
+ */
+class CsvWriter {
+public:
+    struct Options {
+        char delimiter = ',';
+        bool includeHeader = true;
+        size_t threads = 0;  // 0 : std::thread::hardware_concurrency()
+    };
+
+    // Reçoit les blocs encodés, dans l'ordre
+    using Sink = std::function<void(std::string_view)>;
+
+    // Lève std::runtime_error si le fichier ne peut pas être créé ou écrit
+    static void write(const DataFrame& df, const std::string& filepath, const Options& options);
+
+    // CSV complet en mémoire
+    static std::string toString(const DataFrame& df, const Options& options);
+
+    // Encode le DataFrame bloc par bloc vers sink
+    static void encode(const DataFrame& df, const Options& options, const Sink& sink);
+};
+
+} // namespace dataframe
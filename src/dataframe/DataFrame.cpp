@@ -4,6 +4,7 @@
 #include "DataFrameAggregator.hpp"
 #include "DataFrameSerializer.hpp"
 #include "DataFrameJoiner.hpp"
+#include <algorithm>
 
 namespace dataframe {
 
@@ -35,6 +36,11 @@ void DataFrame::setColumn(IColumnPtr column) {
     if (it != m_columns.end()) {
         // Replace existing column
         it->second = column;
+
+        // Les clefs de tri à partir de cette colonne ne sont plus garanties
+        auto keyIt = std::find_if(m_sortedBy.begin(), m_sortedBy.end(),
+            [&name](const SortKey& key) { return key.column == name; });
+        m_sortedBy.erase(keyIt, m_sortedBy.end());
     } else {
         // Add new column
         m_columns[name] = column;
@@ -62,17 +68,19 @@ void DataFrame::addRow(const std::vector<std::string>& values) {
         throw std::invalid_argument("Row size mismatch");
     }
 
+    m_sortedBy.clear();
+
     for (size_t i = 0; i < values.size(); ++i) {
-        const auto& colName = m_columnOrder[i];
-        auto col = m_columns[colName];
-
-        if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-            intCol->push_back(std::stoi(values[i]));
-        } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-            doubleCol->push_back(std::stod(values[i]));
-        } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-            stringCol->push_back(values[i]);
-        }
+        visitColumn(*m_columns.at(m_columnOrder[i]), [&](auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            if constexpr (std::is_same_v<Col, IntColumn>) {
+                typed.push_back(std::stoi(values[i]));
+            } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                typed.push_back(std::stod(values[i]));
+            } else {
+                typed.push_back(values[i]);
+            }
+        });
     }
 }
 
@@ -105,13 +113,48 @@ bool DataFrame::empty() const {
     return m_columns.empty() || rowCount() == 0;
 }
 
+size_t DataFrame::memoryUsage() const {
+    size_t total = 0;
+    for (const auto& [name, column] : m_columns) {
+        switch (column->getType()) {
+            case ColumnTypeOpt::INT: total += column->size() * sizeof(int); break;
+            case ColumnTypeOpt::DOUBLE: total += column->size() * sizeof(double); break;
+            case ColumnTypeOpt::STRING: total += column->size() * sizeof(StringPool::StringId); break;
+        }
+    }
+    return total;
+}
+
+bool DataFrame::isSortedBy(const SortOrder& prefix) const {
+    return DataFrameSorter::isPrefix(prefix, m_sortedBy);
+}
+
+bool DataFrame::declareSortedBy(const SortOrder& order) {
+    for (const auto& key : order) {
+        if (!hasColumn(key.column)) {
+            return false;
+        }
+    }
+
+    auto columnGetter = [this](const std::string& name) { return getColumn(name); };
+    if (!DataFrameSorter::isSorted(order, rowCount(), columnGetter)) {
+        return false;
+    }
+
+    m_sortedBy = order;
+    return true;
+}
+
 // ============================================================================
 // Opérations (délégation aux classes spécialisées)
 // ============================================================================
 
-std::shared_ptr<DataFrame> DataFrame::filter(const json& filterJson) const {
+std::shared_ptr<DataFrame> DataFrame::filter(
+    const json& filterJson,
+    const DataFrameFilter::IndexProbe& probe
+) const {
     auto columnGetter = [this](const std::string& name) { return getColumn(name); };
-    auto indices = DataFrameFilter::apply(filterJson, rowCount(), columnGetter);
+    auto indices = DataFrameFilter::apply(filterJson, rowCount(), columnGetter, probe);
 
     auto result = std::make_shared<DataFrame>();
     result->m_string_pool = m_string_pool;
@@ -122,22 +165,40 @@ std::shared_ptr<DataFrame> DataFrame::filter(const json& filterJson) const {
         result->addColumn(filteredCol);
     }
 
+    // Les indices filtrés sont croissants : l'ordre relatif est conservé
+    result->m_sortedBy = m_sortedBy;
+
     return result;
 }
 
 std::shared_ptr<DataFrame> DataFrame::orderBy(const json& orderJson) const {
-    auto columnGetter = [this](const std::string& name) { return getColumn(name); };
-    auto indices = DataFrameSorter::getSortedIndices(orderJson, rowCount(), columnGetter);
+    auto order = DataFrameSorter::parseSortOrder(orderJson);
 
     auto result = std::make_shared<DataFrame>();
     result->m_string_pool = m_string_pool;
 
+    // Déjà trié sur cette clef : le tri stable serait l'identité
+    if (isSortedBy(order)) {
+        for (const auto& colName : m_columnOrder) {
+            result->addColumn(getColumn(colName)->clone());
+        }
+        result->m_sortedBy = m_sortedBy;
+        return result;
+    }
+
+    auto columnGetter = [this](const std::string& name) { return getColumn(name); };
+    auto indices = DataFrameSorter::getSortedIndices(orderJson, rowCount(), columnGetter);
+
     for (const auto& colName : m_columnOrder) {
         auto originalCol = getColumn(colName);
         auto sortedCol = originalCol->filterByIndices(indices);
         result->addColumn(sortedCol);
     }
 
+    if (!order.empty()) {
+        result->m_sortedBy = DataFrameSorter::combine(order, m_sortedBy);
+    }
+
     return result;
 }
 
@@ -148,7 +209,8 @@ std::shared_ptr<DataFrame> DataFrame::groupBy(const json& groupByJson) const {
         rowCount(),
         columnGetter,
         m_columnOrder,
-        m_string_pool
+        m_string_pool,
+        m_sortedBy
     );
 }
 
@@ -163,6 +225,12 @@ std::shared_ptr<DataFrame> DataFrame::select(
         result->addColumn(col->clone());
     }
 
+    // Conserver le plus long préfixe de clefs encore présentes
+    for (const auto& key : m_sortedBy) {
+        if (!result->hasColumn(key.column)) break;
+        result->m_sortedBy.push_back(key);
+    }
+
     return result;
 }
 
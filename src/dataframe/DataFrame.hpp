@@ -2,6 +2,8 @@
 
 #include "Column.hpp"
 #include "StringPool.hpp"
+#include "DataFrameFilter.hpp"
+#include "DataFrameSorter.hpp"
 #include <nlohmann/json.hpp>
 #include <unordered_map>
 #include <vector>
@@ -46,9 +48,14 @@ public:
     size_t rowCount() const;
     size_t columnCount() const { return m_columns.size(); }
     bool empty() const;
+    size_t memoryUsage() const;  // Octets des données des colonnes, StringPool exclu
 
     // Opérations (délèguent aux classes spécialisées)
-    std::shared_ptr<DataFrame> filter(const json& filterJson) const;
+    // probe : résolution optionnelle des prédicats par index (voir DataFrameIndex)
+    std::shared_ptr<DataFrame> filter(
+        const json& filterJson,
+        const DataFrameFilter::IndexProbe& probe = nullptr
+    ) const;
     std::shared_ptr<DataFrame> orderBy(const json& orderJson) const;
     std::shared_ptr<DataFrame> groupBy(const json& groupByJson) const;
     std::shared_ptr<DataFrame> select(const std::vector<std::string>& columnNames) const;
@@ -81,13 +88,31 @@ public:
     // Helper pour ajouter des données
     void addRow(const std::vector<std::string>& values);
 
+    // Métadonnées de tri
+    // Propagées par orderBy, filter, select et groupBy (chemin trié).
+    // addRow et setColumn sur une colonne de tri les invalident ; un code qui
+    // modifie une colonne en place doit appeler clearSortedBy().
+    const SortOrder& getSortedBy() const { return m_sortedBy; }
+    bool isSortedBy(const SortOrder& prefix) const;
+    void clearSortedBy() { m_sortedBy.clear(); }
+
+    /**
+     * Déclare que les lignes sont déjà triées (ex: ORDER BY côté PostgreSQL,
+     * CSV exporté trié). L'ordre est vérifié en une passe linéaire : s'il n'est
+     * pas respecté (collation différente, données modifiées), la déclaration
+     * est ignorée et la méthode retourne false.
+     */
+    bool declareSortedBy(const SortOrder& order);
+
 private:
     std::unordered_map<std::string, IColumnPtr> m_columns;
     std::vector<std::string> m_columnOrder;
     std::shared_ptr<StringPool> m_string_pool;
+    SortOrder m_sortedBy;
 
     // Friend pour permettre l'accès au string pool par l'aggregator
     friend class DataFrameAggregator;
+    friend class DataFrameIndex;
 };
 
 using DataFramePtr = std::shared_ptr<DataFrame>;
@@ -1,16 +1,47 @@
 #include "DataFrameAggregator.hpp"
 #include "DataFrame.hpp"
+#include "Cancellation.hpp"
 #include <cstring>
 #include <unordered_set>
 
 namespace dataframe {
 
+namespace {
+
+// Valeur JSON d'une cellule
+json cellToJson(const IColumn& col, size_t row) {
+    return visitColumn(col, [row](const auto& typed) { return json(typed.at(row)); });
+}
+
+// Libellés des valeurs de la colonne pivot (noms des colonnes pivotées),
+// calculés en une passe typée
+std::vector<std::string> pivotLabels(const IColumn& col, size_t rowCount) {
+    std::vector<std::string> labels;
+    labels.reserve(rowCount);
+    visitColumn(col, [&](const auto& typed) {
+        using Col = ColumnT<decltype(typed)>;
+        for (size_t i = 0; i < rowCount; ++i) {
+            if constexpr (std::is_same_v<Col, IntColumn>) {
+                labels.push_back(std::to_string(typed.at(i)));
+            } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                labels.push_back(std::to_string(static_cast<int>(typed.at(i))));
+            } else {
+                labels.push_back(typed.at(i));
+            }
+        }
+    });
+    return labels;
+}
+
+} // namespace
+
 DataFrameAggregator::DataFramePtr DataFrameAggregator::groupBy(
     const json& groupByJson,
     size_t rowCount,
     const ColumnGetter& getColumn,
     const std::vector<std::string>& columnOrder,
-    std::shared_ptr<StringPool> stringPool
+    std::shared_ptr<StringPool> stringPool,
+    const SortOrder& sortedBy
 ) {
     if (!groupByJson.contains("groupBy") || !groupByJson.contains("aggregations")) {
         return std::make_shared<DataFrame>();
@@ -19,11 +50,10 @@ DataFrameAggregator::DataFramePtr DataFrameAggregator::groupBy(
     auto groupByColumns = groupByJson["groupBy"].get<std::vector<std::string>>();
     auto aggregations = groupByJson["aggregations"];
 
-    // Créer les groupes
-    auto groups = buildGroups(groupByColumns, rowCount, getColumn);
-
-    // Créer le DataFrame résultant
+    // Créer le DataFrame résultant (les colonnes de groupement recopient les
+    // IDs de la source : elles doivent partager son string pool)
     auto result = std::make_shared<DataFrame>();
+    result->setStringPool(stringPool);
 
     // Ajouter les colonnes de groupement
     for (const auto& colName : groupByColumns) {
@@ -49,6 +79,16 @@ DataFrameAggregator::DataFramePtr DataFrameAggregator::groupBy(
         }
     }
 
+    // Entrée triée sur les colonnes de groupement : une seule passe, sans hash
+    if (hasSortedPrefix(groupByColumns, sortedBy)) {
+        streamingGroupBy(result, groupByColumns, aggregations, rowCount, getColumn);
+        result->m_sortedBy.assign(sortedBy.begin(), sortedBy.begin() + groupByColumns.size());
+        return result;
+    }
+
+    // Créer les groupes
+    auto groups = buildGroups(groupByColumns, rowCount, getColumn);
+
     // Remplir le DataFrame résultant
     fillGroupColumns(result, groupByColumns, groups, getColumn);
     computeAggregations(result, aggregations, groups, getColumn);
@@ -56,6 +96,190 @@ DataFrameAggregator::DataFramePtr DataFrameAggregator::groupBy(
     return result;
 }
 
+bool DataFrameAggregator::hasSortedPrefix(
+    const std::vector<std::string>& groupByColumns,
+    const SortOrder& sortedBy
+) {
+    if (groupByColumns.empty() || groupByColumns.size() > sortedBy.size()) {
+        return false;
+    }
+
+    std::unordered_set<std::string> groupSet(groupByColumns.begin(), groupByColumns.end());
+    if (groupSet.size() != groupByColumns.size()) {
+        return false;  // Colonnes dupliquées : laisser le chemin hash gérer
+    }
+
+    for (size_t i = 0; i < groupByColumns.size(); ++i) {
+        if (!groupSet.count(sortedBy[i].column)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DataFrameAggregator::streamingGroupBy(
+    DataFramePtr result,
+    const std::vector<std::string>& groupByColumns,
+    const json& aggregations,
+    size_t rowCount,
+    const ColumnGetter& getColumn
+) {
+    // Colonnes de clef : accès direct aux buffers typés
+    struct KeySlot {
+        IColumnPtr source;
+        IColumnPtr target;
+        ColumnTypeOpt type;
+    };
+    std::vector<KeySlot> keys;
+    keys.reserve(groupByColumns.size());
+    for (const auto& colName : groupByColumns) {
+        auto col = getColumn(colName);
+        keys.push_back({col, result->getColumn(colName), col->getType()});
+    }
+
+    // Même égalité que buildGroups (double comparé bit à bit)
+    auto sameKey = [&keys](size_t a, size_t b) -> bool {
+        for (const auto& key : keys) {
+            switch (key.type) {
+                case ColumnTypeOpt::INT: {
+                    const auto& data = static_cast<const IntColumn&>(*key.source).data();
+                    if (data[a] != data[b]) return false;
+                    break;
+                }
+                case ColumnTypeOpt::DOUBLE: {
+                    const auto& data = static_cast<const DoubleColumn&>(*key.source).data();
+                    if (std::memcmp(&data[a], &data[b], sizeof(double)) != 0) return false;
+                    break;
+                }
+                case ColumnTypeOpt::STRING: {
+                    const auto& data = static_cast<const StringColumn&>(*key.source).data();
+                    if (data[a] != data[b]) return false;
+                    break;
+                }
+            }
+        }
+        return true;
+    };
+
+    // État d'agrégation O(1) par groupe
+    enum class AggFn { Count, Sum, Avg, Min, Max, Unknown };
+    struct AggSlot {
+        AggFn fn;
+        const std::vector<int>* ints = nullptr;
+        const std::vector<double>* doubles = nullptr;
+        IColumnPtr target;
+        size_t count = 0;
+        double sum = 0.0;
+        double extreme = 0.0;
+    };
+    std::vector<AggSlot> aggs;
+    aggs.reserve(aggregations.size());
+    for (const auto& aggDef : aggregations) {
+        std::string function = aggDef["function"];
+        AggSlot slot;
+        slot.fn = function == "count" ? AggFn::Count
+                : function == "sum"   ? AggFn::Sum
+                : function == "avg"   ? AggFn::Avg
+                : function == "min"   ? AggFn::Min
+                : function == "max"   ? AggFn::Max
+                : AggFn::Unknown;
+        slot.target = result->getColumn(aggDef["alias"].get<std::string>());
+
+        // count ne lit pas la colonne source (ex. "column": "*"), comme le chemin par hachage
+        if (slot.fn != AggFn::Count) {
+            auto sourceCol = getColumn(aggDef["column"].get<std::string>());
+            if (sourceCol->getType() == ColumnTypeOpt::INT) {
+                slot.ints = &static_cast<const IntColumn&>(*sourceCol).data();
+            } else if (sourceCol->getType() == ColumnTypeOpt::DOUBLE) {
+                slot.doubles = &static_cast<const DoubleColumn&>(*sourceCol).data();
+            }
+        }
+        aggs.push_back(std::move(slot));
+    }
+
+    auto accumulate = [&aggs](size_t row) {
+        for (auto& agg : aggs) {
+            double val = 0.0;
+            bool numeric = true;
+            if (agg.ints) {
+                val = (*agg.ints)[row];
+            } else if (agg.doubles) {
+                val = (*agg.doubles)[row];
+            } else {
+                numeric = false;
+            }
+
+            if (numeric) {
+                agg.sum += val;
+                if (agg.count == 0 ||
+                    (agg.fn == AggFn::Min ? val < agg.extreme : val > agg.extreme)) {
+                    agg.extreme = val;
+                }
+            }
+            agg.count++;
+        }
+    };
+
+    auto emitGroup = [&](size_t firstRow) {
+        for (const auto& key : keys) {
+            switch (key.type) {
+                case ColumnTypeOpt::INT:
+                    static_cast<IntColumn&>(*key.target).push_back(
+                        static_cast<const IntColumn&>(*key.source).at(firstRow));
+                    break;
+                case ColumnTypeOpt::DOUBLE:
+                    static_cast<DoubleColumn&>(*key.target).push_back(
+                        static_cast<const DoubleColumn&>(*key.source).at(firstRow));
+                    break;
+                case ColumnTypeOpt::STRING:
+                    static_cast<StringColumn&>(*key.target).push_back(
+                        static_cast<const StringColumn&>(*key.source).getId(firstRow));
+                    break;
+            }
+        }
+
+        for (auto& agg : aggs) {
+            switch (agg.fn) {
+                case AggFn::Count:
+                    static_cast<IntColumn&>(*agg.target).push_back(static_cast<int>(agg.count));
+                    break;
+                case AggFn::Sum:
+                    static_cast<DoubleColumn&>(*agg.target).push_back(agg.sum);
+                    break;
+                case AggFn::Avg:
+                    static_cast<DoubleColumn&>(*agg.target).push_back(
+                        agg.count > 0 ? agg.sum / agg.count : agg.sum);
+                    break;
+                case AggFn::Min:
+                case AggFn::Max:
+                    static_cast<DoubleColumn&>(*agg.target).push_back(agg.extreme);
+                    break;
+                case AggFn::Unknown:
+                    break;
+            }
+            agg.count = 0;
+            agg.sum = 0.0;
+            agg.extreme = 0.0;
+        }
+    };
+
+    if (rowCount == 0) {
+        return;
+    }
+
+    size_t groupStart = 0;
+    accumulate(0);
+    for (size_t i = 1; i < rowCount; ++i) {
+        checkCancelled(i);
+        if (!sameKey(groupStart, i)) {
+            emitGroup(groupStart);
+            groupStart = i;
+        }
+        accumulate(i);
+    }
+    emitGroup(groupStart);
+}
+
 DataFrameAggregator::GroupMap DataFrameAggregator::buildGroups(
     const std::vector<std::string>& groupByColumns,
     size_t rowCount,
@@ -88,6 +312,7 @@ DataFrameAggregator::GroupMap DataFrameAggregator::buildGroups(
 
     GroupMap groups;
     for (size_t i = 0; i < rowCount; ++i) {
+        checkCancelled(i);
         GroupKey groupKey;
         groupKey.values.reserve(extractors.size());
 
@@ -107,22 +332,24 @@ void DataFrameAggregator::fillGroupColumns(
     const GroupMap& groups,
     const ColumnGetter& getColumn
 ) {
-    for (const auto& [groupKey, rowIndices] : groups) {
-        for (size_t i = 0; i < groupByColumns.size(); ++i) {
-            auto col = result->getColumn(groupByColumns[i]);
-            auto originalCol = getColumn(groupByColumns[i]);
-
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                auto origIntCol = std::dynamic_pointer_cast<IntColumn>(originalCol);
-                intCol->push_back(origIntCol->at(rowIndices[0]));
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                auto origDoubleCol = std::dynamic_pointer_cast<DoubleColumn>(originalCol);
-                doubleCol->push_back(origDoubleCol->at(rowIndices[0]));
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                auto origStringCol = std::dynamic_pointer_cast<StringColumn>(originalCol);
-                stringCol->push_back(origStringCol->getId(rowIndices[0]));
+    // Colonne par colonne : la colonne résultat a le type de la source
+    for (const auto& colName : groupByColumns) {
+        auto col = result->getColumn(colName);
+        auto originalCol = getColumn(colName);
+        col->reserve(groups.size());
+
+        visitColumn(*originalCol, [&](const auto& src) {
+            using Col = ColumnT<decltype(src)>;
+            auto& dst = static_cast<Col&>(*col);
+            for (const auto& entry : groups) {
+                size_t first = entry.second[0];
+                if constexpr (std::is_same_v<Col, StringColumn>) {
+                    dst.push_back(src.getId(first));
+                } else {
+                    dst.push_back(src.data()[first]);
+                }
             }
-        }
+        });
     }
 }
 
@@ -132,69 +359,61 @@ void DataFrameAggregator::computeAggregations(
     const GroupMap& groups,
     const ColumnGetter& getColumn
 ) {
-    for (const auto& [groupKey, rowIndices] : groups) {
-        for (const auto& aggDef : aggregations) {
-            std::string column = aggDef["column"];
-            std::string function = aggDef["function"];
-            std::string alias = aggDef["alias"];
+    // Agrégation par agrégation : le type de la source n'est résolu qu'une fois
+    for (const auto& aggDef : aggregations) {
+        std::string column = aggDef["column"];
+        std::string function = aggDef["function"];
+        std::string alias = aggDef["alias"];
 
-            auto aggCol = result->getColumn(alias);
-            auto sourceCol = getColumn(column);
+        auto aggCol = result->getColumn(alias);
 
-            if (function == "count") {
-                auto intCol = std::dynamic_pointer_cast<IntColumn>(aggCol);
-                intCol->push_back(static_cast<int>(rowIndices.size()));
-            } else if (function == "sum" || function == "avg") {
-                double sum = 0.0;
+        if (function == "count") {
+            auto& countCol = static_cast<IntColumn&>(*aggCol);
+            for (const auto& entry : groups) {
+                countCol.push_back(static_cast<int>(entry.second.size()));
+            }
+            continue;
+        }
 
-                if (auto intCol = std::dynamic_pointer_cast<IntColumn>(sourceCol)) {
-                    for (size_t idx : rowIndices) {
-                        sum += intCol->at(idx);
-                    }
-                } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(sourceCol)) {
-                    for (size_t idx : rowIndices) {
-                        sum += doubleCol->at(idx);
-                    }
-                }
+        bool isSum = function == "sum" || function == "avg";
+        bool isExtreme = function == "min" || function == "max";
+        if (!isSum && !isExtreme) continue;
 
-                if (function == "avg" && !rowIndices.empty()) {
-                    sum /= rowIndices.size();
-                }
+        bool isMin = function == "min";
+        bool isAvg = function == "avg";
+        auto& outCol = static_cast<DoubleColumn&>(*aggCol);
+        auto sourceCol = getColumn(column);
 
-                auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(aggCol);
-                doubleCol->push_back(sum);
-            } else if (function == "min" || function == "max") {
+        visitColumn(*sourceCol, [&](const auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            for (const auto& entry : groups) {
+                const auto& rowIndices = entry.second;
                 if (rowIndices.empty()) continue;
 
-                double extremeVal = 0.0;
-                bool initialized = false;
-
-                if (auto intCol = std::dynamic_pointer_cast<IntColumn>(sourceCol)) {
-                    int extreme = intCol->at(rowIndices[0]);
-                    for (size_t idx : rowIndices) {
-                        int val = intCol->at(idx);
-                        if (!initialized || (function == "min" ? val < extreme : val > extreme)) {
-                            extreme = val;
-                            initialized = true;
+                double value = 0.0;
+                if constexpr (!std::is_same_v<Col, StringColumn>) {
+                    const auto& data = typed.data();
+                    if (isSum) {
+                        for (size_t idx : rowIndices) {
+                            value += data[idx];
                         }
-                    }
-                    extremeVal = static_cast<double>(extreme);
-                } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(sourceCol)) {
-                    double extreme = doubleCol->at(rowIndices[0]);
-                    for (size_t idx : rowIndices) {
-                        double val = doubleCol->at(idx);
-                        if (!initialized || (function == "min" ? val < extreme : val > extreme)) {
-                            extreme = val;
-                            initialized = true;
+                        if (isAvg) {
+                            value /= rowIndices.size();
+                        }
+                    } else {
+                        auto extreme = data[rowIndices[0]];
+                        for (size_t idx : rowIndices) {
+                            auto val = data[idx];
+                            if (isMin ? val < extreme : val > extreme) {
+                                extreme = val;
+                            }
                         }
+                        value = static_cast<double>(extreme);
                     }
-                    extremeVal = extreme;
                 }
-
-                auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(aggCol);
-                doubleCol->push_back(extremeVal);
+                outCol.push_back(value);
             }
-        }
+        });
     }
 }
 
@@ -218,24 +437,24 @@ json DataFrameAggregator::groupByTree(
     // Créer les groupes
     auto groups = buildGroups(groupByColumns, rowCount, getColumn);
 
+    // Colonnes résolues une fois (le getter n'est pas rappelé par cellule)
+    std::unordered_map<std::string, IColumnPtr> columnCache;
+    auto resolve = [&](const std::string& colName) -> const IColumn& {
+        auto it = columnCache.find(colName);
+        if (it == columnCache.end()) {
+            it = columnCache.emplace(colName, getColumn(colName)).first;
+        }
+        return *it->second;
+    };
+
     // Helper pour extraire une valeur JSON d'une colonne
     auto getJsonValue = [&](const std::string& colName, size_t rowIdx) -> json {
-        auto col = getColumn(colName);
-        if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-            return intCol->at(rowIdx);
-        } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-            return doubleCol->at(rowIdx);
-        } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-            return stringCol->at(rowIdx);
-        }
-        return nullptr;
+        return cellToJson(resolve(colName), rowIdx);
     };
 
     // Helper pour calculer une agrégation
     auto computeAgg = [&](const std::string& function, const std::string& column,
                           const std::vector<size_t>& rowIndices) -> json {
-        auto sourceCol = getColumn(column);
-
         if (function == "blank" || function == "none" || function == "") {
             // Retourne une valeur vide/null
             return nullptr;
@@ -251,16 +470,16 @@ json DataFrameAggregator::groupByTree(
             return nullptr;
         }
         else if (function == "sum" || function == "avg") {
-            double sum = 0.0;
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(sourceCol)) {
-                for (size_t idx : rowIndices) {
-                    sum += intCol->at(idx);
-                }
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(sourceCol)) {
-                for (size_t idx : rowIndices) {
-                    sum += doubleCol->at(idx);
+            double sum = visitColumn(resolve(column), [&](const auto& typed) {
+                double total = 0.0;
+                if constexpr (!std::is_same_v<ColumnT<decltype(typed)>, StringColumn>) {
+                    const auto& data = typed.data();
+                    for (size_t idx : rowIndices) {
+                        total += data[idx];
+                    }
                 }
-            }
+                return total;
+            });
             if (function == "avg" && !rowIndices.empty()) {
                 sum /= rowIndices.size();
             }
@@ -269,25 +488,22 @@ json DataFrameAggregator::groupByTree(
         else if (function == "min" || function == "max") {
             if (rowIndices.empty()) return nullptr;
 
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(sourceCol)) {
-                int extreme = intCol->at(rowIndices[0]);
-                for (size_t idx : rowIndices) {
-                    int val = intCol->at(idx);
-                    if (function == "min" ? val < extreme : val > extreme) {
-                        extreme = val;
-                    }
-                }
-                return extreme;
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(sourceCol)) {
-                double extreme = doubleCol->at(rowIndices[0]);
-                for (size_t idx : rowIndices) {
-                    double val = doubleCol->at(idx);
-                    if (function == "min" ? val < extreme : val > extreme) {
-                        extreme = val;
+            bool isMin = function == "min";
+            return visitColumn(resolve(column), [&](const auto& typed) -> json {
+                if constexpr (std::is_same_v<ColumnT<decltype(typed)>, StringColumn>) {
+                    return nullptr;
+                } else {
+                    const auto& data = typed.data();
+                    auto extreme = data[rowIndices[0]];
+                    for (size_t idx : rowIndices) {
+                        auto val = data[idx];
+                        if (isMin ? val < extreme : val > extreme) {
+                            extreme = val;
+                        }
                     }
+                    return extreme;
                 }
-                return extreme;
-            }
+            });
         }
         return nullptr;
     };
@@ -373,39 +589,29 @@ json DataFrameAggregator::pivot(
     // Préfixe optionnel pour les colonnes pivotées (vide par défaut)
     std::string prefix = pivotJson.value("prefix", "");
 
-    // Helper pour extraire une valeur JSON d'une colonne
-    auto getJsonValue = [&](const std::string& colName, size_t rowIdx) -> json {
-        auto col = getColumn(colName);
-        if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-            return intCol->at(rowIdx);
-        } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-            return doubleCol->at(rowIdx);
-        } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-            return stringCol->at(rowIdx);
+    // Colonnes résolues une fois (le getter n'est pas rappelé par cellule)
+    std::unordered_map<std::string, IColumnPtr> columnCache;
+    auto resolve = [&](const std::string& colName) -> const IColumn& {
+        auto it = columnCache.find(colName);
+        if (it == columnCache.end()) {
+            it = columnCache.emplace(colName, getColumn(colName)).first;
         }
-        return nullptr;
+        return *it->second;
     };
 
-    // Helper pour convertir une valeur en string (pour le nom de colonne)
-    auto valueToString = [&](const std::string& colName, size_t rowIdx) -> std::string {
-        auto col = getColumn(colName);
-        if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-            return std::to_string(intCol->at(rowIdx));
-        } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-            return std::to_string(static_cast<int>(doubleCol->at(rowIdx)));
-        } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-            return stringCol->at(rowIdx);
-        }
-        return "";
+    // Helper pour extraire une valeur JSON d'une colonne
+    auto getJsonValue = [&](const std::string& colName, size_t rowIdx) -> json {
+        return cellToJson(resolve(colName), rowIdx);
     };
 
+    // Libellé de la valeur pivot de chaque ligne (nom de colonne)
+    auto labels = pivotLabels(*getColumn(pivotColumn), rowCount);
+
     // 1. Collecter toutes les valeurs uniques de pivotColumn (pour créer les colonnes)
     std::vector<std::string> pivotValues;
     std::unordered_set<std::string> pivotValuesSet;
-    for (size_t i = 0; i < rowCount; ++i) {
-        std::string val = valueToString(pivotColumn, i);
-        if (pivotValuesSet.find(val) == pivotValuesSet.end()) {
-            pivotValuesSet.insert(val);
+    for (const auto& val : labels) {
+        if (pivotValuesSet.insert(val).second) {
             pivotValues.push_back(val);
         }
     }
@@ -431,8 +637,7 @@ json DataFrameAggregator::pivot(
 
         // Remplir les colonnes pivotées
         for (size_t rowIdx : rowIndices) {
-            std::string pivotVal = valueToString(pivotColumn, rowIdx);
-            row[prefix + pivotVal] = getJsonValue(valueColumn, rowIdx);
+            row[prefix + labels[rowIdx]] = getJsonValue(valueColumn, rowIdx);
         }
 
         result.push_back(row);
@@ -473,26 +678,14 @@ DataFrameAggregator::DataFramePtr DataFrameAggregator::pivotToDataFrame(
     auto valueCol = getColumn(valueColumn);
     ColumnTypeOpt valueType = valueCol->getType();
 
-    // Helper pour convertir une valeur en string (pour le nom de colonne)
-    auto valueToString = [&](const std::string& colName, size_t rowIdx) -> std::string {
-        auto col = getColumn(colName);
-        if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-            return std::to_string(intCol->at(rowIdx));
-        } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-            return std::to_string(static_cast<int>(doubleCol->at(rowIdx)));
-        } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-            return stringCol->at(rowIdx);
-        }
-        return "";
-    };
+    // Libellé de la valeur pivot de chaque ligne (nom de colonne)
+    auto labels = pivotLabels(*getColumn(pivotColumn), rowCount);
 
     // 1. Collecter toutes les valeurs uniques de pivotColumn
     std::vector<std::string> pivotValues;
     std::unordered_set<std::string> pivotValuesSet;
-    for (size_t i = 0; i < rowCount; ++i) {
-        std::string val = valueToString(pivotColumn, i);
-        if (pivotValuesSet.find(val) == pivotValuesSet.end()) {
-            pivotValuesSet.insert(val);
+    for (const auto& val : labels) {
+        if (pivotValuesSet.insert(val).second) {
             pivotValues.push_back(val);
         }
     }
@@ -536,59 +729,44 @@ DataFrameAggregator::DataFramePtr DataFrameAggregator::pivotToDataFrame(
         }
     }
 
-    // 4. Remplir les données
-    for (const auto& [groupKey, rowIndices] : groups) {
-        // Colonnes d'index
-        for (const auto& colName : indexColumns) {
-            auto srcCol = getColumn(colName);
-            auto dstCol = result->getColumn(colName);
-            size_t srcIdx = rowIndices[0];
-
-            if (auto intSrc = std::dynamic_pointer_cast<IntColumn>(srcCol)) {
-                std::dynamic_pointer_cast<IntColumn>(dstCol)->push_back(intSrc->at(srcIdx));
-            } else if (auto doubleSrc = std::dynamic_pointer_cast<DoubleColumn>(srcCol)) {
-                std::dynamic_pointer_cast<DoubleColumn>(dstCol)->push_back(doubleSrc->at(srcIdx));
-            } else if (auto stringSrc = std::dynamic_pointer_cast<StringColumn>(srcCol)) {
-                std::dynamic_pointer_cast<StringColumn>(dstCol)->push_back(stringSrc->at(srcIdx));
+    // 4. Remplir les données, colonne par colonne
+    // Colonnes d'index : première ligne de chaque groupe
+    for (const auto& colName : indexColumns) {
+        auto dstCol = result->getColumn(colName);
+        dstCol->reserve(groups.size());
+        visitColumn(*getColumn(colName), [&](const auto& src) {
+            auto& dst = static_cast<ColumnT<decltype(src)>&>(*dstCol);
+            for (const auto& entry : groups) {
+                dst.push_back(src.at(entry.second[0]));
             }
-        }
+        });
+    }
 
-        // Initialiser les colonnes pivotées avec des valeurs par défaut
+    // Colonnes pivotées : valeurs par défaut, puis vraies valeurs
+    std::unordered_map<std::string, IColumnPtr> pivotColumns;
+    for (const auto& pv : pivotValues) {
+        pivotColumns.emplace(pv, result->getColumn(prefix + pv));
+    }
+
+    visitColumn(*valueCol, [&](const auto& src) {
+        using Col = ColumnT<decltype(src)>;
+        using Value = std::decay_t<decltype(src.at(0))>;
         for (const auto& pv : pivotValues) {
-            std::string colName = prefix + pv;
-            auto dstCol = result->getColumn(colName);
-            switch (valueType) {
-                case ColumnTypeOpt::INT:
-                    std::dynamic_pointer_cast<IntColumn>(dstCol)->push_back(0);
-                    break;
-                case ColumnTypeOpt::DOUBLE:
-                    std::dynamic_pointer_cast<DoubleColumn>(dstCol)->push_back(0.0);
-                    break;
-                case ColumnTypeOpt::STRING:
-                    std::dynamic_pointer_cast<StringColumn>(dstCol)->push_back("");
-                    break;
+            auto& dst = static_cast<Col&>(*pivotColumns.at(pv));
+            for (size_t g = 0; g < groups.size(); ++g) {
+                dst.push_back(Value{});
             }
         }
 
-        // Remplir les colonnes pivotées avec les vraies valeurs
-        size_t currentRow = result->rowCount() - 1;
-        for (size_t srcIdx : rowIndices) {
-            std::string pivotVal = valueToString(pivotColumn, srcIdx);
-            std::string colName = prefix + pivotVal;
-            auto dstCol = result->getColumn(colName);
-
-            if (auto intDst = std::dynamic_pointer_cast<IntColumn>(dstCol)) {
-                auto intSrc = std::dynamic_pointer_cast<IntColumn>(valueCol);
-                intDst->set(currentRow, intSrc->at(srcIdx));
-            } else if (auto doubleDst = std::dynamic_pointer_cast<DoubleColumn>(dstCol)) {
-                auto doubleSrc = std::dynamic_pointer_cast<DoubleColumn>(valueCol);
-                doubleDst->set(currentRow, doubleSrc->at(srcIdx));
-            } else if (auto stringDst = std::dynamic_pointer_cast<StringColumn>(dstCol)) {
-                auto stringSrc = std::dynamic_pointer_cast<StringColumn>(valueCol);
-                stringDst->set(currentRow, stringSrc->at(srcIdx));
+        size_t currentRow = 0;
+        for (const auto& entry : groups) {
+            for (size_t srcIdx : entry.second) {
+                auto& dst = static_cast<Col&>(*pivotColumns.at(labels[srcIdx]));
+                dst.set(currentRow, src.at(srcIdx));
             }
+            ++currentRow;
         }
-    }
+    });
 
     return result;
 }
@@ -2,6 +2,7 @@
 
 #include "Column.hpp"
 #include "StringPool.hpp"
+#include "DataFrameSorter.hpp"
 #include <nlohmann/json.hpp>
 #include <vector>
 #include <string>
@@ -23,12 +24,21 @@ public:
     using ColumnGetter = std::function<IColumnPtr(const std::string&)>;
     using DataFramePtr = std::shared_ptr<DataFrame>;
 
+    /**
+     * GroupBy avec agrégations
+     *
+     * Si `sortedBy` commence par les colonnes de groupement (dans n'importe
+     * quel ordre), chaque groupe forme une plage contiguë de lignes : le calcul
+     * se fait alors en une seule passe, sans hash table, avec un état O(1) par
+     * agrégation. Le résultat est alors trié selon ce préfixe.
+     */
     static DataFramePtr groupBy(
         const json& groupByJson,
         size_t rowCount,
         const ColumnGetter& getColumn,
         const std::vector<std::string>& columnOrder,
-        std::shared_ptr<StringPool> stringPool
+        std::shared_ptr<StringPool> stringPool,
+        const SortOrder& sortedBy = {}
     );
 
     /**
@@ -108,6 +118,25 @@ private:
         const GroupMap& groups,
         const ColumnGetter& getColumn
     );
+
+    /**
+     * Vrai si les colonnes de groupement forment un préfixe de l'ordre de tri
+     */
+    static bool hasSortedPrefix(
+        const std::vector<std::string>& groupByColumns,
+        const SortOrder& sortedBy
+    );
+
+    /**
+     * GroupBy en flux sur des groupes contigus (entrée triée)
+     */
+    static void streamingGroupBy(
+        DataFramePtr result,
+        const std::vector<std::string>& groupByColumns,
+        const json& aggregations,
+        size_t rowCount,
+        const ColumnGetter& getColumn
+    );
 };
 
 } // namespace dataframe
@@ -1,13 +1,32 @@
 #include "DataFrameFilter.hpp"
+#include "StringMatcher.hpp"
+#include "Cancellation.hpp"
 #include <algorithm>
 #include <set>
 
 namespace dataframe {
 
+namespace {
+
+std::vector<size_t> intersect(const std::vector<size_t>& a, const std::vector<size_t>& b) {
+    std::vector<size_t> result;
+    result.reserve(std::min(a.size(), b.size()));
+
+    std::set_intersection(
+        a.begin(), a.end(),
+        b.begin(), b.end(),
+        std::back_inserter(result)
+    );
+    return result;
+}
+
+} // namespace
+
 std::vector<size_t> DataFrameFilter::apply(
     const json& filterJson,
     size_t rowCount,
-    const ColumnGetter& getColumn
+    const ColumnGetter& getColumn,
+    const IndexProbe& probe
 ) {
     std::vector<size_t> result;
 
@@ -15,6 +34,47 @@ std::vector<size_t> DataFrameFilter::apply(
         return result;
     }
 
+    std::vector<Predicate> predicates;
+    for (const auto& filterItem : filterJson) {
+        predicates.push_back(parsePredicate(filterItem));
+    }
+
+    // Prédicats résolus par index : intersection des lignes retournées
+    std::vector<const Predicate*> residual;
+    bool indexed = false;
+
+    for (const auto& pred : predicates) {
+        std::optional<std::vector<size_t>> rows;
+        if (probe) {
+            rows = probe(pred.column, pred.op, pred.values);
+        }
+        if (!rows) {
+            residual.push_back(&pred);
+            continue;
+        }
+        result = indexed ? intersect(result, *rows) : std::move(*rows);
+        indexed = true;
+    }
+
+    if (indexed) {
+        // Prédicats restants évalués sur les seules lignes candidates
+        for (const auto* pred : residual) {
+            if (result.empty()) break;
+            checkCancelled();
+
+            auto candidates = getColumn(pred->column)->filterByIndices(result);
+            auto matches = applyOperator(candidates, pred->op, pred->values);
+
+            std::vector<size_t> newResult;
+            newResult.reserve(matches.size());
+            for (size_t m : matches) {
+                newResult.push_back(result[m]);
+            }
+            result = std::move(newResult);
+        }
+        return result;
+    }
+
     result.reserve(rowCount);
 
     // Initialiser avec tous les indices
@@ -23,40 +83,51 @@ std::vector<size_t> DataFrameFilter::apply(
     }
 
     // Appliquer chaque filtre successivement
-    for (const auto& filterItem : filterJson) {
-        std::string column = filterItem["column"];
-        std::string op = filterItem["operator"];
-        std::string value = filterItem["value"].dump();
+    for (const auto& pred : predicates) {
+        checkCancelled();
+        auto col = getColumn(pred.column);
+        std::vector<size_t> matchingIndices = applyOperator(col, pred.op, pred.values);
+
+        // Intersection avec les indices actuels
+        result = intersect(result, matchingIndices);
+    }
+
+    return result;
+}
+
+DataFrameFilter::Predicate DataFrameFilter::parsePredicate(const json& filterItem) {
+    Predicate pred;
+    pred.column = filterItem["column"];
+    pred.op = filterItem["operator"];
+
+    auto toString = [](const json& v) {
+        std::string value = v.dump();
 
         // Remove quotes if it's a string value
         if (value.front() == '"' && value.back() == '"') {
             value = value.substr(1, value.size() - 2);
         }
+        return value;
+    };
 
-        auto col = getColumn(column);
-        std::vector<size_t> matchingIndices = applyOperator(col, op, value);
-
-        // Intersection avec les indices actuels
-        std::vector<size_t> newResult;
-        newResult.reserve(std::min(result.size(), matchingIndices.size()));
-
-        std::set_intersection(
-            result.begin(), result.end(),
-            matchingIndices.begin(), matchingIndices.end(),
-            std::back_inserter(newResult)
-        );
-
-        result = std::move(newResult);
+    const auto& value = filterItem["value"];
+    if (pred.op == "in" && value.is_array()) {
+        for (const auto& v : value) {
+            pred.values.push_back(toString(v));
+        }
+    } else {
+        pred.values.push_back(toString(value));
     }
-
-    return result;
+    return pred;
 }
 
 std::vector<size_t> DataFrameFilter::applyOperator(
     IColumnPtr col,
     const std::string& op,
-    const std::string& value
+    const std::vector<std::string>& values
 ) {
+    const std::string& value = values.empty() ? std::string() : values.front();
+
     if (op == "==") {
         return col->filterEqual(value);
     } else if (op == "!=") {
@@ -71,9 +142,24 @@ std::vector<size_t> DataFrameFilter::applyOperator(
         return col->filterGreaterOrEqual(value);
     } else if (op == "contains") {
         return col->filterContains(value);
+    } else if (StringMatcher::isStringOperator(op)) {
+        // startsWith, endsWith, regex et variantes insensibles à la casse
+        if (col->getType() != ColumnTypeOpt::STRING) {
+            return {};  // Not applicable
+        }
+        auto stringCol = std::static_pointer_cast<StringColumn>(col);
+        return stringCol->filterMatching(*StringMatcher::create(op, value));
+    } else if (op == "in") {
+        // Union des égalités, dédoublonnée et croissante
+        std::set<size_t> rows;
+        for (const auto& v : values) {
+            auto matches = col->filterEqual(v);
+            rows.insert(matches.begin(), matches.end());
+        }
+        return std::vector<size_t>(rows.begin(), rows.end());
     }
 
     return {};
 }
 
-} // namespace dataframe
\ No newline at end of file
+} // namespace dataframe
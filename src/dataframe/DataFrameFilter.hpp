@@ -6,6 +6,7 @@
 #include <string>
 #include <memory>
 #include <functional>
+#include <optional>
 
 namespace dataframe {
 
@@ -20,17 +21,34 @@ class DataFrameFilter {
 public:
     using ColumnGetter = std::function<IColumnPtr(const std::string&)>;
 
+    // Résolution d'un prédicat par un index (voir DataFrameIndex) :
+    // lignes croissantes, ou nullopt si le prédicat doit être scanné
+    using IndexProbe = std::function<std::optional<std::vector<size_t>>(
+        const std::string& column,
+        const std::string& op,
+        const std::vector<std::string>& values
+    )>;
+
     static std::vector<size_t> apply(
         const json& filterJson,
         size_t rowCount,
-        const ColumnGetter& getColumn
+        const ColumnGetter& getColumn,
+        const IndexProbe& probe = nullptr
     );
 
 private:
+    struct Predicate {
+        std::string column;
+        std::string op;
+        std::vector<std::string> values;  // plusieurs valeurs pour "in"
+    };
+
+    static Predicate parsePredicate(const json& filterItem);
+
     static std::vector<size_t> applyOperator(
         IColumnPtr col,
         const std::string& op,
-        const std::string& value
+        const std::vector<std::string>& values
     );
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "CsvReader.hpp"
 #include "DataFrame.hpp"
 #include <string>
 #include <memory>
@@ -12,17 +13,24 @@ namespace dataframe {
 class DataFrameIO {
 public:
     /**
-     * Charge un CSV dans un DataFrame
-     * Détecte automatiquement les types de colonnes
+     * Charge un CSV dans un DataFrame (voir CsvReader : mmap, parsing parallèle)
+     * Types de colonnes inférés sur un échantillon réparti sur le fichier
+     *
+     * sortedBy: ordre dans lequel le fichier a été exporté (optionnel).
+     * Vérifié après chargement puis déclaré sur le DataFrame.
+     * schema: types imposés par colonne (optionnel, voir CsvReader::parseSchema)
      */
     static std::shared_ptr<DataFrame> readCSV(
         const std::string& filepath,
         char delimiter = ',',
-        bool hasHeader = true
+        bool hasHeader = true,
+        const SortOrder& sortedBy = {},
+        const CsvReader::Schema& schema = {}
     );
 
     /**
-     * Sauvegarde un DataFrame en CSV
+     * Sauvegarde un DataFrame en CSV (voir CsvWriter : blocs encodés en
+     * parallèle, quoting RFC 4180)
      */
     static void writeCSV(
         const DataFrame& df,
@@ -31,13 +39,18 @@ public:
         bool includeHeader = true
     );
 
-private:
-    static std::vector<std::string> parseCSVLine(
-        const std::string& line,
-        char delimiter
-    );
+    /**
+     * Format binaire colonnaire .adf (voir ColumnarFile) : types, ordre de
+     * tri et StringPool conservés, chargement par copie en bloc
+     */
+    static std::shared_ptr<DataFrame> readColumnar(const std::string& filepath);
+    static void writeColumnar(const DataFrame& df, const std::string& filepath);
 
-    static ColumnTypeOpt detectType(const std::string& value);
+    /**
+     * Flux Arrow IPC (voir ArrowIpc) : échange avec pyarrow / Polars
+     */
+    static std::shared_ptr<DataFrame> readArrow(const std::string& filepath);
+    static void writeArrow(const DataFrame& df, const std::string& filepath);
 };
 
 } // namespace dataframe
\ No newline at end of file
@@ -0,0 +1,660 @@
+#include "DataFrameIndex.hpp"
+#include "DataFrame.hpp"
+#include "TrigramIndex.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace dataframe {
+
+namespace {
+
+std::string trim(const std::string& s) {
+    size_t start = 0;
+    size_t end = s.size();
+    while (start < end && std::isspace(static_cast<unsigned char>(s[start]))) ++start;
+    while (end > start && std::isspace(static_cast<unsigned char>(s[end - 1]))) --end;
+    return s.substr(start, end - start);
+}
+
+bool isRangeOperator(const std::string& op) {
+    return op == "<" || op == "<=" || op == ">" || op == ">=";
+}
+
+// Seuil d'activation automatique des trigrammes : colonne assez grande
+// et quasi unique (au moins une valeur distincte pour deux lignes)
+constexpr size_t TRIGRAM_AUTO_MIN_ROWS = 10000;
+
+/**
+ * Appelle f(key, target) avec un accesseur typé ligne → valeur et la valeur
+ * cible convertie comme le ferait le scan (stoi / stod / string brute)
+ */
+template<typename F>
+auto withTypedKey(const IColumnPtr& col, const std::string& value, F&& f) {
+    if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
+        const auto& data = intCol->data();
+        return f([&data](size_t row) { return data[row]; }, std::stoi(value));
+    }
+    if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
+        const auto& data = doubleCol->data();
+        return f([&data](size_t row) { return data[row]; }, std::stod(value));
+    }
+    auto stringCol = std::static_pointer_cast<StringColumn>(col);
+    return f([&stringCol](size_t row) -> const std::string& { return stringCol->at(row); },
+             value);
+}
+
+constexpr char INDEX_MAGIC[4] = {'A', 'D', 'X', 'I'};
+
+template<typename T>
+void writeRaw(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+T readRaw(std::istream& in) {
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in) {
+        throw std::runtime_error("Truncated dataframe index");
+    }
+    return value;
+}
+
+void writeString(std::ostream& out, const std::string& value) {
+    writeRaw<uint64_t>(out, value.size());
+    out.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+std::string readString(std::istream& in) {
+    auto size = readRaw<uint64_t>(in);
+    if (size > (uint64_t{1} << 32)) {
+        throw std::runtime_error("Corrupted dataframe index");
+    }
+    std::string value(size, '\0');
+    in.read(value.data(), static_cast<std::streamsize>(size));
+    if (!in) {
+        throw std::runtime_error("Truncated dataframe index");
+    }
+    return value;
+}
+
+void writeRows(std::ostream& out, const std::vector<size_t>& rows) {
+    writeRaw<uint64_t>(out, rows.size());
+    for (size_t row : rows) {
+        writeRaw<uint64_t>(out, row);
+    }
+}
+
+// Lignes toutes < rowCount (au plus rowCount)
+std::vector<size_t> readRows(std::istream& in, size_t rowCount) {
+    auto count = readRaw<uint64_t>(in);
+    if (count > rowCount) {
+        throw std::runtime_error("Corrupted dataframe index");
+    }
+    std::vector<size_t> rows(count);
+    for (auto& row : rows) {
+        auto value = readRaw<uint64_t>(in);
+        if (value >= rowCount) {
+            throw std::runtime_error("Corrupted dataframe index");
+        }
+        row = static_cast<size_t>(value);
+    }
+    return rows;
+}
+
+void sortUnique(std::vector<size_t>& rows) {
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+}
+
+} // namespace
+
+DataFrameIndex::DataFrameIndex(std::shared_ptr<const DataFrame> df, bool autoBuild)
+    : m_df(std::move(df)), m_autoBuild(autoBuild) {}
+
+DataFrameIndex::Spec DataFrameIndex::parseSpec(const std::string& spec) {
+    Spec result;
+    std::istringstream stream(spec);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        item = trim(item);
+        if (item.empty()) continue;
+
+        Kind kind = Kind::Hash;
+        auto colon = item.rfind(':');
+        if (colon != std::string::npos) {
+            std::string kindStr = trim(item.substr(colon + 1));
+            std::transform(kindStr.begin(), kindStr.end(), kindStr.begin(),
+                           [](unsigned char c) { return std::tolower(c); });
+            if (kindStr == "hash") {
+                kind = Kind::Hash;
+            } else if (kindStr == "sorted" || kindStr == "range") {
+                kind = Kind::Sorted;
+            } else if (kindStr == "trigram") {
+                kind = Kind::Trigram;
+            } else {
+                throw std::runtime_error("Unknown index kind: " + kindStr);
+            }
+            item = trim(item.substr(0, colon));
+        }
+        result.emplace_back(item, kind);
+    }
+    return result;
+}
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+void DataFrameIndex::build(const std::string& column, Kind kind) {
+    if (!m_df->hasColumn(column)) {
+        throw std::runtime_error("Cannot index unknown column: " + column);
+    }
+    auto col = m_df->getColumn(column);
+
+    if (kind == Kind::Trigram) {
+        if (col->getType() != ColumnTypeOpt::STRING) {
+            throw std::runtime_error("Trigram index requires a string column: " + column);
+        }
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        enableTrigram(col);
+        if (std::find(m_trigram.begin(), m_trigram.end(), column) == m_trigram.end()) {
+            m_trigram.push_back(column);
+        }
+        return;
+    }
+
+    // Construction hors verrou ; si deux requêtes construisent le même
+    // index, la première publiée est conservée
+    if (kind == Kind::Hash) {
+        if (has(column, Kind::Hash)) return;
+
+        HashIndex index;
+        if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
+            const auto& data = intCol->data();
+            for (size_t i = 0; i < data.size(); ++i) {
+                index.rows[data[i]].push_back(i);
+            }
+        } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
+            const auto& data = stringCol->data();
+            for (size_t i = 0; i < data.size(); ++i) {
+                index.rows[data[i]].push_back(i);
+            }
+        } else {
+            throw std::runtime_error("Hash index not supported on double column: " + column);
+        }
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_hash.try_emplace(column, std::move(index));
+        return;
+    }
+
+    if (has(column, Kind::Sorted)) return;
+
+    SortedIndex index;
+    index.permutation.resize(col->size());
+    for (size_t i = 0; i < index.permutation.size(); ++i) {
+        index.permutation[i] = i;
+    }
+
+    // Stable : à valeur égale, l'ordre des lignes est celui du DataFrame,
+    // comme DataFrameSorter (std::stable_sort)
+    if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
+        // NaN en fin de permutation, exclus des recherches par intervalle
+        const auto& data = doubleCol->data();
+        auto validEnd = std::stable_partition(
+            index.permutation.begin(), index.permutation.end(),
+            [&data](size_t row) { return !std::isnan(data[row]); });
+        std::stable_sort(index.permutation.begin(), validEnd,
+                         [&data](size_t a, size_t b) { return data[a] < data[b]; });
+    } else {
+        withTypedKey(col, "0", [&index](auto key, auto) {
+            std::stable_sort(index.permutation.begin(), index.permutation.end(),
+                             [&key](size_t a, size_t b) { return key(a) < key(b); });
+            return 0;
+        });
+    }
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_sorted.try_emplace(column, std::move(index));
+}
+
+bool DataFrameIndex::has(const std::string& column, Kind kind) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    switch (kind) {
+        case Kind::Hash: return m_hash.count(column) > 0;
+        case Kind::Sorted: return m_sorted.count(column) > 0;
+        case Kind::Trigram:
+            return std::find(m_trigram.begin(), m_trigram.end(), column) != m_trigram.end();
+    }
+    return false;
+}
+
+void DataFrameIndex::enableTrigram(const IColumnPtr& col) {
+    // L'index vit dans le pool : partagé par toutes les colonnes du pool
+    auto pool = std::static_pointer_cast<StringColumn>(col)->getStringPool();
+    pool->enableTrigramIndex();
+    TrigramIndex::forPool(*pool);
+}
+
+// Les pointeurs retournés restent valides : un index publié n'est jamais retiré
+const DataFrameIndex::HashIndex* DataFrameIndex::hashIndex(const std::string& column) {
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_hash.find(column);
+        if (it != m_hash.end()) return &it->second;
+    }
+    if (!m_autoBuild) return nullptr;
+    build(column, Kind::Hash);
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return &m_hash.at(column);
+}
+
+const DataFrameIndex::SortedIndex* DataFrameIndex::sortedIndex(const std::string& column) {
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_sorted.find(column);
+        if (it != m_sorted.end()) return &it->second;
+    }
+    if (!m_autoBuild) return nullptr;
+    build(column, Kind::Sorted);
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return &m_sorted.at(column);
+}
+
+// ============================================================================
+// Recherche
+// ============================================================================
+
+std::optional<std::vector<size_t>> DataFrameIndex::lookup(
+    const std::string& column,
+    const std::string& op,
+    const std::vector<std::string>& values
+) {
+    if (values.empty() || !m_df->hasColumn(column)) {
+        return std::nullopt;
+    }
+
+    auto col = m_df->getColumn(column);
+
+    // Sous-chaîne : pas de lignes retournées ici, le scan du dictionnaire
+    // (StringMatcher) s'appuie sur les trigrammes du pool une fois activés
+    if ((op == "contains" || op == "icontains") && m_autoBuild
+        && col->getType() == ColumnTypeOpt::STRING && !has(column, Kind::Trigram)
+        && col->size() >= TRIGRAM_AUTO_MIN_ROWS
+        && std::static_pointer_cast<StringColumn>(col)->getStringPool()->size() * 2 >= col->size()) {
+        build(column, Kind::Trigram);
+    }
+
+    bool isEquality = (op == "==" || op == "in");
+    if (!isEquality && !(isRangeOperator(op) && values.size() == 1)) {
+        return std::nullopt;
+    }
+
+    // Égalité : index hash (int, string), sinon plage [v, v] de l'index trié
+    if (isEquality && col->getType() != ColumnTypeOpt::DOUBLE
+        && (has(column, Kind::Hash) || !has(column, Kind::Sorted))) {
+        const HashIndex* index = hashIndex(column);
+        if (index) {
+            return hashLookup(*index, col, values);
+        }
+    }
+
+    const SortedIndex* index = sortedIndex(column);
+    if (!index) {
+        return std::nullopt;
+    }
+
+    if (!isEquality) {
+        return rangeLookup(*index, col, op, values.front());
+    }
+
+    std::vector<size_t> rows;
+    for (const auto& value : values) {
+        auto matches = rangeLookup(*index, col, "==", value);
+        rows.insert(rows.end(), matches.begin(), matches.end());
+    }
+    if (values.size() > 1) {
+        sortUnique(rows);
+    }
+    return rows;
+}
+
+std::optional<std::vector<size_t>> DataFrameIndex::hashLookup(
+    const HashIndex& index,
+    const IColumnPtr& col,
+    const std::vector<std::string>& values
+) const {
+    auto stringCol = std::dynamic_pointer_cast<StringColumn>(col);
+
+    std::vector<size_t> rows;
+    for (const auto& value : values) {
+        int64_t key;
+        if (stringCol) {
+            // Chaîne absente du pool : aucune ligne (sans l'internaliser)
+            auto id = stringCol->getStringPool()->find(value);
+            if (id == StringPool::INVALID_ID) continue;
+            key = id;
+        } else {
+            key = std::stoi(value);
+        }
+
+        auto it = index.rows.find(key);
+        if (it != index.rows.end()) {
+            rows.insert(rows.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    // Chaque bucket est déjà croissant
+    if (values.size() > 1) {
+        sortUnique(rows);
+    }
+    return rows;
+}
+
+std::vector<size_t> DataFrameIndex::rangeLookup(
+    const SortedIndex& index,
+    const IColumnPtr& col,
+    const std::string& op,
+    const std::string& value
+) const {
+    const auto& perm = index.permutation;
+
+    return withTypedKey(col, value, [&](auto key, auto target) {
+        using Target = decltype(target);
+
+        auto validEnd = perm.end();
+        if constexpr (std::is_same_v<Target, double>) {
+            if (std::isnan(target)) return std::vector<size_t>{};
+            validEnd = std::partition_point(perm.begin(), perm.end(),
+                                            [&key](size_t row) { return !std::isnan(key(row)); });
+        }
+
+        auto lower = std::lower_bound(perm.begin(), validEnd, target,
+            [&key](size_t row, const Target& t) { return key(row) < t; });
+        auto upper = std::upper_bound(perm.begin(), validEnd, target,
+            [&key](const Target& t, size_t row) { return t < key(row); });
+
+        std::vector<size_t> rows;
+        if (op == "==") {
+            rows.assign(lower, upper);
+        } else if (op == "<") {
+            rows.assign(perm.begin(), lower);
+        } else if (op == "<=") {
+            rows.assign(perm.begin(), upper);
+        } else if (op == ">") {
+            rows.assign(upper, validEnd);
+        } else {
+            rows.assign(lower, validEnd);
+        }
+
+        // Retour à l'ordre des lignes, attendu par l'intersection des filtres
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    });
+}
+
+// ============================================================================
+// Opérations indexées
+// ============================================================================
+
+std::shared_ptr<DataFrame> DataFrameIndex::filter(const json& filterJson) {
+    auto probe = [this](const std::string& column, const std::string& op,
+                        const std::vector<std::string>& values) {
+        return lookup(column, op, values);
+    };
+    return m_df->filter(filterJson, probe);
+}
+
+std::shared_ptr<DataFrame> DataFrameIndex::orderBy(const json& orderJson) {
+    auto order = DataFrameSorter::parseSortOrder(orderJson);
+    if (order.size() != 1 || !m_df->hasColumn(order.front().column)) {
+        return nullptr;
+    }
+    if (m_df->isSortedBy(order)) {
+        return m_df->orderBy(orderJson);
+    }
+
+    const auto& key = order.front();
+    const SortedIndex* index = sortedIndex(key.column);
+    if (!index) {
+        return nullptr;
+    }
+
+    const auto& perm = index->permutation;
+    std::vector<size_t> indices;
+
+    if (key.ascending) {
+        indices = perm;
+    } else {
+        // Descendant stable : blocs de valeurs égales parcourus à l'envers,
+        // lignes d'un même bloc dans l'ordre d'origine
+        indices.reserve(perm.size());
+        auto col = m_df->getColumn(key.column);
+        withTypedKey(col, "0", [&](auto value, auto) {
+            size_t end = perm.size();
+            while (end > 0) {
+                size_t start = end - 1;
+                while (start > 0 && !(value(perm[start - 1]) < value(perm[end - 1]))) {
+                    --start;
+                }
+                indices.insert(indices.end(), perm.begin() + start, perm.begin() + end);
+                end = start;
+            }
+            return 0;
+        });
+    }
+
+    auto result = std::make_shared<DataFrame>();
+    result->m_string_pool = m_df->m_string_pool;
+    for (const auto& colName : m_df->m_columnOrder) {
+        result->addColumn(m_df->getColumn(colName)->filterByIndices(indices));
+    }
+    result->m_sortedBy = DataFrameSorter::combine(order, m_df->m_sortedBy);
+
+    return result;
+}
+
+// ============================================================================
+// Sérialisation
+// ============================================================================
+
+void DataFrameIndex::save(std::ostream& out) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    out.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    writeRaw<uint32_t>(out, FORMAT_VERSION);
+    writeRaw<uint64_t>(out, m_df->rowCount());
+
+    writeRaw<uint64_t>(out, m_hash.size());
+    for (const auto& [name, index] : m_hash) {
+        writeString(out, name);
+        auto stringCol = std::dynamic_pointer_cast<StringColumn>(m_df->getColumn(name));
+        writeRaw<uint64_t>(out, index.rows.size());
+        for (const auto& [key, rows] : index.rows) {
+            if (stringCol) {
+                writeString(out, stringCol->getStringPool()->getString(static_cast<StringPool::StringId>(key)));
+            } else {
+                writeRaw<int64_t>(out, key);
+            }
+            writeRows(out, rows);
+        }
+    }
+
+    writeRaw<uint64_t>(out, m_sorted.size());
+    for (const auto& [name, index] : m_sorted) {
+        writeString(out, name);
+        writeRows(out, index.permutation);
+    }
+
+    // Un index par pool, même partagé par plusieurs colonnes
+    std::vector<const StringPool*> saved;
+    writeRaw<uint64_t>(out, m_trigram.size());
+    for (const auto& name : m_trigram) {
+        writeString(out, name);
+        auto pool = std::static_pointer_cast<StringColumn>(m_df->getColumn(name))->getStringPool();
+        auto trigram = pool->getTrigramIndex();
+        bool first = std::find(saved.begin(), saved.end(), pool.get()) == saved.end();
+        writeRaw<uint8_t>(out, trigram && first ? 1 : 0);
+        if (trigram && first) {
+            trigram->save(out);
+            saved.push_back(pool.get());
+        }
+    }
+
+    if (!out) {
+        throw std::runtime_error("Cannot write dataframe index");
+    }
+}
+
+void DataFrameIndex::load(std::istream& in) {
+    char magic[4];
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error("Invalid dataframe index header");
+    }
+    auto version = readRaw<uint32_t>(in);
+    if (version != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported dataframe index version " + std::to_string(version));
+    }
+    size_t rowCount = m_df->rowCount();
+    if (readRaw<uint64_t>(in) != rowCount) {
+        throw std::runtime_error("Dataframe index does not match the row count");
+    }
+
+    auto column = [this](const std::string& name) {
+        if (!m_df->hasColumn(name)) {
+            throw std::runtime_error("Dataframe index refers to unknown column: " + name);
+        }
+        return m_df->getColumn(name);
+    };
+
+    // Tout est lu avant d'être adopté : un fichier invalide ne laisse rien
+    std::unordered_map<std::string, HashIndex> hash;
+    auto hashCount = readRaw<uint64_t>(in);
+    for (uint64_t h = 0; h < hashCount; ++h) {
+        std::string name = readString(in);
+        auto col = column(name);
+        if (col->getType() == ColumnTypeOpt::DOUBLE) {
+            throw std::runtime_error("Hash index not supported on double column: " + name);
+        }
+        auto stringCol = std::dynamic_pointer_cast<StringColumn>(col);
+
+        HashIndex index;
+        auto keyCount = readRaw<uint64_t>(in);
+        if (keyCount > rowCount) {
+            throw std::runtime_error("Corrupted dataframe index");
+        }
+        for (uint64_t k = 0; k < keyCount; ++k) {
+            int64_t key;
+            if (stringCol) {
+                auto id = stringCol->getStringPool()->find(readString(in));
+                if (id == StringPool::INVALID_ID) {
+                    throw std::runtime_error("Dataframe index does not match column: " + name);
+                }
+                key = id;
+            } else {
+                key = readRaw<int64_t>(in);
+            }
+            index.rows[key] = readRows(in, rowCount);
+        }
+        hash.emplace(std::move(name), std::move(index));
+    }
+
+    std::unordered_map<std::string, SortedIndex> sorted;
+    auto sortedCount = readRaw<uint64_t>(in);
+    for (uint64_t s = 0; s < sortedCount; ++s) {
+        std::string name = readString(in);
+        column(name);
+        SortedIndex index;
+        index.permutation = readRows(in, rowCount);
+        if (index.permutation.size() != rowCount) {
+            throw std::runtime_error("Corrupted dataframe index");
+        }
+        sorted.emplace(std::move(name), std::move(index));
+    }
+
+    std::vector<std::pair<std::string, std::shared_ptr<TrigramIndex>>> trigram;
+    auto trigramCount = readRaw<uint64_t>(in);
+    for (uint64_t t = 0; t < trigramCount; ++t) {
+        std::string name = readString(in);
+        if (column(name)->getType() != ColumnTypeOpt::STRING) {
+            throw std::runtime_error("Trigram index requires a string column: " + name);
+        }
+        std::shared_ptr<TrigramIndex> loaded;
+        if (readRaw<uint8_t>(in)) {
+            loaded = TrigramIndex::load(in);
+        }
+        trigram.emplace_back(std::move(name), std::move(loaded));
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (auto& [name, index] : hash) {
+        m_hash.try_emplace(name, std::move(index));
+    }
+    for (auto& [name, index] : sorted) {
+        m_sorted.try_emplace(name, std::move(index));
+    }
+    for (const auto& [name, loaded] : trigram) {
+        // forPool n'adopte l'index chargé que s'il décrit bien le pool
+        auto col = m_df->getColumn(name);
+        auto pool = std::static_pointer_cast<StringColumn>(col)->getStringPool();
+        if (loaded && !pool->getTrigramIndex()) {
+            pool->setTrigramIndex(loaded);
+        }
+        enableTrigram(col);
+        if (std::find(m_trigram.begin(), m_trigram.end(), name) == m_trigram.end()) {
+            m_trigram.push_back(name);
+        }
+    }
+}
+
+// ============================================================================
+// Statistiques
+// ============================================================================
+
+size_t DataFrameIndex::memoryUsage() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    size_t total = 0;
+    for (const auto& [name, index] : m_hash) {
+        for (const auto& [key, rows] : index.rows) {
+            total += sizeof(key) + rows.capacity() * sizeof(size_t);
+        }
+    }
+    for (const auto& [name, index] : m_sorted) {
+        total += index.permutation.capacity() * sizeof(size_t);
+    }
+    return total;
+}
+
+json DataFrameIndex::stats() const {
+    json indexes = json::array();
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for (const auto& [name, index] : m_hash) {
+        indexes.push_back({{"column", name}, {"kind", "hash"}, {"keys", index.rows.size()}});
+    }
+    for (const auto& [name, index] : m_sorted) {
+        indexes.push_back({{"column", name}, {"kind", "sorted"}, {"rows", index.permutation.size()}});
+    }
+    for (const auto& name : m_trigram) {
+        auto pool = std::static_pointer_cast<StringColumn>(m_df->getColumn(name))->getStringPool();
+        auto trigram = pool->getTrigramIndex();
+        indexes.push_back({{"column", name}, {"kind", "trigram"},
+                           {"strings", trigram ? trigram->indexedCount() : 0},
+                           {"memory_bytes", trigram ? trigram->memoryUsage() : 0}});
+    }
+    lock.unlock();
+    return {
+        {"auto_build", m_autoBuild},
+        {"memory_bytes", memoryUsage()},
+        {"indexes", indexes}
+    };
+}
+
+} // namespace dataframe
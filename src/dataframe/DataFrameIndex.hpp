@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Column.hpp"
+#include "DataFrameSorter.hpp"
+#include <nlohmann/json.hpp>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dataframe {
+
+using json = nlohmann::json;
+
+class DataFrame;
+
+/**
+ * Index secondaires sur un DataFrame immuable (ex: dataset du serveur)
+ *
+ * - Hash : valeur (int ou StringId) → lignes, pour == et in
+ * - Trié : permutation stable des lignes par valeur croissante,
+ *          pour <, <=, >, >= et orderBy sur une clef
+ * - Trigramme : active le TrigramIndex du StringPool de la colonne, utilisé
+ *          par contains / icontains (colonnes string à forte cardinalité)
+ *
+ * Les index sont construits explicitement (build) ou paresseusement au
+ * premier prédicat qui en a besoin (autoBuild). Le DataFrame indexé ne doit
+ * plus être modifié : en cas de rechargement, recréer le DataFrameIndex.
+ *
+ * Thread-safe : les requêtes concurrentes lisent sous verrou partagé ; une
+ * construction paresseuse se fait hors verrou puis est publiée sous verrou
+ * exclusif (un index publié n'est jamais modifié ni retiré).
+ */
+class DataFrameIndex {
+public:
+    enum class Kind { Hash, Sorted, Trigram };
+    using Spec = std::vector<std::pair<std::string, Kind>>;
+
+    explicit DataFrameIndex(std::shared_ptr<const DataFrame> df, bool autoBuild = true);
+
+    /**
+     * Parse une liste d'index, ex: "region:hash, amount:sorted, email:trigram, id"
+     * (hash par défaut). Lève std::runtime_error sur un type inconnu.
+     */
+    static Spec parseSpec(const std::string& spec);
+
+    // Construction explicite (lève std::runtime_error si colonne absente,
+    // index hash sur une colonne double ou trigramme hors colonne string)
+    void build(const std::string& column, Kind kind);
+    bool has(const std::string& column, Kind kind) const;
+
+    /**
+     * Lignes (croissantes) vérifiant `column op values`, ou nullopt si le
+     * prédicat n'est pas indexable (opérateur, type, index absent sans autoBuild)
+     */
+    std::optional<std::vector<size_t>> lookup(
+        const std::string& column,
+        const std::string& op,
+        const std::vector<std::string>& values
+    );
+
+    // Filtre : prédicats indexés d'abord, les autres sur les candidats restants
+    std::shared_ptr<DataFrame> filter(const json& filterJson);
+
+    // Tri sur une seule clef via l'index trié, nullptr si non couvert
+    std::shared_ptr<DataFrame> orderBy(const json& orderJson);
+
+    size_t memoryUsage() const;
+    json stats() const;
+
+    /**
+     * Sérialisation des index construits, persistés avec le snapshot du dataset
+     *
+     * Les index hash/trié référencent des numéros de ligne : load() doit
+     * recevoir les index du même contenu (ex: frame restauré du snapshot).
+     * Les clefs string sont écrites en clair, les trigrammes via
+     * TrigramIndex::save (revérifiés par TrigramIndex::forPool).
+     * load() lève std::runtime_error (en-tête, version, colonne ou nombre de
+     * lignes incompatibles) sans modifier les index existants.
+     */
+    void save(std::ostream& out) const;
+    void load(std::istream& in);
+
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+private:
+    struct HashIndex {
+        // Clef : valeur int ou StringId
+        std::unordered_map<int64_t, std::vector<size_t>> rows;
+    };
+
+    struct SortedIndex {
+        std::vector<size_t> permutation;
+    };
+
+    void enableTrigram(const IColumnPtr& col);
+
+    const HashIndex* hashIndex(const std::string& column);
+    const SortedIndex* sortedIndex(const std::string& column);
+
+    std::optional<std::vector<size_t>> hashLookup(
+        const HashIndex& index,
+        const IColumnPtr& col,
+        const std::vector<std::string>& values
+    ) const;
+
+    std::vector<size_t> rangeLookup(
+        const SortedIndex& index,
+        const IColumnPtr& col,
+        const std::string& op,
+        const std::string& value
+    ) const;
+
+    std::shared_ptr<const DataFrame> m_df;
+    bool m_autoBuild;
+    mutable std::shared_mutex m_mutex;  // Protège m_hash, m_sorted, m_trigram
+    std::unordered_map<std::string, HashIndex> m_hash;
+    std::unordered_map<std::string, SortedIndex> m_sorted;
+    std::vector<std::string> m_trigram;
+};
+
+} // namespace dataframe
@@ -1,5 +1,6 @@
 #include "DataFrameJoiner.hpp"
 #include "DataFrame.hpp"
+#include "Cancellation.hpp"
 #include <cstring>
 #include <stdexcept>
 
@@ -84,6 +85,7 @@ DataFrameJoiner::JoinHashTable DataFrameJoiner::buildHashTable(
     table.reserve(rowCount);
 
     for (size_t i = 0; i < rowCount; ++i) {
+        checkCancelled(i);
         JoinKey key;
         key.values.reserve(keyCols.size());
 
@@ -239,6 +241,7 @@ DataFrameJoiner::DataFramePtr DataFrameJoiner::innerJoin(
     }
 
     for (size_t probeIdx = 0; probeIdx < probeRowCount; ++probeIdx) {
+        checkCancelled(probeIdx);
         // Construire la clef probe
         JoinKey probeKey;
         probeKey.values.reserve(probeKeys.size());
@@ -426,6 +429,7 @@ DataFrameJoiner::FlexJoinResult DataFrameJoiner::flexJoin(
 
     // 10. Boucle principale
     for (size_t leftIdx = 0; leftIdx < leftRowCount; ++leftIdx) {
+        checkCancelled(leftIdx);
         // Construire la clef
         JoinKey probeKey;
         probeKey.values.reserve(leftKeys.size());
@@ -1,5 +1,6 @@
 #include "DataFrameSerializer.hpp"
 #include "DataFrame.hpp"
+#include "JsonWriter.hpp"
 #include <sstream>
 #include <algorithm>
 #include <stdexcept>
@@ -27,17 +28,15 @@ std::string DataFrameSerializer::toString(
 
     // Rows
     size_t displayRows = std::min(rowCount, maxRows);
+    std::vector<IColumnPtr> columns;
+    columns.reserve(columnOrder.size());
+    for (const auto& colName : columnOrder) {
+        columns.push_back(getColumn(colName));
+    }
+
     for (size_t i = 0; i < displayRows; ++i) {
-        for (const auto& colName : columnOrder) {
-            auto col = getColumn(colName);
-
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                oss << intCol->at(i);
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                oss << doubleCol->at(i);
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                oss << stringCol->at(i);
-            }
+        for (const auto& col : columns) {
+            visitColumn(*col, [&](const auto& typed) { oss << typed.at(i); });
             oss << "\t";
         }
         oss << "\n";
@@ -59,27 +58,64 @@ json DataFrameSerializer::toJson(
     json result = json::object();
     result["columns"] = columnOrder;
 
+    result["data"] = rowsToJson(0, rowCount, columnOrder, getColumn);
+    return result;
+}
+
+json DataFrameSerializer::rowsToJson(
+    size_t beginRow,
+    size_t endRow,
+    const std::vector<std::string>& columnOrder,
+    const ColumnGetter& getColumn
+) {
     json data = json::array();
-    for (size_t i = 0; i < rowCount; ++i) {
-        json row = json::array();
-
-        for (const auto& colName : columnOrder) {
-            auto col = getColumn(colName);
-
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                row.push_back(intCol->at(i));
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                row.push_back(doubleCol->at(i));
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                row.push_back(stringCol->at(i));
-            }
-        }
+    if (endRow <= beginRow) {
+        return data;
+    }
 
-        data.push_back(row);
+    // Lignes pré-allouées, puis remplies colonne par colonne : le type n'est
+    // résolu qu'une fois par colonne, pas à chaque cellule
+    auto& rows = data.get_ref<json::array_t&>();
+    rows.resize(endRow - beginRow, json::array());
+    for (auto& row : rows) {
+        row.get_ref<json::array_t&>().reserve(columnOrder.size());
     }
 
-    result["data"] = data;
-    return result;
+    for (const auto& colName : columnOrder) {
+        auto col = getColumn(colName);
+        visitColumn(*col, [&](const auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            if constexpr (std::is_same_v<Col, StringColumn>) {
+                const auto& pool = *typed.getStringPool();
+                size_t count = endRow - beginRow;
+                if (pool.size() > count) {
+                    // Petite page sur un grand dictionnaire : conversion directe
+                    for (size_t i = beginRow; i < endRow; ++i) {
+                        rows[i - beginRow].get_ref<json::array_t&>().emplace_back(typed.at(i));
+                    }
+                    return;
+                }
+                // Une string JSON par StringId distinct, copiée ensuite
+                std::vector<json> cache(pool.size());
+                std::vector<bool> built(pool.size(), false);
+                for (size_t i = beginRow; i < endRow; ++i) {
+                    auto id = typed.getId(i);
+                    if (!built[id]) {
+                        cache[id] = pool.getString(id);
+                        built[id] = true;
+                    }
+                    rows[i - beginRow].get_ref<json::array_t&>().push_back(cache[id]);
+                }
+            } else {
+                const auto& values = typed.data();
+                for (size_t i = beginRow; i < endRow; ++i) {
+                    rows[i - beginRow].get_ref<json::array_t&>().emplace_back(values[i]);
+                }
+            }
+        });
+    }
+
+    return data;
 }
 
 std::string DataFrameSerializer::columnTypeToString(ColumnTypeOpt type) {
@@ -97,15 +133,10 @@ ColumnTypeOpt DataFrameSerializer::stringToColumnType(const std::string& typeStr
     return ColumnTypeOpt::STRING;
 }
 
-json DataFrameSerializer::toJsonWithSchema(
-    size_t rowCount,
+json DataFrameSerializer::schemaToJson(
     const std::vector<std::string>& columnOrder,
     const ColumnGetter& getColumn
 ) {
-    json result = json::object();
-    result["columns"] = columnOrder;
-
-    // Build schema with column types
     json schema = json::array();
     for (const auto& colName : columnOrder) {
         auto col = getColumn(colName);
@@ -114,30 +145,36 @@ json DataFrameSerializer::toJsonWithSchema(
         colSchema["type"] = columnTypeToString(col->getType());
         schema.push_back(colSchema);
     }
-    result["schema"] = schema;
+    return schema;
+}
 
-    // Build data array
-    json data = json::array();
-    for (size_t i = 0; i < rowCount; ++i) {
-        json row = json::array();
-
-        for (const auto& colName : columnOrder) {
-            auto col = getColumn(colName);
-
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                row.push_back(intCol->at(i));
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                row.push_back(doubleCol->at(i));
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                row.push_back(stringCol->at(i));
-            }
-        }
+json DataFrameSerializer::toJsonWithSchema(
+    size_t rowCount,
+    const std::vector<std::string>& columnOrder,
+    const ColumnGetter& getColumn
+) {
+    json result = json::object();
+    result["columns"] = columnOrder;
+    result["schema"] = schemaToJson(columnOrder, getColumn);
+    result["data"] = rowsToJson(0, rowCount, columnOrder, getColumn);
+    return result;
+}
 
-        data.push_back(row);
+void DataFrameSerializer::writeWithSchema(
+    JsonWriter& out,
+    size_t rowCount,
+    const std::vector<std::string>& columnOrder,
+    const ColumnGetter& getColumn
+) {
+    out.beginObject();
+    out.key("columns").beginArray();
+    for (const auto& name : columnOrder) {
+        out.value(name);
     }
-
-    result["data"] = data;
-    return result;
+    out.endArray();
+    out.key("schema").value(schemaToJson(columnOrder, getColumn));
+    out.key("data").rows(0, rowCount, columnOrder, getColumn);
+    out.endObject();
 }
 
 DataFramePtr DataFrameSerializer::fromJson(const json& j) {
@@ -198,55 +235,58 @@ DataFramePtr DataFrameSerializer::fromJson(const json& j) {
         }
     }
 
-    // Populate data
-    for (const auto& row : data) {
-        if (!row.is_array()) continue;
-
-        for (size_t i = 0; i < columns.size() && i < row.size(); ++i) {
-            std::string colName = columns[i].get<std::string>();
-            auto col = df->getColumn(colName);
-            const auto& val = row[i];
-
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                if (val.is_number_integer()) {
-                    intCol->push_back(val.get<int>());
-                } else if (val.is_number()) {
-                    intCol->push_back(static_cast<int>(val.get<double>()));
-                } else if (val.is_string()) {
-                    try {
-                        intCol->push_back(std::stoi(val.get<std::string>()));
-                    } catch (...) {
-                        intCol->push_back(0);
+    // Populate data : une passe typée par colonne
+    for (size_t i = 0; i < columns.size(); ++i) {
+        auto col = df->getColumn(columns[i].get<std::string>());
+        col->reserve(data.size());
+
+        visitColumn(*col, [&](auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            for (const auto& row : data) {
+                if (!row.is_array() || i >= row.size()) continue;
+                const auto& val = row[i];
+
+                if constexpr (std::is_same_v<Col, IntColumn>) {
+                    if (val.is_number_integer()) {
+                        typed.push_back(val.template get<int>());
+                    } else if (val.is_number()) {
+                        typed.push_back(static_cast<int>(val.template get<double>()));
+                    } else if (val.is_string()) {
+                        try {
+                            typed.push_back(std::stoi(val.template get<std::string>()));
+                        } catch (...) {
+                            typed.push_back(0);
+                        }
+                    } else {
+                        typed.push_back(0);
                     }
-                } else {
-                    intCol->push_back(0);
-                }
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                if (val.is_number()) {
-                    doubleCol->push_back(val.get<double>());
-                } else if (val.is_string()) {
-                    try {
-                        doubleCol->push_back(std::stod(val.get<std::string>()));
-                    } catch (...) {
-                        doubleCol->push_back(0.0);
+                } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                    if (val.is_number()) {
+                        typed.push_back(val.template get<double>());
+                    } else if (val.is_string()) {
+                        try {
+                            typed.push_back(std::stod(val.template get<std::string>()));
+                        } catch (...) {
+                            typed.push_back(0.0);
+                        }
+                    } else {
+                        typed.push_back(0.0);
                     }
                 } else {
-                    doubleCol->push_back(0.0);
-                }
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                if (val.is_string()) {
-                    stringCol->push_back(val.get<std::string>());
-                } else if (val.is_number_integer()) {
-                    stringCol->push_back(std::to_string(val.get<int>()));
-                } else if (val.is_number()) {
-                    stringCol->push_back(std::to_string(val.get<double>()));
-                } else if (val.is_null()) {
-                    stringCol->push_back("");
-                } else {
-                    stringCol->push_back(val.dump());
+                    if (val.is_string()) {
+                        typed.push_back(val.template get_ref<const std::string&>());
+                    } else if (val.is_number_integer()) {
+                        typed.push_back(std::to_string(val.template get<int>()));
+                    } else if (val.is_number()) {
+                        typed.push_back(std::to_string(val.template get<double>()));
+                    } else if (val.is_null()) {
+                        typed.push_back("");
+                    } else {
+                        typed.push_back(val.dump());
+                    }
                 }
             }
-        }
+        });
     }
 
     return df;
@@ -10,6 +10,7 @@
 namespace dataframe {
 
 class DataFrame;
+class JsonWriter;
 using DataFramePtr = std::shared_ptr<DataFrame>;
 
 using json = nlohmann::json;
@@ -34,6 +35,18 @@ public:
         const ColumnGetter& getColumn
     );
 
+    /**
+     * Lignes [beginRow, endRow) au format "data" : [[...], [...]]
+     * Remplissage colonne par colonne (une boucle typée par colonne,
+     * voir visitColumn) ; utilisé par toJson et la pagination du serveur
+     */
+    static json rowsToJson(
+        size_t beginRow,
+        size_t endRow,
+        const std::vector<std::string>& columnOrder,
+        const ColumnGetter& getColumn
+    );
+
     /**
      * Serialize DataFrame with schema (column types) for persistence
      * Format:
@@ -49,6 +62,24 @@ public:
         const ColumnGetter& getColumn
     );
 
+    /**
+     * Même document que toJsonWithSchema, écrit en flux dans out (sans DOM)
+     */
+    static void writeWithSchema(
+        JsonWriter& out,
+        size_t rowCount,
+        const std::vector<std::string>& columnOrder,
+        const ColumnGetter& getColumn
+    );
+
+    /**
+     * Schéma seul : [{"name": "col1", "type": "INT"}, ...]
+     */
+    static json schemaToJson(
+        const std::vector<std::string>& columnOrder,
+        const ColumnGetter& getColumn
+    );
+
     /**
      * Deserialize DataFrame from JSON with schema
      * Reconstructs typed columns based on schema information
@@ -1,6 +1,9 @@
 #include "DataFrameSorter.hpp"
+#include "Cancellation.hpp"
 #include <algorithm>
 #include <numeric>
+#include <sstream>
+#include <cctype>
 
 namespace dataframe {
 
@@ -16,6 +19,107 @@ std::vector<size_t> DataFrameSorter::getSortedIndices(
         return indices;
     }
 
+    auto comparators = buildComparators(parseSortOrder(orderJson), getColumn);
+
+    // Tri stable optimisé (annulable : le jeton est consulté toutes les CANCEL_CHECK_ROWS comparaisons)
+    size_t comparisons = 0;
+    std::stable_sort(indices.begin(), indices.end(), [&comparators, &comparisons](size_t a, size_t b) -> bool {
+        checkCancelled(comparisons++);
+        for (const auto& cmp : comparators) {
+            int result = cmp(a, b);
+            if (result != 0) {
+                return result < 0;
+            }
+        }
+        return false;
+    });
+
+    return indices;
+}
+
+SortOrder DataFrameSorter::parseSortOrder(const json& orderJson) {
+    SortOrder order;
+    if (!orderJson.is_array()) {
+        return order;
+    }
+
+    order.reserve(orderJson.size());
+    for (const auto& orderItem : orderJson) {
+        std::string direction = orderItem.value("order", "asc");
+        order.push_back({
+            orderItem["column"].get<std::string>(),
+            direction == "asc" || direction == "ascending"
+        });
+    }
+    return order;
+}
+
+SortOrder DataFrameSorter::parseSortSpec(const std::string& spec) {
+    SortOrder order;
+    std::istringstream items(spec);
+    std::string item;
+
+    while (std::getline(items, item, ',')) {
+        std::istringstream tokens(item);
+        std::string column;
+        std::string direction;
+        if (!(tokens >> column)) {
+            continue;
+        }
+        tokens >> direction;
+        std::transform(direction.begin(), direction.end(), direction.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        order.push_back({column, direction != "desc" && direction != "descending"});
+    }
+    return order;
+}
+
+bool DataFrameSorter::isSorted(
+    const SortOrder& order,
+    size_t rowCount,
+    const ColumnGetter& getColumn
+) {
+    if (order.empty()) {
+        return false;
+    }
+
+    auto comparators = buildComparators(order, getColumn);
+
+    for (size_t i = 1; i < rowCount; ++i) {
+        for (const auto& cmp : comparators) {
+            int result = cmp(i - 1, i);
+            if (result < 0) break;        // strictement ordonné sur cette clef
+            if (result > 0) return false; // inversion
+        }
+    }
+    return true;
+}
+
+bool DataFrameSorter::isPrefix(const SortOrder& prefix, const SortOrder& order) {
+    if (prefix.empty() || prefix.size() > order.size()) {
+        return false;
+    }
+    return std::equal(prefix.begin(), prefix.end(), order.begin());
+}
+
+SortOrder DataFrameSorter::combine(const SortOrder& primary, const SortOrder& previous) {
+    SortOrder result = primary;
+    for (const auto& key : previous) {
+        // Une colonne déjà présente dans primary est constante dans chaque
+        // groupe d'égalité : elle n'apporte aucune information supplémentaire
+        bool alreadyKey = std::any_of(primary.begin(), primary.end(),
+            [&key](const SortKey& k) { return k.column == key.column; });
+        if (!alreadyKey) {
+            result.push_back(key);
+        }
+    }
+    return result;
+}
+
+std::vector<DataFrameSorter::CompareFn> DataFrameSorter::buildComparators(
+    const SortOrder& order,
+    const ColumnGetter& getColumn
+) {
     // Comparateurs inline sans branches
     auto cmp_int_asc = [](int a, int b) -> int {
         return (a > b) - (a < b);
@@ -30,21 +134,14 @@ std::vector<size_t> DataFrameSorter::getSortedIndices(
         return (a < b) - (a > b);
     };
 
-    using CompareFn = std::function<int(size_t, size_t)>;
     std::vector<CompareFn> comparators;
-    comparators.reserve(orderJson.size());
+    comparators.reserve(order.size());
 
-    // Garder les shared_ptr vivants pendant le tri
-    std::vector<IColumnPtr> columnPtrs;
-    columnPtrs.reserve(orderJson.size());
-
-    for (const auto& orderItem : orderJson) {
-        std::string colName = orderItem["column"];
-        std::string order = orderItem["order"];
-        bool ascending = (order == "asc" || order == "ascending");
+    for (const auto& key : order) {
+        bool ascending = key.ascending;
 
-        auto col = getColumn(colName);
-        columnPtrs.push_back(col);
+        // Les lambdas capturent le shared_ptr : la colonne reste vivante pendant le tri
+        auto col = getColumn(key.column);
 
         // Créer le comparateur spécialisé selon le type
         if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
@@ -85,18 +182,7 @@ std::vector<size_t> DataFrameSorter::getSortedIndices(
         }
     }
 
-    // Tri stable optimisé
-    std::stable_sort(indices.begin(), indices.end(), [&comparators](size_t a, size_t b) -> bool {
-        for (const auto& cmp : comparators) {
-            int result = cmp(a, b);
-            if (result != 0) {
-                return result < 0;
-            }
-        }
-        return false;
-    });
-
-    return indices;
+    return comparators;
 }
 
-} // namespace dataframe
\ No newline at end of file
+} // namespace dataframe
@@ -11,6 +11,21 @@ namespace dataframe {
 
 using json = nlohmann::json;
 
+/**
+ * Clef de tri : une colonne et sa direction
+ */
+struct SortKey {
+    std::string column;
+    bool ascending = true;
+
+    bool operator==(const SortKey& other) const = default;
+};
+
+/**
+ * Ordre de tri complet (clef principale en premier)
+ */
+using SortOrder = std::vector<SortKey>;
+
 /**
  * Responsabilité unique : tri des DataFrames
  */
@@ -23,6 +38,45 @@ public:
         size_t rowCount,
         const ColumnGetter& getColumn
     );
+
+    /**
+     * Parse le format JSON de orderBy: [{"column": "a", "order": "asc"}, ...]
+     */
+    static SortOrder parseSortOrder(const json& orderJson);
+
+    /**
+     * Parse une spécification texte façon ORDER BY: "region, amount desc"
+     */
+    static SortOrder parseSortSpec(const std::string& spec);
+
+    /**
+     * Vérifie en une passe linéaire que les lignes respectent l'ordre donné
+     * (utilisé pour valider un tri déclaré par un loader)
+     */
+    static bool isSorted(
+        const SortOrder& order,
+        size_t rowCount,
+        const ColumnGetter& getColumn
+    );
+
+    /**
+     * Vrai si `prefix` est un préfixe de `order` (mêmes colonnes, mêmes directions)
+     */
+    static bool isPrefix(const SortOrder& prefix, const SortOrder& order);
+
+    /**
+     * Ordre obtenu après un tri stable sur `primary` d'un DataFrame déjà trié
+     * par `previous` : les égalités sur `primary` conservent l'ordre précédent.
+     */
+    static SortOrder combine(const SortOrder& primary, const SortOrder& previous);
+
+private:
+    using CompareFn = std::function<int(size_t, size_t)>;
+
+    static std::vector<CompareFn> buildComparators(
+        const SortOrder& order,
+        const ColumnGetter& getColumn
+    );
 };
 
 } // namespace dataframe
\ No newline at end of file
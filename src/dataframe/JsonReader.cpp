@@ -0,0 +1,433 @@
+#include "JsonReader.hpp"
+#include "DataFrameSerializer.hpp"
+#include <nlohmann/json.hpp>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dataframe {
+
+namespace {
+
+using json = nlohmann::json;
+using StringId = StringPool::StringId;
+
+int toInt(const std::string& str) {
+    try {
+        return std::stoi(str);
+    } catch (...) {
+        return 0;
+    }
+}
+
+double toDouble(const std::string& str) {
+    try {
+        return std::stod(str);
+    } catch (...) {
+        return 0.0;
+    }
+}
+
+// Valeurs d'une colonne en cours de lecture
+struct ColumnBuilder {
+    std::optional<ColumnTypeOpt> type;  // Pas encore de valeur : type inconnu
+    bool fixed = false;                 // Type imposé par le schéma : pas de promotion
+    std::vector<int> ints;
+    std::vector<double> doubles;
+    std::vector<StringId> ids;
+
+    size_t size() const { return ints.size() + doubles.size() + ids.size(); }
+};
+
+/**
+ * Handler SAX : une pile de contextes indique où se trouve chaque token
+ */
+class FrameHandler {
+public:
+    FrameHandler(std::string_view member, bool dataOnly)
+        : m_member(member), m_dataOnly(dataOnly), m_df(std::make_shared<DataFrame>()) {}
+
+    // Colonnes et types connus avant "data" (champs séparés)
+    void preset(std::vector<std::string> names, std::vector<ColumnTypeOpt> types) {
+        m_names = std::move(names);
+        m_types = std::move(types);
+        m_columnsSeen = true;
+        m_schemaSeen = true;
+    }
+
+    std::shared_ptr<DataFrame> finish();
+
+    // --- Interface SAX nlohmann ---
+
+    bool null() {
+        return scalar([&] { cellText("", true); }, [&] { return json(nullptr); });
+    }
+
+    bool boolean(bool value) {
+        return scalar([&] { cellText(value ? "true" : "false", false); }, [&] { return json(value); });
+    }
+
+    bool number_integer(json::number_integer_t value) {
+        return scalar([&] { cellInteger(value); }, [&] { return json(value); });
+    }
+
+    bool number_unsigned(json::number_unsigned_t value) {
+        return scalar([&] {
+            if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                cellInteger(static_cast<int64_t>(value));
+            } else {
+                cellDouble(static_cast<double>(value));
+            }
+        }, [&] { return json(value); });
+    }
+
+    bool number_float(json::number_float_t value, const json::string_t&) {
+        return scalar([&] { cellDouble(value); }, [&] { return json(value); });
+    }
+
+    bool string(json::string_t& value) {
+        Context parent = top();
+        if (parent == Context::Columns) {
+            m_names.push_back(value);
+        } else if (parent == Context::SchemaEntry && m_key == "type") {
+            m_types.back() = DataFrameSerializer::stringToColumnType(value);
+        } else if (parent == Context::Row) {
+            cellString(value);
+        } else if (parent == Context::Nested) {
+            nestedValue(json(std::move(value)));
+        }
+        return true;
+    }
+
+    bool binary(json::binary_t&) { return true; }
+
+    bool start_object(std::size_t) { return open(false); }
+    bool end_object() { return close(); }
+    bool start_array(std::size_t) { return open(true); }
+    bool end_array() { return close(); }
+
+    bool key(json::string_t& name) {
+        if (top() == Context::Nested) {
+            m_nestedKeys.back() = std::move(name);
+        } else {
+            m_key = std::move(name);
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const json::exception& e) {
+        throw std::runtime_error(std::string("Invalid DataFrame JSON: ") + e.what());
+    }
+
+private:
+    enum class Context { None, Root, Doc, Columns, Schema, SchemaEntry, Data, Row, Nested, Skip };
+
+    Context top() const { return m_stack.empty() ? Context::None : m_stack.back(); }
+
+    // Scalaire : cellule, valeur imbriquée, ou ignoré
+    template<typename Cell, typename Value>
+    bool scalar(Cell&& cell, Value&& value) {
+        Context parent = top();
+        if (parent == Context::Row) {
+            cell();
+        } else if (parent == Context::Nested) {
+            nestedValue(value());
+        }
+        return true;
+    }
+
+    bool open(bool isArray) {
+        Context parent = top();
+        Context child = Context::Skip;
+        switch (parent) {
+            case Context::None:
+                if (m_dataOnly) {
+                    child = isArray ? Context::Data : Context::Skip;
+                } else if (!isArray) {
+                    child = m_member.empty() ? Context::Doc : Context::Root;
+                }
+                break;
+            case Context::Root:
+                if (!isArray && m_key == m_member) child = Context::Doc;
+                break;
+            case Context::Doc:
+                if (isArray && m_key == "columns") {
+                    child = Context::Columns;
+                    m_names.clear();
+                    m_columnsSeen = true;
+                } else if (isArray && m_key == "schema") {
+                    child = Context::Schema;
+                    m_types.clear();
+                    m_schemaSeen = true;
+                } else if (isArray && m_key == "data") {
+                    child = Context::Data;
+                }
+                break;
+            case Context::Schema:
+                if (!isArray) {
+                    child = Context::SchemaEntry;
+                    m_types.push_back(ColumnTypeOpt::STRING);
+                    m_key.clear();
+                }
+                break;
+            case Context::Data:
+                if (isArray) {
+                    child = Context::Row;
+                    m_cell = 0;
+                }
+                break;
+            case Context::Row:
+            case Context::Nested:
+                // Valeur composée dans une cellule : reconstruite puis dump()
+                child = Context::Nested;
+                m_nested.push_back(isArray ? json::array() : json::object());
+                m_nestedKeys.emplace_back();
+                break;
+            default:
+                break;
+        }
+        if (child == Context::Data) m_dataSeen = true;
+        m_stack.push_back(child);
+        return true;
+    }
+
+    bool close() {
+        Context closed = top();
+        m_stack.pop_back();
+        if (closed == Context::Row) {
+            ++m_rows;
+        } else if (closed == Context::Nested) {
+            json value = std::move(m_nested.back());
+            m_nested.pop_back();
+            m_nestedKeys.pop_back();
+            if (m_nested.empty()) {
+                cellText(value.dump(), false);
+            } else {
+                nestedValue(std::move(value));
+            }
+        }
+        return true;
+    }
+
+    void nestedValue(json value) {
+        auto& parent = m_nested.back();
+        if (parent.is_array()) {
+            parent.push_back(std::move(value));
+        } else {
+            parent[m_nestedKeys.back()] = std::move(value);
+        }
+    }
+
+    // Colonne de la cellule courante, complétée jusqu'à la ligne courante
+    ColumnBuilder& builder(ColumnTypeOpt firstType) {
+        size_t index = m_cell++;
+        if (index >= m_builders.size()) {
+            m_builders.resize(index + 1);
+        }
+        auto& column = m_builders[index];
+        if (!column.type) {
+            if (m_schemaSeen && index < m_types.size()) {
+                column.type = m_types[index];
+                column.fixed = true;
+            } else {
+                column.type = firstType;
+            }
+        }
+        fill(column, m_rows);
+        return column;
+    }
+
+    // Cellules manquantes : 0 ou ""
+    void fill(ColumnBuilder& column, size_t rows) {
+        if (!column.type) column.type = ColumnTypeOpt::STRING;
+        size_t size = column.size();
+        if (size >= rows) return;
+        switch (*column.type) {
+            case ColumnTypeOpt::INT: column.ints.resize(rows, 0); break;
+            case ColumnTypeOpt::DOUBLE: column.doubles.resize(rows, 0.0); break;
+            case ColumnTypeOpt::STRING: column.ids.resize(rows, emptyId()); break;
+        }
+    }
+
+    StringId emptyId() {
+        if (!m_emptyId) m_emptyId = m_df->getStringPool()->intern("");
+        return *m_emptyId;
+    }
+
+    StringId intern(const std::string& str) {
+        return m_df->getStringPool()->intern(str);
+    }
+
+    // Convertit les valeurs déjà lues vers type (promotion, ou schéma tardif)
+    void convert(ColumnBuilder& column, ColumnTypeOpt type) {
+        ColumnTypeOpt from = column.type.value_or(type);
+        column.type = type;
+        if (from == type) return;
+
+        if (type == ColumnTypeOpt::STRING) {
+            column.ids.reserve(column.size());
+            for (int v : column.ints) column.ids.push_back(intern(std::to_string(v)));
+            for (double v : column.doubles) column.ids.push_back(intern(std::to_string(v)));
+        } else if (type == ColumnTypeOpt::DOUBLE) {
+            for (int v : column.ints) column.doubles.push_back(v);
+            const auto& pool = *m_df->getStringPool();
+            for (StringId id : column.ids) column.doubles.push_back(toDouble(pool.getString(id)));
+        } else {
+            for (double v : column.doubles) column.ints.push_back(static_cast<int>(v));
+            const auto& pool = *m_df->getStringPool();
+            for (StringId id : column.ids) column.ints.push_back(toInt(pool.getString(id)));
+        }
+
+        if (from == ColumnTypeOpt::INT) std::vector<int>().swap(column.ints);
+        if (from == ColumnTypeOpt::DOUBLE) std::vector<double>().swap(column.doubles);
+        if (from == ColumnTypeOpt::STRING) std::vector<StringId>().swap(column.ids);
+    }
+
+    // Entier hors de la plage int32 : la colonne passe en DOUBLE comme pour
+    // un décimal, refusé si le schéma impose INT
+    void cellInteger(int64_t value) {
+        bool fitsInt = value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max();
+        auto& column = builder(fitsInt ? ColumnTypeOpt::INT : ColumnTypeOpt::DOUBLE);
+        if (!fitsInt && column.type == ColumnTypeOpt::INT) {
+            if (column.fixed) {
+                throw std::runtime_error("Invalid DataFrame JSON: " + std::to_string(value) +
+                                         " does not fit an INT column");
+            }
+            convert(column, ColumnTypeOpt::DOUBLE);
+        }
+        switch (*column.type) {
+            case ColumnTypeOpt::INT: column.ints.push_back(static_cast<int>(value)); break;
+            case ColumnTypeOpt::DOUBLE: column.doubles.push_back(static_cast<double>(value)); break;
+            case ColumnTypeOpt::STRING: column.ids.push_back(intern(std::to_string(value))); break;
+        }
+    }
+
+    void cellDouble(double value) {
+        auto& column = builder(ColumnTypeOpt::DOUBLE);
+        if (!column.fixed && column.type == ColumnTypeOpt::INT) {
+            convert(column, ColumnTypeOpt::DOUBLE);
+        }
+        switch (*column.type) {
+            case ColumnTypeOpt::INT: column.ints.push_back(static_cast<int>(value)); break;
+            case ColumnTypeOpt::DOUBLE: column.doubles.push_back(value); break;
+            case ColumnTypeOpt::STRING: column.ids.push_back(intern(std::to_string(value))); break;
+        }
+    }
+
+    void cellString(const std::string& value) {
+        auto& column = builder(ColumnTypeOpt::STRING);
+        if (!column.fixed && column.type != ColumnTypeOpt::STRING) {
+            convert(column, ColumnTypeOpt::STRING);
+        }
+        switch (*column.type) {
+            case ColumnTypeOpt::INT: column.ints.push_back(toInt(value)); break;
+            case ColumnTypeOpt::DOUBLE: column.doubles.push_back(toDouble(value)); break;
+            case ColumnTypeOpt::STRING: column.ids.push_back(intern(value)); break;
+        }
+    }
+
+    // null, booléen ou valeur composée : texte dans une colonne string, 0 sinon
+    void cellText(const std::string& text, bool isNull) {
+        auto& column = builder(ColumnTypeOpt::STRING);
+        switch (*column.type) {
+            case ColumnTypeOpt::INT: column.ints.push_back(0); break;
+            case ColumnTypeOpt::DOUBLE: column.doubles.push_back(0.0); break;
+            case ColumnTypeOpt::STRING: column.ids.push_back(isNull ? emptyId() : intern(text)); break;
+        }
+    }
+
+    std::string_view m_member;
+    bool m_dataOnly;
+    std::shared_ptr<DataFrame> m_df;
+
+    std::vector<Context> m_stack;
+    std::string m_key;
+
+    std::vector<std::string> m_names;
+    std::vector<ColumnTypeOpt> m_types;
+    bool m_columnsSeen = false;
+    bool m_schemaSeen = false;
+    bool m_dataSeen = false;
+
+    std::vector<ColumnBuilder> m_builders;
+    size_t m_rows = 0;
+    size_t m_cell = 0;
+    std::optional<StringId> m_emptyId;
+
+    // Valeur composée en cours dans une cellule, et clé en attente par niveau
+    std::vector<json> m_nested;
+    std::vector<std::string> m_nestedKeys;
+};
+
+std::shared_ptr<DataFrame> FrameHandler::finish() {
+    if (!m_columnsSeen || !m_dataSeen) {
+        throw std::runtime_error("Invalid DataFrame JSON: missing 'columns' or 'data'");
+    }
+
+    m_builders.resize(std::max(m_builders.size(), m_names.size()));
+    for (size_t c = 0; c < m_names.size(); ++c) {
+        auto& column = m_builders[c];
+        // Schéma arrivé après "data" (ou colonne sans valeur) : conversion
+        if (c < m_types.size() && m_schemaSeen && !column.fixed) {
+            convert(column, m_types[c]);
+        }
+        fill(column, m_rows);
+
+        switch (*column.type) {
+            case ColumnTypeOpt::INT: {
+                m_df->addIntColumn(m_names[c]);
+                auto col = std::static_pointer_cast<IntColumn>(m_df->getColumn(m_names[c]));
+                col->append(column.ints);
+                break;
+            }
+            case ColumnTypeOpt::DOUBLE: {
+                m_df->addDoubleColumn(m_names[c]);
+                auto col = std::static_pointer_cast<DoubleColumn>(m_df->getColumn(m_names[c]));
+                col->append(column.doubles);
+                break;
+            }
+            case ColumnTypeOpt::STRING: {
+                m_df->addStringColumn(m_names[c]);
+                auto col = std::static_pointer_cast<StringColumn>(m_df->getColumn(m_names[c]));
+                col->appendIds(column.ids);
+                break;
+            }
+        }
+        column = ColumnBuilder();
+    }
+    return m_df;
+}
+
+} // namespace
+
+std::shared_ptr<DataFrame> JsonReader::parse(std::string_view text, std::string_view member) {
+    FrameHandler handler(member, false);
+    json::sax_parse(text.begin(), text.end(), &handler);
+    return handler.finish();
+}
+
+std::shared_ptr<DataFrame> JsonReader::parse(
+    std::string_view columnsJson,
+    std::string_view schemaJson,
+    std::string_view dataJson
+) {
+    std::vector<std::string> names;
+    std::vector<ColumnTypeOpt> types;
+    try {
+        names = json::parse(columnsJson).get<std::vector<std::string>>();
+        for (const auto& colSchema : json::parse(schemaJson)) {
+            types.push_back(DataFrameSerializer::stringToColumnType(colSchema.value("type", "STRING")));
+        }
+    } catch (const json::exception& e) {
+        throw std::runtime_error(std::string("Invalid DataFrame JSON: ") + e.what());
+    }
+
+    FrameHandler handler({}, true);
+    handler.preset(std::move(names), std::move(types));
+    json::sax_parse(dataJson.begin(), dataJson.end(), &handler);
+    return handler.finish();
+}
+
+} // namespace dataframe
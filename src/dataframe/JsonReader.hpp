@@ -0,0 +1,48 @@
+#pragma once
+
+#include "DataFrame.hpp"
+#include <memory>
+#include <string_view>
+
+namespace dataframe {
+
+/**
+ * Lecture JSON en flux (SAX nlohmann) directement dans des colonnes typées
+ *
+ * Format lu : celui de DataFrameSerializer::toJsonWithSchema
+ *   {"columns": [...], "schema": [{"name": ..., "type": ...}], "data": [[...], ...]}
+ *
+ * Aucun DOM n'est construit pour "data" : chaque cellule part dans le
+ * vecteur typé de sa colonne (int, double, ou StringId interné dans le
+ * StringPool du DataFrame) dès que son token arrive. Mémoire de pointe :
+ * environ deux fois la taille des colonnes, au lieu d'un DOM de plusieurs
+ * dizaines d'octets par cellule.
+ *
+ * Types des colonnes :
+ * - schéma lu avant "data" : types fixés, valeurs converties comme
+ *   fromJson (string non numérique → 0, nombre → texte, null → "")
+ * - sinon type de la première valeur, promu si une valeur ne tient pas
+ *   (int → double → string), puis converti vers le schéma s'il arrive
+ *   après "data" (ordre alphabétique des clés d'un dump() nlohmann)
+ *
+ * Ligne courte : cellules manquantes → 0 ou "". Valeur imbriquée dans une
+ * cellule : texte JSON (dump) dans une colonne string.
+ * Lève std::runtime_error si le JSON est invalide ou si "columns" ou "data"
+ * manque.
+ */
+class JsonReader {
+public:
+    // Document complet ; member non vide : le DataFrame est la valeur de
+    // cette clé de l'objet racine (ex. {"type": "csv", "value": {...}})
+    static std::shared_ptr<DataFrame> parse(std::string_view text, std::string_view member = {});
+
+    // Champs stockés séparément (execution_dataframes) : columns_json et
+    // schema_json sont petits, seul data_json est lu en flux
+    static std::shared_ptr<DataFrame> parse(
+        std::string_view columnsJson,
+        std::string_view schemaJson,
+        std::string_view dataJson
+    );
+};
+
+} // namespace dataframe
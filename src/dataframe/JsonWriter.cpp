@@ -0,0 +1,406 @@
+#include "JsonWriter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dataframe {
+
+namespace {
+
+using StringId = StringPool::StringId;
+
+// Premier caractère à échapper de [p, end) : '"', '\\' ou contrôle (< 0x20)
+const char* findEscape(const char* p, const char* end) {
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+
+    while (end - p >= 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        // octet <= 0x1F (non signé) ⇔ max(octet, 0x1F) == 0x1F
+        __m128i isControl = _mm_cmpeq_epi8(_mm_max_epu8(block, control), control);
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quote),
+                                                _mm_cmpeq_epi8(block, backslash)),
+                                   isControl);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#endif
+    while (p < end) {
+        auto c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\' || c < 0x20) return p;
+        ++p;
+    }
+    return end;
+}
+
+// Taille maximale d'un nombre encodé ("-2.2250738585072014e-308", ".0" compris)
+constexpr size_t MAX_NUMBER_CHARS = 32;
+
+// Lignes encodées par réservation du buffer
+constexpr size_t BLOCK_ROWS = 1024;
+
+char* writeEscape(char* out, unsigned char c) {
+    *out++ = '\\';
+    switch (c) {
+        case '"': *out++ = '"'; break;
+        case '\\': *out++ = '\\'; break;
+        case '\b': *out++ = 'b'; break;
+        case '\f': *out++ = 'f'; break;
+        case '\n': *out++ = 'n'; break;
+        case '\r': *out++ = 'r'; break;
+        case '\t': *out++ = 't'; break;
+        default: {
+            static const char hex[] = "0123456789abcdef";
+            *out++ = 'u';
+            *out++ = '0';
+            *out++ = '0';
+            *out++ = hex[c >> 4];
+            *out++ = hex[c & 0xF];
+        }
+    }
+    return out;
+}
+
+// Écrit str entre guillemets ; out doit contenir escapedBound(str.size())
+char* writeString(char* out, std::string_view str) {
+    *out++ = '"';
+    const char* p = str.data();
+    const char* end = p + str.size();
+    while (p < end) {
+        const char* hit = findEscape(p, end);
+        std::memcpy(out, p, static_cast<size_t>(hit - p));
+        out += hit - p;
+        if (hit == end) break;
+        out = writeEscape(out, static_cast<unsigned char>(*hit));
+        p = hit + 1;
+    }
+    *out++ = '"';
+    return out;
+}
+
+// Pire cas : chaque octet devient \u00XX
+size_t escapedBound(size_t length) {
+    return length * 6 + 2;
+}
+
+char* writeDouble(char* out, double number) {
+    if (!std::isfinite(number)) {
+        std::memcpy(out, "null", 4);
+        return out + 4;
+    }
+    char* begin = out;
+    out = std::to_chars(out, out + MAX_NUMBER_CHARS, number).ptr;
+
+    // Comme nlohmann : un double reste un nombre flottant ("3.0")
+    for (const char* p = begin; p < out; ++p) {
+        if (*p == '.' || *p == 'e') return out;
+    }
+    *out++ = '.';
+    *out++ = '0';
+    return out;
+}
+
+// Strings déjà échappées, une par StringId, construites à la demande
+struct EscapedPool {
+    static constexpr size_t NOT_BUILT = SIZE_MAX;
+
+    const StringPool* pool = nullptr;
+    std::vector<size_t> offsets;
+    std::vector<uint32_t> lengths;
+    std::string escaped;
+
+    std::string_view get(StringId id) {
+        if (offsets[id] == NOT_BUILT) {
+            const auto& str = pool->getString(id);
+            size_t offset = escaped.size();
+            escaped.resize_and_overwrite(offset + escapedBound(str.size()), [&](char* data, size_t) {
+                return static_cast<size_t>(writeString(data + offset, str) - data);
+            });
+            offsets[id] = offset;
+            lengths[id] = static_cast<uint32_t>(escaped.size() - offset);
+        }
+        return {escaped.data() + offsets[id], lengths[id]};
+    }
+};
+
+// Données typées d'une colonne, résolues une fois
+struct ColumnData {
+    ColumnTypeOpt type = ColumnTypeOpt::STRING;
+    const int* ints = nullptr;
+    const double* doubles = nullptr;
+    const StringId* ids = nullptr;
+    const StringPool* pool = nullptr;
+    EscapedPool* cache = nullptr;  // nullptr : échappement à chaque cellule
+};
+
+// Colonnes résolues ; un cache par StringPool si le dictionnaire est plus
+// petit que la page (sinon la plupart des entrées ne serviraient pas)
+struct ResolvedColumns {
+    std::vector<IColumnPtr> holders;
+    std::vector<ColumnData> columns;
+    std::vector<std::unique_ptr<EscapedPool>> caches;
+
+    ResolvedColumns(
+        const std::vector<std::string>& columnOrder,
+        const JsonWriter::ColumnGetter& getColumn,
+        size_t pageRows
+    ) {
+        columns.reserve(columnOrder.size());
+        for (const auto& name : columnOrder) {
+            auto col = getColumn(name);
+            ColumnData data;
+            data.type = col->getType();
+            visitColumn(*col, [&](const auto& typed) {
+                using Col = ColumnT<decltype(typed)>;
+                if constexpr (std::is_same_v<Col, IntColumn>) {
+                    data.ints = typed.data().data();
+                } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                    data.doubles = typed.data().data();
+                } else {
+                    data.ids = typed.data().data();
+                    data.pool = typed.getStringPool().get();
+                    data.cache = cacheFor(data.pool, pageRows);
+                }
+            });
+            holders.push_back(std::move(col));
+            columns.push_back(data);
+        }
+    }
+
+    EscapedPool* cacheFor(const StringPool* pool, size_t pageRows) {
+        if (pool->size() > pageRows) return nullptr;
+        for (auto& cache : caches) {
+            if (cache->pool == pool) return cache.get();
+        }
+        auto cache = std::make_unique<EscapedPool>();
+        cache->pool = pool;
+        cache->offsets.assign(pool->size(), EscapedPool::NOT_BUILT);
+        cache->lengths.assign(pool->size(), 0);
+        caches.push_back(std::move(cache));
+        return caches.back().get();
+    }
+};
+
+// Taille maximale d'une cellule ; remplit le cache des strings
+size_t cellBound(const ColumnData& column, size_t row) {
+    if (column.type != ColumnTypeOpt::STRING) return MAX_NUMBER_CHARS;
+    if (column.cache) return column.cache->get(column.ids[row]).size();
+    return escapedBound(column.pool->getString(column.ids[row]).size());
+}
+
+char* writeCell(char* out, const ColumnData& column, size_t row) {
+    switch (column.type) {
+        case ColumnTypeOpt::INT:
+            return std::to_chars(out, out + MAX_NUMBER_CHARS, column.ints[row]).ptr;
+        case ColumnTypeOpt::DOUBLE:
+            return writeDouble(out, column.doubles[row]);
+        case ColumnTypeOpt::STRING:
+            if (column.cache) {
+                auto escaped = column.cache->get(column.ids[row]);
+                std::memcpy(out, escaped.data(), escaped.size());
+                return out + escaped.size();
+            }
+            return writeString(out, column.pool->getString(column.ids[row]));
+    }
+    return out;
+}
+
+// Ajoute au plus bound octets écrits par write(char*) -> fin
+template<typename Write>
+void appendBounded(std::string& out, size_t bound, Write&& write) {
+    size_t size = out.size();
+    out.resize_and_overwrite(size + bound, [&](char* data, size_t) {
+        return static_cast<size_t>(write(data + size) - data);
+    });
+}
+
+} // namespace
+
+// ============================================================================
+// Primitives
+// ============================================================================
+
+void JsonWriter::appendString(std::string& out, std::string_view str) {
+    appendBounded(out, escapedBound(str.size()), [&](char* p) { return writeString(p, str); });
+}
+
+void JsonWriter::appendDouble(std::string& out, double number) {
+    appendBounded(out, MAX_NUMBER_CHARS, [&](char* p) { return writeDouble(p, number); });
+}
+
+void JsonWriter::separator() {
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+    if (!m_hasElements.empty()) {
+        if (m_hasElements.back()) {
+            m_buffer.push_back(',');
+        }
+        m_hasElements.back() = true;
+    }
+}
+
+JsonWriter& JsonWriter::beginObject() {
+    separator();
+    m_buffer.push_back('{');
+    m_hasElements.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+    m_buffer.push_back('}');
+    m_hasElements.pop_back();
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginArray() {
+    separator();
+    m_buffer.push_back('[');
+    m_hasElements.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+    m_buffer.push_back(']');
+    m_hasElements.pop_back();
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(std::string_view name) {
+    separator();
+    appendString(m_buffer, name);
+    m_buffer.push_back(':');
+    m_afterKey = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::string_view str) {
+    separator();
+    appendString(m_buffer, str);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(double number) {
+    separator();
+    appendDouble(m_buffer, number);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool flag) {
+    separator();
+    m_buffer.append(flag ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    separator();
+    m_buffer.append("null");
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(const json& j) {
+    separator();
+    m_buffer.append(j.dump());
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(std::string_view text) {
+    separator();
+    m_buffer.append(text);
+    return *this;
+}
+
+// ============================================================================
+// DataFrame
+// ============================================================================
+
+JsonWriter& JsonWriter::rows(
+    size_t beginRow,
+    size_t endRow,
+    const std::vector<std::string>& columnOrder,
+    const ColumnGetter& getColumn
+) {
+    endRow = std::max(beginRow, endRow);
+    ResolvedColumns resolved(columnOrder, getColumn, endRow - beginRow);
+    const auto& columns = resolved.columns;
+
+    separator();
+    m_buffer.push_back('[');
+    for (size_t block = beginRow; block < endRow; block += BLOCK_ROWS) {
+        size_t blockEnd = std::min(endRow, block + BLOCK_ROWS);
+
+        // Borne du bloc : cellules + séparateurs "[", "]", ","
+        size_t bound = (blockEnd - block) * (columns.size() + 3);
+        for (const auto& column : columns) {
+            for (size_t i = block; i < blockEnd; ++i) {
+                bound += cellBound(column, i);
+            }
+        }
+
+        appendBounded(m_buffer, bound, [&](char* p) {
+            for (size_t i = block; i < blockEnd; ++i) {
+                if (i > beginRow) *p++ = ',';
+                *p++ = '[';
+                for (size_t c = 0; c < columns.size(); ++c) {
+                    if (c > 0) *p++ = ',';
+                    p = writeCell(p, columns[c], i);
+                }
+                *p++ = ']';
+            }
+            return p;
+        });
+    }
+    m_buffer.push_back(']');
+    return *this;
+}
+
+JsonWriter& JsonWriter::columns(
+    size_t beginRow,
+    size_t endRow,
+    const std::vector<std::string>& columnOrder,
+    const ColumnGetter& getColumn
+) {
+    endRow = std::max(beginRow, endRow);
+    ResolvedColumns resolved(columnOrder, getColumn, endRow - beginRow);
+    const auto& columns = resolved.columns;
+
+    separator();
+    m_buffer.push_back('{');
+    for (size_t c = 0; c < columns.size(); ++c) {
+        if (c > 0) m_buffer.push_back(',');
+        appendString(m_buffer, columnOrder[c]);
+        m_buffer.append(":[");
+        const auto& column = columns[c];
+        for (size_t block = beginRow; block < endRow; block += BLOCK_ROWS) {
+            size_t blockEnd = std::min(endRow, block + BLOCK_ROWS);
+            size_t bound = blockEnd - block;
+            for (size_t i = block; i < blockEnd; ++i) {
+                bound += cellBound(column, i);
+            }
+            appendBounded(m_buffer, bound, [&](char* p) {
+                for (size_t i = block; i < blockEnd; ++i) {
+                    if (i > beginRow) *p++ = ',';
+                    p = writeCell(p, column, i);
+                }
+                return p;
+            });
+        }
+        m_buffer.push_back(']');
+    }
+    m_buffer.push_back('}');
+    return *this;
+}
+
+} // namespace dataframe
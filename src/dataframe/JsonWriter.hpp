@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Column.hpp"
+#include <nlohmann/json.hpp>
+#include <charconv>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace dataframe {
+
+using json = nlohmann::json;
+
+/**
+ * Encodeur JSON en flux dans un buffer, sans DOM nlohmann
+ *
+ * - Appels chaînés : beginObject().key("a").value(1).endObject()
+ * - Virgules gérées par une pile de conteneurs
+ * - Nombres via std::to_chars (doubles au plus court aller-retour, ".0"
+ *   pour les doubles entiers, NaN/Inf → null comme nlohmann)
+ * - Strings : échappement avec recherche SSE2 des caractères à échapper
+ *   (guillemet, antislash, contrôles) ; UTF-8 recopié tel quel
+ * - DataFrame écrit directement depuis les colonnes typées :
+ *   rows() (format "data" : [[...], ...]) ou columns() ({"col": [...]})
+ *
+ * Le texte produit se parse comme le dump() du DOM équivalent.
+ */
+class JsonWriter {
+public:
+    using ColumnGetter = std::function<IColumnPtr(const std::string&)>;
+
+    JsonWriter& beginObject();
+    JsonWriter& endObject();
+    JsonWriter& beginArray();
+    JsonWriter& endArray();
+    JsonWriter& key(std::string_view name);
+
+    JsonWriter& value(std::string_view str);
+    JsonWriter& value(const char* str) { return value(std::string_view(str)); }
+    JsonWriter& value(const std::string& str) { return value(std::string_view(str)); }
+    JsonWriter& value(double number);
+    JsonWriter& value(bool flag);
+    JsonWriter& null();
+
+    template<typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool>)
+    JsonWriter& value(T number) {
+        separator();
+        appendInteger(m_buffer, number);
+        return *this;
+    }
+
+    // Valeur quelconque (métadonnées) : dump() du DOM
+    JsonWriter& value(const json& j);
+
+    // Texte JSON déjà encodé
+    JsonWriter& raw(std::string_view text);
+
+    // Lignes [beginRow, endRow) : [[v1, v2, ...], ...]
+    JsonWriter& rows(
+        size_t beginRow,
+        size_t endRow,
+        const std::vector<std::string>& columnOrder,
+        const ColumnGetter& getColumn
+    );
+
+    // Colonnes sur [beginRow, endRow) : {"col1": [...], "col2": [...]}
+    JsonWriter& columns(
+        size_t beginRow,
+        size_t endRow,
+        const std::vector<std::string>& columnOrder,
+        const ColumnGetter& getColumn
+    );
+
+    const std::string& str() const { return m_buffer; }
+    std::string take() { return std::move(m_buffer); }
+    void reserve(size_t bytes) { m_buffer.reserve(bytes); }
+
+    // Ajoute str entre guillemets, échappée
+    static void appendString(std::string& out, std::string_view str);
+    static void appendDouble(std::string& out, double number);
+
+    template<typename T>
+    static void appendInteger(std::string& out, T number) {
+        char buffer[24];
+        auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), number);
+        out.append(buffer, ptr);
+    }
+
+private:
+    // Virgule avant un élément, sauf premier du conteneur ou après une clé
+    void separator();
+
+    std::string m_buffer;
+    std::vector<bool> m_hasElements;  // Pile : le conteneur courant a-t-il déjà un élément ?
+    bool m_afterKey = false;
+};
+
+} // namespace dataframe
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace dataframe {
+
+/**
+ * Fichier projeté en mémoire en lecture seule (RAII)
+ *
+ * - mmap du fichier entier, pages chargées à la demande par le noyau
+ * - Fichier vide : vue vide, aucun mapping
+ * - releaseBefore() rend au noyau les pages déjà lues (lecture en flux)
+ * - Lève std::runtime_error si le fichier ne peut pas être ouvert
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    std::string_view view() const { return {m_data, m_size}; }
+
+    // Libère les pages entièrement situées avant offset : la mémoire résidente
+    // reste bornée en lecture séquentielle, une relecture recharge depuis le disque
+    void releaseBefore(size_t offset);
+
+private:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_released = 0;
+};
+
+} // namespace dataframe
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Cancellation.hpp"
+#include "ResourceMeter.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace dataframe {
+
+// Nombre de threads : requested, ou std::thread::hardware_concurrency() si 0
+inline size_t resolveThreads(size_t requested) {
+    return requested ? requested : std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+// Exécute task(0..count-1), une tâche par thread ; relance la première exception
+// Les workers héritent du jeton d'annulation et du compteur de ressources du thread appelant
+template<typename Task>
+void runParallel(size_t count, Task&& task) {
+    if (count <= 1) {
+        if (count == 1) task(0);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(count);
+    const CancellationToken* token = currentCancellation();
+    ResourceMeter* meter = currentMeter();
+    auto guarded = [&](size_t k) {
+        CancellationScope scope(token);
+        try {
+            task(k);
+        } catch (...) {
+            errors[k] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(count - 1);
+    for (size_t k = 1; k < count; ++k) {
+        workers.emplace_back([&guarded, meter](size_t worker) {
+            MeterScope meterScope(meter);  // Le thread appelant est déjà mesuré
+            guarded(worker);
+        }, k);
+    }
+    guarded(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+} // namespace dataframe
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+namespace dataframe {
+
+/**
+ * Compteurs de ressources d'une opération (un nœud de graphe), alimentés
+ * par tous les threads qui travaillent pour elle : temps CPU des threads
+ * et octets alloués (si le hook d'allocation est lié, voir AllocationHook.cpp).
+ * Thread-safe.
+ */
+class ResourceMeter {
+public:
+    void addCpuNs(uint64_t ns) { m_cpuNs.fetch_add(ns, std::memory_order_relaxed); }
+
+    void addAllocation(size_t bytes) {
+        m_allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    uint64_t cpuNs() const { return m_cpuNs.load(std::memory_order_relaxed); }
+    uint64_t allocatedBytes() const { return m_allocatedBytes.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_cpuNs{0};
+    std::atomic<uint64_t> m_allocatedBytes{0};
+};
+
+namespace detail {
+inline thread_local ResourceMeter* currentMeter = nullptr;
+}
+
+/**
+ * Compteur alimenté par le thread courant (nullptr si aucun)
+ */
+inline ResourceMeter* currentMeter() {
+    return detail::currentMeter;
+}
+
+// Temps CPU consommé par le thread courant
+inline uint64_t threadCpuNs() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/**
+ * Rattache le thread courant à un compteur le temps d'une portée et lui
+ * ajoute le temps CPU du thread à la sortie (l'exécuteur de nœuds autour
+ * de compile, runParallel dans ses workers)
+ */
+class MeterScope {
+public:
+    explicit MeterScope(ResourceMeter* meter)
+        : m_meter(meter)
+        , m_previous(detail::currentMeter)
+        , m_startCpu(meter ? threadCpuNs() : 0) {
+        detail::currentMeter = meter;
+    }
+    ~MeterScope() {
+        if (m_meter) {
+            m_meter->addCpuNs(threadCpuNs() - m_startCpu);
+        }
+        detail::currentMeter = m_previous;
+    }
+
+    MeterScope(const MeterScope&) = delete;
+    MeterScope& operator=(const MeterScope&) = delete;
+
+private:
+    ResourceMeter* m_meter;
+    ResourceMeter* m_previous;
+    uint64_t m_startCpu;
+};
+
+// Appelée par le hook d'allocation pour chaque operator new
+inline void recordAllocation(size_t bytes) noexcept {
+    if (auto* meter = detail::currentMeter) {
+        meter->addAllocation(bytes);
+    }
+}
+
+// Vrai si AllocationHook.cpp est lié à l'exécutable (sinon les octets alloués ne sont pas mesurés)
+inline bool& allocationHookInstalled() {
+    static bool installed = false;
+    return installed;
+}
+
+} // namespace dataframe
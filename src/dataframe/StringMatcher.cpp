@@ -0,0 +1,157 @@
+#include "StringMatcher.hpp"
+#include "TrigramIndex.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dataframe {
+
+namespace {
+
+void toLowerAscii(std::string_view src, std::string& dst) {
+    dst.resize(src.size());
+    std::transform(src.begin(), src.end(), dst.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+}
+
+} // namespace
+
+bool StringMatcher::isStringOperator(const std::string& op) {
+    return op == "contains" || op == "startsWith" || op == "endsWith" || op == "regex"
+        || op == "icontains" || op == "istartsWith" || op == "iendsWith" || op == "iregex"
+        || op == "<" || op == "<=" || op == ">" || op == ">=";
+}
+
+std::optional<StringMatcher> StringMatcher::create(const std::string& op, const std::string& value) {
+    bool ignoreCase = (op == "icontains" || op == "istartsWith" || op == "iendsWith" || op == "iregex");
+    std::string base = ignoreCase ? op.substr(1) : op;
+
+    Kind kind;
+    if (base == "contains") kind = Kind::Contains;
+    else if (base == "startsWith") kind = Kind::StartsWith;
+    else if (base == "endsWith") kind = Kind::EndsWith;
+    else if (base == "regex") kind = Kind::Regex;
+    else if (base == "<") kind = Kind::Less;
+    else if (base == "<=") kind = Kind::LessOrEqual;
+    else if (base == ">") kind = Kind::Greater;
+    else if (base == ">=") kind = Kind::GreaterOrEqual;
+    else return std::nullopt;
+
+    return StringMatcher(kind, value, ignoreCase);
+}
+
+StringMatcher::StringMatcher(Kind kind, std::string value, bool ignoreCase)
+    : m_kind(kind), m_value(std::move(value)), m_ignoreCase(ignoreCase) {
+    if (m_kind == Kind::Regex) {
+        auto flags = std::regex::ECMAScript | std::regex::optimize;
+        if (m_ignoreCase) flags |= std::regex::icase;
+        m_regex = std::make_shared<const std::regex>(m_value, flags);
+    } else if (m_ignoreCase) {
+        std::string lowered;
+        toLowerAscii(m_value, lowered);
+        m_value = std::move(lowered);
+    }
+}
+
+bool StringMatcher::matches(std::string_view str) const {
+    std::string scratch;
+    return matches(str, scratch);
+}
+
+bool StringMatcher::matches(std::string_view str, std::string& scratch) const {
+    if (m_kind == Kind::Regex) {
+        return std::regex_search(str.begin(), str.end(), *m_regex);
+    }
+
+    if (m_ignoreCase) {
+        toLowerAscii(str, scratch);
+        str = scratch;
+    }
+
+    std::string_view value(m_value);
+    switch (m_kind) {
+        case Kind::Contains:
+            return containsSubstring(str, value);
+        case Kind::StartsWith:
+            return str.size() >= value.size() && str.compare(0, value.size(), value) == 0;
+        case Kind::EndsWith:
+            return str.size() >= value.size()
+                && str.compare(str.size() - value.size(), value.size(), value) == 0;
+        case Kind::Less:
+            return str < value;
+        case Kind::LessOrEqual:
+            return str <= value;
+        case Kind::Greater:
+            return str > value;
+        case Kind::GreaterOrEqual:
+            return str >= value;
+        case Kind::Regex:
+            break;
+    }
+    return false;
+}
+
+std::vector<uint8_t> StringMatcher::evaluate(const StringPool& pool) const {
+    std::vector<uint8_t> bitmap(pool.size(), 0);
+    std::string scratch;
+
+    // Sous-chaîne sur un pool indexé : seuls les candidats trigrammes sont vérifiés
+    if (m_kind == Kind::Contains) {
+        if (auto index = TrigramIndex::forPool(pool)) {
+            if (auto candidates = index->candidates(m_value)) {
+                for (StringPool::StringId id : *candidates) {
+                    bitmap[id] = matches(pool.getString(id), scratch) ? 1 : 0;
+                }
+                return bitmap;
+            }
+        }
+    }
+
+    for (StringPool::StringId id = 0; id < bitmap.size(); ++id) {
+        bitmap[id] = matches(pool.getString(id), scratch) ? 1 : 0;
+    }
+    return bitmap;
+}
+
+bool StringMatcher::containsSubstring(std::string_view haystack, std::string_view needle) {
+    const size_t n = needle.size();
+    if (n == 0) return true;
+    if (haystack.size() < n) return false;
+    if (n == 1) {
+        return std::memchr(haystack.data(), needle[0], haystack.size()) != nullptr;
+    }
+
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    // Blocs de 16 positions : candidats = premier ET dernier octet égaux
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[n - 1]);
+    const char* data = haystack.data();
+
+    for (; i + n - 1 + 16 <= haystack.size(); i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + n - 1));
+        __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+                                   _mm_cmpeq_epi8(last, blockLast));
+
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+        while (mask != 0) {
+            unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+            if (std::memcmp(data + i + bit + 1, needle.data() + 1, n - 2) == 0) {
+                return true;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // Fin de chaîne (ou pas de SSE2) : recherche standard
+    return haystack.substr(i).find(needle) != std::string_view::npos;
+}
+
+} // namespace dataframe
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "StringPool.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dataframe {
+
+/**
+ * Prédicat sur chaînes évalué au niveau du dictionnaire
+ *
+ * Au lieu de tester la string de chaque ligne, le prédicat est évalué une
+ * fois par entrée du StringPool (bitmap indexé par StringId), puis la bitmap
+ * est appliquée au vecteur d'ids de la colonne.
+ *
+ * Opérateurs :
+ * - contains, startsWith, endsWith, regex
+ *   (+ variantes insensibles à la casse ASCII : icontains, istartsWith, iendsWith, iregex)
+ * - <, <=, >, >= (ordre lexicographique)
+ */
+class StringMatcher {
+public:
+    static bool isStringOperator(const std::string& op);
+
+    /**
+     * nullopt si l'opérateur n'est pas un prédicat de chaîne
+     * Lève std::regex_error si l'expression régulière est invalide
+     */
+    static std::optional<StringMatcher> create(const std::string& op, const std::string& value);
+
+    bool matches(std::string_view str) const;
+
+    // Bitmap de correspondance indexée par StringId, pour les ids [0, pool.size())
+    std::vector<uint8_t> evaluate(const StringPool& pool) const;
+
+    /**
+     * Recherche de sous-chaîne : filtrage SIMD (SSE2) sur le premier et le
+     * dernier octet de needle, puis vérification des candidats par memcmp
+     */
+    static bool containsSubstring(std::string_view haystack, std::string_view needle);
+
+private:
+    enum class Kind {
+        Contains, StartsWith, EndsWith, Regex,
+        Less, LessOrEqual, Greater, GreaterOrEqual
+    };
+
+    StringMatcher(Kind kind, std::string value, bool ignoreCase);
+
+    // scratch : tampon réutilisé pour la mise en minuscules
+    bool matches(std::string_view str, std::string& scratch) const;
+
+    Kind m_kind;
+    std::string m_value;  // en minuscules si m_ignoreCase
+    bool m_ignoreCase;
+    std::shared_ptr<const std::regex> m_regex;
+};
+
+} // namespace dataframe
@@ -1,12 +1,19 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <string>
-#include <vector>
+#include <string_view>
 #include <unordered_map>
+#include <memory>
+#include <mutex>
 #include <cstdint>
 
 namespace dataframe {
 
+class TrigramIndex;
+
 /**
  * String pooling / Dictionary encoding pour optimiser les comparaisons
  *
@@ -18,6 +25,11 @@ namespace dataframe {
  * - Hash: O(1) au lieu de O(n)
  * - Mémoire: strings dupliquées stockées une seule fois
  * - Cache friendly: indices contigus en mémoire
+ *
+ * Concurrence : un pool est partagé par les DataFrames qui en dérivent, y compris
+ * entre exécutions simultanées (plans en cache, résultats mémoïsés). intern et
+ * find sont sérialisés ; getString ne prend pas de verrou, les strings publiées
+ * ne bougeant plus.
  */
 class StringPool {
 public:
@@ -25,86 +37,150 @@ public:
     static constexpr StringId INVALID_ID = UINT32_MAX;
 
     StringPool() {
-        // Réserver de l'espace pour éviter les reallocations
-        m_strings.reserve(1024);
-        m_string_to_id.reserve(1024);
+        m_string_to_id.reserve(FIRST_SEGMENT_SIZE);
     }
 
+    ~StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
     /**
      * Ajoute une string au pool et retourne son ID
      * Si la string existe déjà, retourne l'ID existant
      */
     StringId intern(const std::string& str) {
-        // Chercher si la string existe déjà
+        std::lock_guard<std::mutex> lock(m_mutex);
         auto it = m_string_to_id.find(str);
         if (it != m_string_to_id.end()) {
             return it->second;
         }
 
-        // Ajouter la nouvelle string
-        StringId id = static_cast<StringId>(m_strings.size());
-        m_strings.push_back(str);
-        m_string_to_id[str] = id;
+        // Écrit la string dans son emplacement définitif, puis publie l'ID
+        size_t id = m_size.load(std::memory_order_relaxed);
+        size_t segment = segmentOf(id);
+        if (!m_segments[segment]) {
+            m_segments[segment] = std::make_unique<std::string[]>(segmentSize(segment));
+        }
+        std::string& slot = m_segments[segment][id - segmentStart(segment)];
+        slot = str;
+        m_string_to_id.emplace(slot, static_cast<StringId>(id));
+        m_size.store(id + 1, std::memory_order_release);
 
-        return id;
+        return static_cast<StringId>(id);
     }
 
     /**
-     * Récupère la string à partir de son ID
+     * Récupère la string à partir de son ID (sans verrou)
+     * La référence reste valide tant que le pool n'est pas vidé
      */
     const std::string& getString(StringId id) const {
-        if (id >= m_strings.size()) {
+        if (id >= m_size.load(std::memory_order_acquire)) {
             static const std::string empty;
             return empty;
         }
-        return m_strings[id];
+        size_t segment = segmentOf(id);
+        return m_segments[segment][id - segmentStart(segment)];
+    }
+
+    /**
+     * Recherche l'ID d'une string sans l'ajouter au pool
+     * Retourne INVALID_ID si la string est absente
+     */
+    StringId find(const std::string& str) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_string_to_id.find(str);
+        return it != m_string_to_id.end() ? it->second : INVALID_ID;
     }
 
     /**
      * Vérifie si un ID est valide
      */
     bool isValid(StringId id) const {
-        return id < m_strings.size();
+        return id < m_size.load(std::memory_order_acquire);
     }
 
     /**
      * Retourne le nombre de strings uniques
      */
     size_t size() const {
-        return m_strings.size();
+        return m_size.load(std::memory_order_acquire);
     }
 
     /**
-     * Réserve de l'espace pour éviter les reallocations
+     * Réserve de l'espace pour éviter les rehash du dictionnaire
      */
     void reserve(size_t capacity) {
-        m_strings.reserve(capacity);
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_string_to_id.reserve(capacity);
     }
 
     /**
      * Vide le pool
+     * Invalide les IDs et les références : aucun autre thread ne doit l'utiliser
      */
     void clear() {
-        m_strings.clear();
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_string_to_id.clear();
+        for (auto& segment : m_segments) {
+            segment.reset();
+        }
+        m_size.store(0, std::memory_order_release);
+        m_trigram_index.reset();
     }
 
+    /**
+     * Index de trigrammes pour contains / icontains (voir TrigramIndex)
+     * Désactivé par défaut ; une fois activé, construit au premier usage
+     * et complété au fil des ajouts par TrigramIndex::forPool
+     */
+    void enableTrigramIndex() { m_trigram_enabled = true; }
+    bool trigramIndexEnabled() const { return m_trigram_enabled; }
+    std::shared_ptr<TrigramIndex> getTrigramIndex() const { return m_trigram_index; }
+    void setTrigramIndex(std::shared_ptr<TrigramIndex> index) const { m_trigram_index = std::move(index); }
+
     /**
      * Statistiques mémoire
      */
     size_t memoryUsage() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t count = m_size.load(std::memory_order_relaxed);
         size_t total = 0;
-        for (const auto& str : m_strings) {
-            total += str.capacity();
+        for (size_t segment = 0; segment < SEGMENT_COUNT && m_segments[segment]; ++segment) {
+            total += segmentSize(segment) * sizeof(std::string);
         }
-        total += m_string_to_id.size() * (sizeof(std::string) + sizeof(StringId));
+        for (size_t id = 0; id < count; ++id) {
+            total += getString(static_cast<StringId>(id)).capacity();
+        }
+        total += m_string_to_id.size() * (sizeof(std::string_view) + sizeof(StringId));
         return total;
     }
 
 private:
-    std::vector<std::string> m_strings;           // ID → String
-    std::unordered_map<std::string, StringId> m_string_to_id;  // String → ID
+    // Segments de taille croissante (1024, 1024, 2048, 4096...) : contrairement
+    // à un vector, un ajout ne déplace jamais les strings déjà publiées
+    static constexpr size_t FIRST_SEGMENT_BITS = 10;
+    static constexpr size_t FIRST_SEGMENT_SIZE = size_t{1} << FIRST_SEGMENT_BITS;
+    static constexpr size_t SEGMENT_COUNT = 32 - FIRST_SEGMENT_BITS + 1;
+
+    // Sans branche : getString est sur les chemins chauds (tri, filtres, sérialisation)
+    static size_t segmentOf(size_t id) {
+        return static_cast<size_t>(std::bit_width(id >> FIRST_SEGMENT_BITS));
+    }
+    static size_t segmentStart(size_t segment) {
+        return (size_t{1} << (segment + FIRST_SEGMENT_BITS - 1)) & ~(FIRST_SEGMENT_SIZE - 1);
+    }
+    static size_t segmentSize(size_t segment) {
+        return segment == 0 ? FIRST_SEGMENT_SIZE : segmentStart(segment);
+    }
+
+    std::array<std::unique_ptr<std::string[]>, SEGMENT_COUNT> m_segments;  // ID → String
+    std::atomic<size_t> m_size{0};                                         // IDs publiés
+    std::unordered_map<std::string_view, StringId> m_string_to_id;        // String → ID (vues sur les segments)
+    mutable std::mutex m_mutex;                                            // intern / find
+
+    // Cache d'index, construit à la demande même sur un pool const
+    bool m_trigram_enabled = false;
+    mutable std::shared_ptr<TrigramIndex> m_trigram_index;
 };
 
 } // namespace dataframe
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include "TrigramIndex.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+
+namespace dataframe {
+
+namespace {
+
+constexpr char TRIGRAM_MAGIC[4] = {'T', 'R', 'G', 'I'};
+constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+
+// Empreinte FNV-1a d'une entrée, chaînée sur les précédentes
+uint64_t fingerprintAdd(uint64_t hash, std::string_view s) {
+    auto mix = [&hash](unsigned char byte) {
+        hash ^= byte;
+        hash *= 0x100000001b3ULL;
+    };
+    uint64_t size = s.size();
+    for (size_t i = 0; i < sizeof(size); ++i) mix(static_cast<unsigned char>(size >> (8 * i)));
+    for (char c : s) mix(static_cast<unsigned char>(c));
+    return hash;
+}
+
+template<typename T>
+void writeRaw(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+T readRaw(std::istream& in) {
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in) {
+        throw std::runtime_error("Truncated trigram index");
+    }
+    return value;
+}
+
+// Trigrammes distincts de s (ASCII minuscule)
+template<typename KeyFn>
+void collectTrigrams(std::string_view s, std::vector<uint32_t>& keys, KeyFn&& key) {
+    keys.clear();
+    if (s.size() < 3) return;
+
+    for (size_t i = 0; i + 3 <= s.size(); ++i) {
+        keys.push_back(key(static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(s[i]))),
+                           static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(s[i + 1]))),
+                           static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(s[i + 2])))));
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+} // namespace
+
+uint32_t TrigramIndex::trigramKey(unsigned char a, unsigned char b, unsigned char c) {
+    return (static_cast<uint32_t>(a) << 16) | (static_cast<uint32_t>(b) << 8) | c;
+}
+
+std::shared_ptr<TrigramIndex> TrigramIndex::forPool(const StringPool& pool) {
+    if (!pool.trigramIndexEnabled()) {
+        return nullptr;
+    }
+
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto index = pool.getTrigramIndex();
+    bool valid = false;
+    if (index) {
+        std::unique_lock<std::shared_mutex> indexLock(index->m_mutex);
+        valid = index->describes(pool);
+        if (valid) {
+            index->m_pool = &pool;  // Index chargé vérifié : rattaché à ce pool
+        }
+    }
+    // Index d'un autre pool ou chargé d'un dataset différent : reconstruire
+    if (!valid) {
+        index = std::make_shared<TrigramIndex>();
+        index->m_pool = &pool;
+        pool.setTrigramIndex(index);
+    }
+    if (index->indexedCount() < pool.size()) {
+        index->update(pool);
+    }
+    return index;
+}
+
+bool TrigramIndex::describes(const StringPool& pool) const {
+    if (m_pool) {
+        return m_pool == &pool;
+    }
+    if (m_indexed > pool.size()) {
+        return false;
+    }
+    uint64_t fingerprint = FNV_OFFSET;
+    for (size_t id = 0; id < m_indexed; ++id) {
+        fingerprint = fingerprintAdd(fingerprint, pool.getString(static_cast<StringId>(id)));
+    }
+    return fingerprint == m_fingerprint;
+}
+
+void TrigramIndex::update(const StringPool& pool) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    std::vector<uint32_t> keys;
+    for (size_t id = m_indexed; id < pool.size(); ++id) {
+        const std::string& s = pool.getString(static_cast<StringId>(id));
+        m_fingerprint = fingerprintAdd(m_fingerprint, s);
+        collectTrigrams(s, keys, trigramKey);
+        for (uint32_t key : keys) {
+            m_postings[key].push_back(static_cast<StringId>(id));
+        }
+    }
+    m_indexed = pool.size();
+}
+
+size_t TrigramIndex::indexedCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_indexed;
+}
+
+std::optional<std::vector<TrigramIndex::StringId>> TrigramIndex::candidates(std::string_view needle) const {
+    if (needle.size() < 3) {
+        return std::nullopt;
+    }
+
+    std::vector<uint32_t> keys;
+    collectTrigrams(needle, keys, trigramKey);
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    std::vector<const std::vector<StringId>*> lists;
+    lists.reserve(keys.size());
+    for (uint32_t key : keys) {
+        auto it = m_postings.find(key);
+        if (it == m_postings.end()) {
+            return std::vector<StringId>{};
+        }
+        lists.push_back(&it->second);
+    }
+
+    // Intersection en partant de la liste la plus courte
+    std::sort(lists.begin(), lists.end(),
+              [](const auto* a, const auto* b) { return a->size() < b->size(); });
+
+    std::vector<StringId> result = *lists.front();
+    std::vector<StringId> next;
+    for (size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+        next.clear();
+        std::set_intersection(result.begin(), result.end(),
+                              lists[i]->begin(), lists[i]->end(),
+                              std::back_inserter(next));
+        result.swap(next);
+    }
+    return result;
+}
+
+size_t TrigramIndex::memoryUsage() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    size_t total = 0;
+    for (const auto& [key, ids] : m_postings) {
+        total += sizeof(key) + ids.capacity() * sizeof(StringId);
+    }
+    return total;
+}
+
+void TrigramIndex::save(std::ostream& out) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    out.write(TRIGRAM_MAGIC, sizeof(TRIGRAM_MAGIC));
+    writeRaw<uint32_t>(out, FORMAT_VERSION);
+    writeRaw<uint64_t>(out, m_indexed);
+    writeRaw<uint64_t>(out, m_fingerprint);
+    writeRaw<uint64_t>(out, m_postings.size());
+    for (const auto& [key, ids] : m_postings) {
+        writeRaw<uint32_t>(out, key);
+        writeRaw<uint64_t>(out, ids.size());
+        out.write(reinterpret_cast<const char*>(ids.data()),
+                  static_cast<std::streamsize>(ids.size() * sizeof(StringId)));
+    }
+}
+
+std::shared_ptr<TrigramIndex> TrigramIndex::load(std::istream& in) {
+    char magic[4];
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, TRIGRAM_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error("Invalid trigram index header");
+    }
+
+    auto version = readRaw<uint32_t>(in);
+    if (version != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported trigram index version " + std::to_string(version));
+    }
+
+    auto index = std::make_shared<TrigramIndex>();
+    index->m_indexed = readRaw<uint64_t>(in);
+    index->m_fingerprint = readRaw<uint64_t>(in);
+    auto postingCount = readRaw<uint64_t>(in);
+    if (postingCount > (uint64_t{1} << 24)) {  // au plus 256^3 trigrammes
+        throw std::runtime_error("Corrupted trigram index");
+    }
+    index->m_postings.reserve(postingCount);
+
+    for (uint64_t p = 0; p < postingCount; ++p) {
+        auto key = readRaw<uint32_t>(in);
+        auto count = readRaw<uint64_t>(in);
+        if (count > index->m_indexed) {
+            throw std::runtime_error("Corrupted trigram index");
+        }
+        std::vector<StringId> ids(count);
+        in.read(reinterpret_cast<char*>(ids.data()),
+                static_cast<std::streamsize>(count * sizeof(StringId)));
+        if (!in) {
+            throw std::runtime_error("Truncated trigram index");
+        }
+        // Ids indexés et strictement croissants : candidates() les intersecte comme
+        // listes triées et StringMatcher les utilise sans contrôle de bornes
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (ids[i] >= index->m_indexed || (i > 0 && ids[i] <= ids[i - 1])) {
+                throw std::runtime_error("Corrupted trigram index");
+            }
+        }
+        index->m_postings.emplace(key, std::move(ids));
+    }
+    return index;
+}
+
+} // namespace dataframe
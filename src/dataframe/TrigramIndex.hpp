@@ -0,0 +1,75 @@
+#pragma once
+
+#include "StringPool.hpp"
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace dataframe {
+
+/**
+ * Index inversé de trigrammes sur les entrées d'un StringPool
+ *
+ * Pour les colonnes à forte cardinalité (emails, descriptions), même
+ * l'évaluation au niveau du dictionnaire parcourt presque toutes les
+ * strings. L'index associe chaque trigramme (ASCII minuscule) aux StringId
+ * qui le contiennent : une recherche contains / icontains n'a plus qu'à
+ * vérifier l'intersection des listes des trigrammes du motif.
+ *
+ * - Le pool étant en ajout seul, l'index est mis à jour incrémentalement
+ *   (seules les nouvelles entrées sont indexées)
+ * - Activé par pool (StringPool::enableTrigramIndex), construit au premier usage
+ * - Sérialisable (save / load) pour être persisté avec le dataset : un index
+ *   chargé n'est adopté par forPool que si l'empreinte des entrées indexées
+ *   correspond au pool, sinon il est reconstruit
+ * - Thread-safe : update sous verrou exclusif, lectures sous verrou partagé
+ */
+class TrigramIndex {
+public:
+    using StringId = StringPool::StringId;
+
+    /**
+     * Index associé au pool, créé et/ou complété si nécessaire
+     * nullptr si l'index n'est pas activé sur ce pool
+     */
+    static std::shared_ptr<TrigramIndex> forPool(const StringPool& pool);
+
+    // Indexe les entrées [indexedCount(), pool.size())
+    void update(const StringPool& pool);
+    size_t indexedCount() const;
+
+    /**
+     * StringId candidats (croissants) pouvant contenir needle, sans tenir
+     * compte de la casse. À vérifier par le prédicat exact.
+     * nullopt si le motif est trop court pour être filtré (< 3 octets)
+     */
+    std::optional<std::vector<StringId>> candidates(std::string_view needle) const;
+
+    size_t memoryUsage() const;
+
+    // Format binaire : magic, version, nombre d'entrées indexées, empreinte
+    // de ces entrées, postings
+    void save(std::ostream& out) const;
+    static std::shared_ptr<TrigramIndex> load(std::istream& in);
+
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+private:
+    static uint32_t trigramKey(unsigned char a, unsigned char b, unsigned char c);
+
+    // Vrai si l'index décrit les premières entrées de pool (à verrouiller par l'appelant)
+    bool describes(const StringPool& pool) const;
+
+    size_t m_indexed = 0;
+    uint64_t m_fingerprint = 0xcbf29ce484222325ULL;  // Empreinte FNV-1a des entrées [0, m_indexed)
+    const StringPool* m_pool = nullptr;              // Pool indexé, nullptr pour un index chargé
+    std::unordered_map<uint32_t, std::vector<StringId>> m_postings;
+    mutable std::shared_mutex m_mutex;
+};
+
+} // namespace dataframe
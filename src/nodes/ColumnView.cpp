@@ -0,0 +1,70 @@
+#include "nodes/ColumnView.hpp"
+#include <stdexcept>
+
+namespace nodes {
+
+dataframe::IColumnPtr resolveFieldColumn(const Workload& workload, const dataframe::DataFrame& csv) {
+    const std::string& columnName = workload.getString();
+    if (!csv.hasColumn(columnName)) {
+        std::string availableCols;
+        for (const auto& col : csv.getColumnNames()) {
+            if (!availableCols.empty()) availableCols += ", ";
+            availableCols += "'" + col + "'";
+        }
+        throw std::runtime_error("Column '" + columnName + "' not found. Available: " + availableCols);
+    }
+    return csv.getColumn(columnName);
+}
+
+StringView::StringView(const Workload& workload, const dataframe::DataFrame& csv) {
+    switch (workload.getType()) {
+        case NodeType::String:
+            m_constant = workload.getString();
+            return;
+        case NodeType::Int:
+            m_constant = std::to_string(workload.getInt());
+            return;
+        case NodeType::Double:
+            m_constant = std::to_string(workload.getDouble());
+            return;
+        case NodeType::Bool:
+            m_constant = workload.getBool() ? "true" : "false";
+            return;
+        case NodeType::Field:
+            break;
+        default:
+            throw std::runtime_error("Cannot get string at row from type: " +
+                                     nodeTypeToString(workload.getType()));
+    }
+
+    m_column = resolveFieldColumn(workload, csv);
+    switch (m_column->getType()) {
+        case dataframe::ColumnTypeOpt::STRING: {
+            const auto& strCol = static_cast<const dataframe::StringColumn&>(*m_column);
+            m_kind = Kind::Pooled;
+            m_pool = strCol.getStringPool().get();
+            m_ids = strCol.data().data();
+            break;
+        }
+        case dataframe::ColumnTypeOpt::INT: {
+            const auto& data = static_cast<const dataframe::IntColumn&>(*m_column).data();
+            m_kind = Kind::Formatted;
+            m_formatted.reserve(data.size());
+            for (int value : data) {
+                m_formatted.push_back(std::to_string(value));
+            }
+            break;
+        }
+        case dataframe::ColumnTypeOpt::DOUBLE: {
+            const auto& data = static_cast<const dataframe::DoubleColumn&>(*m_column).data();
+            m_kind = Kind::Formatted;
+            m_formatted.reserve(data.size());
+            for (double value : data) {
+                m_formatted.push_back(std::to_string(value));
+            }
+            break;
+        }
+    }
+}
+
+} // namespace nodes
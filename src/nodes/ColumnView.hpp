@@ -0,0 +1,154 @@
+#pragma once
+
+#include "nodes/Types.hpp"
+#include "dataframe/DataFrame.hpp"
+#include "dataframe/Column.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace nodes {
+
+/**
+ * Resolve the column a Field workload refers to
+ * Throws "Column 'x' not found. Available: ..." like Workload::get*AtRow
+ */
+dataframe::IColumnPtr resolveFieldColumn(const Workload& workload, const dataframe::DataFrame& csv);
+
+/**
+ * Typed read-only view of a workload over the rows of a CSV
+ *
+ * Replaces per-row Workload::getDoubleAtRow / getIntAtRow: the column lookup
+ * and type dispatch happen once, then operator[] reads the column storage
+ * directly. Scalars broadcast as a constant view; STRING columns are parsed
+ * once per distinct string (std::stod / std::stoll, as the AtRow accessors).
+ *
+ * T is double or int64_t (int64_t truncates doubles, as getIntAtRow).
+ * The view keeps its column alive; it must not outlive the rows it reads.
+ *
+ * Usage:
+ *   NumericView<double> a(src, *csv);
+ *   for (size_t i = 0; i < csv->rowCount(); ++i) out.push_back(a[i] * 2);
+ */
+template<typename T>
+class NumericView {
+    static_assert(std::is_same_v<T, double> || std::is_same_v<T, int64_t>,
+                  "NumericView supports double and int64_t");
+
+public:
+    NumericView(const Workload& workload, const dataframe::DataFrame& csv) {
+        switch (workload.getType()) {
+            case NodeType::Int:
+                m_constant = static_cast<T>(workload.getInt());
+                return;
+            case NodeType::Double:
+                m_constant = static_cast<T>(workload.getDouble());
+                return;
+            case NodeType::String:
+                m_constant = parse(workload.getString());
+                return;
+            case NodeType::Field:
+                break;
+            default:
+                throw std::runtime_error(std::string("Cannot get ") +
+                    (std::is_same_v<T, double> ? "double" : "int") +
+                    " at row from type: " + nodeTypeToString(workload.getType()));
+        }
+
+        m_column = resolveFieldColumn(workload, csv);
+        switch (m_column->getType()) {
+            case dataframe::ColumnTypeOpt::INT:
+                m_kind = Kind::Int;
+                m_ints = static_cast<const dataframe::IntColumn&>(*m_column).data().data();
+                break;
+            case dataframe::ColumnTypeOpt::DOUBLE:
+                m_kind = Kind::Double;
+                m_doubles = static_cast<const dataframe::DoubleColumn&>(*m_column).data().data();
+                break;
+            case dataframe::ColumnTypeOpt::STRING: {
+                m_kind = Kind::Parsed;
+                const auto& strCol = static_cast<const dataframe::StringColumn&>(*m_column);
+                const auto& pool = *strCol.getStringPool();
+                std::unordered_map<dataframe::StringPool::StringId, T> parsed;
+                m_parsed.reserve(strCol.size());
+                for (auto id : strCol.data()) {
+                    auto it = parsed.find(id);
+                    if (it == parsed.end()) {
+                        it = parsed.emplace(id, parse(pool.getString(id))).first;
+                    }
+                    m_parsed.push_back(it->second);
+                }
+                break;
+            }
+        }
+    }
+
+    T operator[](size_t row) const {
+        switch (m_kind) {
+            case Kind::Int: return static_cast<T>(m_ints[row]);
+            case Kind::Double: return static_cast<T>(m_doubles[row]);
+            case Kind::Parsed: return m_parsed[row];
+            case Kind::Constant: break;
+        }
+        return m_constant;
+    }
+
+    bool isConstant() const { return m_kind == Kind::Constant; }
+
+private:
+    enum class Kind { Constant, Int, Double, Parsed };
+
+    static T parse(const std::string& str) {
+        if constexpr (std::is_same_v<T, double>) {
+            return std::stod(str);
+        } else {
+            return std::stoll(str);
+        }
+    }
+
+    Kind m_kind = Kind::Constant;
+    T m_constant{};
+    dataframe::IColumnPtr m_column;
+    const int* m_ints = nullptr;
+    const double* m_doubles = nullptr;
+    std::vector<T> m_parsed;
+};
+
+/**
+ * String view of a workload over the rows of a CSV (see NumericView)
+ *
+ * STRING columns are read through their pool without copying; INT / DOUBLE
+ * columns are formatted once with std::to_string, as getStringAtRow.
+ * References returned by operator[] are valid until the view is destroyed
+ * or a new string is interned in the column's pool.
+ */
+class StringView {
+public:
+    StringView(const Workload& workload, const dataframe::DataFrame& csv);
+
+    const std::string& operator[](size_t row) const {
+        switch (m_kind) {
+            case Kind::Pooled: return m_pool->getString(m_ids[row]);
+            case Kind::Formatted: return m_formatted[row];
+            case Kind::Constant: break;
+        }
+        return m_constant;
+    }
+
+    bool isConstant() const { return m_kind == Kind::Constant; }
+
+private:
+    enum class Kind { Constant, Pooled, Formatted };
+
+    Kind m_kind = Kind::Constant;
+    std::string m_constant;
+    dataframe::IColumnPtr m_column;
+    const dataframe::StringPool* m_pool = nullptr;
+    const dataframe::StringPool::StringId* m_ids = nullptr;
+    std::vector<std::string> m_formatted;
+};
+
+} // namespace nodes
@@ -1,5 +1,6 @@
 #include "nodes/DynRequest.hpp"
 #include "nodes/DateTimeUtil.hpp"
+#include "nodes/ColumnView.hpp"
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
@@ -138,9 +139,10 @@ DynRequest& DynRequest::addIntArrayFromWorkload(
 
     if (workload.isField() && csv) {
         // Extraire les valeurs de la colonne
-        auto header = csv->getColumnNames();
+        NumericView<int64_t> column(workload, *csv);
+        values.reserve(rowCount);
         for (size_t i = 0; i < rowCount; ++i) {
-            values.push_back(workload.getIntAtRow(i, header, csv));
+            values.push_back(column[i]);
         }
     } else {
         // Broadcast le scalaire sur toutes les lignes
@@ -168,9 +170,10 @@ DynRequest& DynRequest::addStringArrayFromWorkload(
 
     if (workload.isField() && csv) {
         // Extraire les valeurs de la colonne
-        auto header = csv->getColumnNames();
+        StringView column(workload, *csv);
+        values.reserve(rowCount);
         for (size_t i = 0; i < rowCount; ++i) {
-            values.push_back(workload.getStringAtRow(i, header, csv));
+            values.push_back(column[i]);
         }
     } else {
         // Broadcast le scalaire sur toutes les lignes
@@ -198,9 +201,10 @@ DynRequest& DynRequest::addDoubleArrayFromWorkload(
 
     if (workload.isField() && csv) {
         // Extraire les valeurs de la colonne
-        auto header = csv->getColumnNames();
+        NumericView<double> column(workload, *csv);
+        values.reserve(rowCount);
         for (size_t i = 0; i < rowCount; ++i) {
-            values.push_back(workload.getDoubleAtRow(i, header, csv));
+            values.push_back(column[i]);
         }
     } else {
         // Broadcast le scalaire sur toutes les lignes
@@ -280,7 +284,6 @@ DynRequest& DynRequest::addTimestampFromWorkload(
 
     // Field - extract from CSV and verify all values are equal
     if (type == NodeType::Field && csv) {
-        auto header = csv->getColumnNames();
         size_t rowCount = csv->rowCount();
 
         if (rowCount == 0) {
@@ -291,7 +294,8 @@ DynRequest& DynRequest::addTimestampFromWorkload(
         }
 
         // Get first value
-        std::string firstValueStr = workload.getStringAtRow(0, header, csv);
+        StringView column(workload, *csv);
+        const std::string& firstValueStr = column[0];
         int64_t firstTimestamp;
 
         // Try to parse as number first
@@ -303,7 +307,7 @@ DynRequest& DynRequest::addTimestampFromWorkload(
 
         // Verify all rows have the same value
         for (size_t i = 1; i < rowCount; ++i) {
-            std::string valueStr = workload.getStringAtRow(i, header, csv);
+            const std::string& valueStr = column[i];
             int64_t timestamp;
             try {
                 timestamp = std::stoll(valueStr);
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cstdint>
+#include <optional>
 #include <nlohmann/json.hpp>
 
 namespace nodes {
@@ -15,6 +16,39 @@ enum class ExecutionStatus {
     Failed      // Node had an error (red indicator)
 };
 
+/**
+ * Resources used by one node execution
+ *
+ * CPU time and allocations cover the node's compile function, including
+ * the worker threads its kernels start (runParallel). Allocations are only
+ * measured when AllocationHook.cpp is linked (anodeServer). DataFrame sizes
+ * count column data; columns shared with an input are counted again.
+ */
+struct NodeResources {
+    int64_t wallUs = 0;                      // Wall time, same span as durationMs
+    int64_t cpuUs = 0;                       // Thread CPU time of compile
+    std::optional<int64_t> allocatedBytes;   // Bytes requested from operator new
+    int64_t outputBytes = 0;                 // Column data of the Csv outputs
+    int64_t inputRows = 0;                   // Rows of the distinct Csv inputs
+    int64_t outputRows = 0;                  // Rows of the Csv outputs
+    int64_t stringPoolGrowth = 0;            // Strings added to the pools the node wrote
+
+    nlohmann::json toJson() const {
+        nlohmann::json j = {
+            {"wall_us", wallUs},
+            {"cpu_us", cpuUs},
+            {"output_bytes", outputBytes},
+            {"input_rows", inputRows},
+            {"output_rows", outputRows},
+            {"string_pool_growth", stringPoolGrowth}
+        };
+        if (allocatedBytes) {
+            j["allocated_bytes"] = *allocatedBytes;
+        }
+        return j;
+    }
+};
+
 /**
  * Event emitted during graph execution for real-time feedback
  */
@@ -24,6 +58,8 @@ struct ExecutionEvent {
     int64_t durationMs = 0;          // Execution time (only for Completed/Failed)
     std::string errorMessage;        // Error message (only for Failed)
     nlohmann::json csvMetadata;      // CSV output metadata (only for Completed with CSV output)
+    bool cached = false;             // Outputs reused from the result cache (only for Completed)
+    NodeResources resources;         // Resource accounting (only for Completed/Failed)
 
     /**
      * Convert to JSON for SSE transmission
@@ -39,6 +75,10 @@ struct ExecutionEvent {
             case ExecutionStatus::Completed:
                 j["status"] = "completed";
                 j["duration_ms"] = durationMs;
+                j["resources"] = resources.toJson();
+                if (cached) {
+                    j["cached"] = true;
+                }
                 if (!csvMetadata.empty()) {
                     j["csv_metadata"] = csvMetadata;
                 }
@@ -46,6 +86,7 @@ struct ExecutionEvent {
             case ExecutionStatus::Failed:
                 j["status"] = "failed";
                 j["duration_ms"] = durationMs;
+                j["resources"] = resources.toJson();
                 j["error_message"] = errorMessage;
                 break;
         }
@@ -0,0 +1,241 @@
+#include "nodes/ExecutionPlan.hpp"
+#include "nodes/NodeExecutor.hpp"
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+
+namespace nodes {
+
+namespace {
+
+// _label property of a label node, empty if unset
+std::string labelOf(const NodeInstance& instance) {
+    auto it = instance.properties.find("_label");
+    if (it == instance.properties.end() || it->second.isNull()) {
+        return "";
+    }
+    return it->second.getString();
+}
+
+// Name widget of an output node: _name (data/output) or _<kind>_name (viz outputs)
+std::string outputNameOf(const NodeInstance& instance) {
+    for (const auto& [name, value] : instance.properties) {
+        bool isNameWidget = name == "_name" ||
+            (name.size() > 6 && name[0] == '_' && name.compare(name.size() - 5, 5, "_name") == 0);
+        if (isNameWidget && value.getType() == NodeType::String) {
+            return value.getString();
+        }
+    }
+    return "";
+}
+
+} // namespace
+
+std::shared_ptr<const ExecutionPlan> ExecutionPlan::compile(const NodeGraph& graph,
+                                                            const NodeRegistry& registry) {
+    // Temporary indices, in graph iteration order
+    std::vector<const NodeInstance*> instances;
+    std::vector<std::string> ids;
+    std::unordered_map<std::string, size_t> index;
+    for (const auto& [nodeId, instance] : graph.getNodes()) {
+        index[nodeId] = instances.size();
+        instances.push_back(&instance);
+        ids.push_back(nodeId);
+    }
+    size_t count = instances.size();
+
+    // Build adjacency list and in-degree count
+    std::vector<std::vector<size_t>> dependents(count);  // node -> nodes that depend on it
+    std::vector<int> inDegree(count, 0);
+    auto addEdge = [&](size_t from, size_t to) {
+        dependents[from].push_back(to);
+        inDegree[to]++;
+    };
+
+    for (const auto& conn : graph.getConnections()) {
+        auto from = index.find(conn.sourceNodeId);
+        auto to = index.find(conn.targetNodeId);
+        if (from == index.end() || to == index.end()) continue;
+        addEdge(from->second, to->second);
+    }
+
+    // Add implicit dependencies between label_define_* and label_ref_* with same _label
+    // This ensures that ref nodes execute after their corresponding define nodes
+    std::unordered_map<std::string, size_t> labelDefines;  // identifier -> node
+    std::unordered_map<std::string, std::vector<size_t>> labelRefs;  // identifier -> nodes
+
+    for (size_t i = 0; i < count; ++i) {
+        // Handles both "label_define_x" and "label/label_define_x"
+        const auto& definitionName = instances[i]->definitionName;
+        if (definitionName.find("label_define_") != std::string::npos) {
+            std::string identifier = labelOf(*instances[i]);
+            if (!identifier.empty()) {
+                labelDefines[identifier] = i;
+            }
+        } else if (definitionName.find("label_ref_") != std::string::npos) {
+            std::string identifier = labelOf(*instances[i]);
+            if (!identifier.empty()) {
+                labelRefs[identifier].push_back(i);
+            }
+        }
+    }
+
+    // Add implicit edges: define -> ref (for same identifier)
+    for (const auto& [identifier, defineNode] : labelDefines) {
+        auto refIt = labelRefs.find(identifier);
+        if (refIt != labelRefs.end()) {
+            for (size_t refNode : refIt->second) {
+                addEdge(defineNode, refNode);
+            }
+        }
+    }
+
+    // Kahn: nodes with no dependencies first
+    std::vector<int> remaining = inDegree;
+    std::queue<size_t> ready;
+    for (size_t i = 0; i < count; ++i) {
+        if (remaining[i] == 0) {
+            ready.push(i);
+        }
+    }
+
+    std::vector<size_t> order;
+    order.reserve(count);
+    while (!ready.empty()) {
+        size_t i = ready.front();
+        ready.pop();
+        order.push_back(i);
+
+        for (size_t dependent : dependents[i]) {
+            if (--remaining[dependent] == 0) {
+                ready.push(dependent);
+            }
+        }
+    }
+
+    // Check for cycles
+    if (order.size() != count) {
+        throw std::runtime_error("Cycle detected in node graph");
+    }
+
+    // Slots follow the execution order
+    std::vector<size_t> slotOfIndex(count);
+    for (size_t slot = 0; slot < count; ++slot) {
+        slotOfIndex[order[slot]] = slot;
+    }
+
+    std::shared_ptr<ExecutionPlan> plan(new ExecutionPlan());
+    plan->m_nodes.resize(count);
+    plan->m_slots.reserve(count);
+    for (size_t slot = 0; slot < count; ++slot) {
+        size_t i = order[slot];
+        const NodeInstance& instance = *instances[i];
+        Node& node = plan->m_nodes[slot];
+
+        node.id = ids[i];
+        node.definitionName = instance.definitionName;
+        node.definition = registry.getNode(instance.definitionName);
+        node.properties.assign(instance.properties.begin(), instance.properties.end());
+
+        auto identIt = instance.properties.find("_identifier");
+        if (identIt != instance.properties.end() && !identIt->second.isNull()) {
+            node.identifier = identIt->second.getString();
+        }
+        if (node.definition && node.definition->findOutput("output_name")) {
+            node.outputName = outputNameOf(instance);
+        }
+
+        for (size_t dependent : dependents[i]) {
+            node.dependents.push_back(slotOfIndex[dependent]);
+        }
+        node.dependencyCount = inDegree[i];
+
+        plan->m_slots[node.id] = slot;
+    }
+
+    // Input bindings, in connection order (the first Csv input becomes the active CSV)
+    for (const auto& conn : graph.getConnections()) {
+        auto from = index.find(conn.sourceNodeId);
+        auto to = index.find(conn.targetNodeId);
+        if (from == index.end() || to == index.end()) continue;
+
+        InputBinding binding;
+        binding.source = slotOfIndex[from->second];
+        binding.sourcePort = conn.sourcePortName;
+        binding.targetPort = conn.targetPortName;
+        binding.expandFields =
+            instances[from->second]->definitionName.find("string_as_fields") != std::string::npos;
+        plan->m_nodes[slotOfIndex[to->second]].inputs.push_back(std::move(binding));
+    }
+
+    for (const auto& [identifier, defineNode] : labelDefines) {
+        auto refIt = labelRefs.find(identifier);
+        if (refIt == labelRefs.end()) continue;
+        for (size_t refNode : refIt->second) {
+            plan->m_nodes[slotOfIndex[refNode]].labelSource = slotOfIndex[defineNode];
+        }
+    }
+
+    // Liveness
+    for (auto& node : plan->m_nodes) {
+        for (const auto& binding : node.inputs) {
+            if (std::find(node.sources.begin(), node.sources.end(), binding.source) == node.sources.end()) {
+                node.sources.push_back(binding.source);
+                plan->m_nodes[binding.source].consumerCount++;
+            }
+        }
+        node.retained = node.definitionName.find("label_define_") != std::string::npos ||
+                        (node.definition && node.definition->findOutput("output_name"));
+    }
+
+    return plan;
+}
+
+size_t ExecutionPlan::slotOf(const std::string& nodeId) const {
+    auto it = m_slots.find(nodeId);
+    return it != m_slots.end() ? it->second : npos;
+}
+
+std::vector<bool> ExecutionPlan::cone(const std::unordered_set<std::string>& targets) const {
+    std::vector<bool> needed(m_nodes.size(), false);
+    std::vector<size_t> stack;
+    std::unordered_set<std::string> unmatched = targets;
+    for (size_t slot = 0; slot < m_nodes.size(); ++slot) {
+        const auto& node = m_nodes[slot];
+        bool matched = false;
+        for (const auto* key : {&node.id, &node.outputName}) {
+            if (!key->empty() && targets.contains(*key)) {
+                unmatched.erase(*key);
+                matched = true;
+            }
+        }
+        if (matched) {
+            needed[slot] = true;
+            stack.push_back(slot);
+        }
+    }
+    if (!unmatched.empty()) {
+        throw std::invalid_argument("Unknown target: " + *unmatched.begin());
+    }
+
+    // Walk upstream: bindings and the label definition of label_ref_* nodes
+    while (!stack.empty()) {
+        const auto& node = m_nodes[stack.back()];
+        stack.pop_back();
+        auto visit = [&](size_t slot) {
+            if (!needed[slot]) {
+                needed[slot] = true;
+                stack.push_back(slot);
+            }
+        };
+        for (size_t source : node.sources) {
+            visit(source);
+        }
+        if (node.labelSource != npos) {
+            visit(node.labelSource);
+        }
+    }
+    return needed;
+}
+
+} // namespace nodes
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "nodes/Types.hpp"
+#include "nodes/NodeDefinition.hpp"
+#include "nodes/NodeRegistry.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace nodes {
+
+class NodeGraph;
+
+/**
+ * Compiled form of a NodeGraph, reusable across executions
+ *
+ * Nodes are resolved once to dense slots numbered in topological order
+ * (explicit connections plus implicit label define -> ref edges), each
+ * with its definition, its properties and the list of input bindings
+ * feeding it. Executing a plan never scans the connection list: inputs
+ * are wired from the bindings and results are stored by slot.
+ *
+ * Liveness is precomputed too: each node knows the slots it reads from
+ * and how many slots read it, so intermediate DataFrames can be dropped
+ * after their last consumer (ExecutionOptions::retention).
+ *
+ * A plan holds copies of everything it needs; the graph it was compiled
+ * from can be modified or destroyed afterwards.
+ *
+ * Usage:
+ *   auto plan = ExecutionPlan::compile(graph, NodeRegistry::instance());
+ *   NodeExecutor executor(NodeRegistry::instance());
+ *   executor.execute(plan);
+ *   executor.execute(plan, overrides);  // Same plan, new run
+ */
+class ExecutionPlan {
+public:
+    /**
+     * Source of a node input: output sourcePort of node source
+     */
+    struct InputBinding {
+        size_t source;            // Slot of the upstream node
+        std::string sourcePort;
+        std::string targetPort;
+        bool expandFields = false;  // Source is string_as_fields: value -> targetPort,
+                                    // value_N -> targetPort_N
+    };
+
+    struct Node {
+        std::string id;
+        std::string definitionName;
+        NodeDefinitionPtr definition;  // nullptr if not found in the registry
+        std::vector<std::pair<std::string, Workload>> properties;
+        std::string identifier;        // _identifier property (csvOverrides), empty if none
+        std::string outputName;        // Output node: its name widget (_name, _chart_name...)
+        std::vector<InputBinding> inputs;  // In connection order
+        std::vector<size_t> dependents;    // Slots waiting on this node (one entry per edge)
+        int dependencyCount = 0;           // Incoming edges, including label edges
+        size_t labelSource = static_cast<size_t>(-1);  // label_ref_*: slot of its label_define_*
+
+        // Liveness: outputs are no longer needed once every consumer has run
+        std::vector<size_t> sources;       // Distinct slots read by the input bindings
+        size_t consumerCount = 0;          // Distinct slots reading this node's outputs
+        bool retained = false;             // Output node (output_name) or label definition
+    };
+
+    /**
+     * Compile a graph against a registry
+     * @throws std::runtime_error if the graph contains a cycle
+     */
+    static std::shared_ptr<const ExecutionPlan> compile(const NodeGraph& graph,
+                                                        const NodeRegistry& registry);
+
+    /**
+     * Nodes in execution order: slot i runs after all its upstream slots
+     */
+    const std::vector<Node>& nodes() const { return m_nodes; }
+    size_t size() const { return m_nodes.size(); }
+
+    /**
+     * Slot of a node id, or npos if the node is not in the plan
+     */
+    size_t slotOf(const std::string& nodeId) const;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * Slots needed to compute the targets (node ids or output names):
+     * the targets and everything upstream of them, label define -> ref
+     * edges included. Indexed by slot.
+     * @throws std::invalid_argument if a target matches no node
+     */
+    std::vector<bool> cone(const std::unordered_set<std::string>& targets) const;
+
+private:
+    ExecutionPlan() = default;
+
+    std::vector<Node> m_nodes;
+    std::unordered_map<std::string, size_t> m_slots;
+};
+
+using ExecutionPlanPtr = std::shared_ptr<const ExecutionPlan>;
+
+/**
+ * Property values replacing those of a shared plan for one execution
+ * (e.g. the "inputs" of an execute request). Copy-on-write: only the
+ * overridden properties are stored, the plan itself is never modified.
+ */
+class PropertyOverlay {
+public:
+    void set(size_t slot, const std::string& name, const Workload& value) {
+        m_values[slot][name] = value;
+    }
+
+    /**
+     * Overridden properties of a slot (nullptr if none)
+     */
+    const std::unordered_map<std::string, Workload>* find(size_t slot) const {
+        auto it = m_values.find(slot);
+        return it != m_values.end() ? &it->second : nullptr;
+    }
+
+    bool empty() const { return m_values.empty(); }
+
+private:
+    std::unordered_map<size_t, std::unordered_map<std::string, Workload>> m_values;
+};
+
+} // namespace nodes
@@ -8,17 +8,24 @@
 namespace nodes {
 
 /**
- * Singleton registry for storing named labels during graph execution.
+ * Registry for storing named labels during graph execution.
  *
  * Labels allow data to be named in one part of a graph (via label_define_*)
  * and referenced elsewhere (via label_ref_*) without visible connections.
  *
+ * Each NodeExecutor owns the scope of its executions and hands it to the
+ * nodes through NodeContext::labels(), so concurrent executions never see
+ * each other's labels.
+ *
  * Thread-safe for concurrent access.
  */
 class LabelRegistry {
 public:
+    LabelRegistry() = default;
+
     /**
-     * Get the singleton instance
+     * Process-wide scope, used by contexts without an execution scope
+     * (nodes compiled outside a NodeExecutor). Compatibility only.
      */
     static LabelRegistry& instance();
 
@@ -41,7 +48,7 @@ public:
 
     /**
      * Clear all labels.
-     * Should be called at the start of each graph execution.
+     * Called by NodeExecutor at the start of each graph execution.
      */
     void clear();
 
@@ -51,7 +58,6 @@ public:
     std::vector<std::string> getLabelNames() const;
 
 private:
-    LabelRegistry() = default;
     LabelRegistry(const LabelRegistry&) = delete;
     LabelRegistry& operator=(const LabelRegistry&) = delete;
 
@@ -48,6 +48,27 @@ NodeBuilder& NodeBuilder::entryPoint() {
     return *this;
 }
 
+NodeBuilder& NodeBuilder::memoize() {
+    m_cachePolicy.mode = CacheMode::Memoize;
+    return *this;
+}
+
+NodeBuilder& NodeBuilder::sideEffects() {
+    m_cachePolicy.mode = CacheMode::SideEffect;
+    return *this;
+}
+
+NodeBuilder& NodeBuilder::volatileResults(std::chrono::seconds ttl) {
+    m_cachePolicy.mode = CacheMode::Volatile;
+    m_cachePolicy.ttl = ttl;
+    return *this;
+}
+
+NodeBuilder& NodeBuilder::cacheKey(std::function<std::string(const NodeContext&)> key) {
+    m_cachePolicy.key = std::move(key);
+    return *this;
+}
+
 NodeDefinitionPtr NodeBuilder::build() {
     return std::make_shared<NodeDefinition>(
         m_name,
@@ -55,7 +76,8 @@ NodeDefinitionPtr NodeBuilder::build() {
         std::move(m_inputs),
         std::move(m_outputs),
         std::move(m_compileFunc),
-        m_isEntryPoint
+        m_isEntryPoint,
+        std::move(m_cachePolicy)
     );
 }
 
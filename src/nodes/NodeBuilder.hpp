@@ -80,6 +80,30 @@ public:
      */
     NodeBuilder& entryPoint();
 
+    // === Memoization (see ResultCache) ===
+
+    /**
+     * Results depend only on inputs and properties: reused across executions
+     * while they are unchanged (nodes that do not declare it always run)
+     */
+    NodeBuilder& memoize();
+
+    /**
+     * Compile has side effects: always run, even when inputs are unchanged
+     */
+    NodeBuilder& sideEffects();
+
+    /**
+     * Results may change between runs with the same inputs: never reused,
+     * or reused for ttl
+     */
+    NodeBuilder& volatileResults(std::chrono::seconds ttl = std::chrono::seconds(0));
+
+    /**
+     * Add state that the properties do not capture to the memoization key
+     */
+    NodeBuilder& cacheKey(std::function<std::string(const NodeContext&)> key);
+
     // === Build ===
 
     /**
@@ -104,6 +128,7 @@ private:
     std::vector<OutputDef> m_outputs;
     CompileFunction m_compileFunc;
     bool m_isEntryPoint = false;
+    CachePolicy m_cachePolicy;
 };
 
 // Convenience alias for cleaner API
@@ -1,4 +1,5 @@
 #include "nodes/NodeContext.hpp"
+#include "nodes/LabelRegistry.hpp"
 
 namespace nodes {
 
@@ -74,6 +75,15 @@ std::string NodeContext::getStringAtRow(const std::string& inputName, size_t row
     return workload.getStringAtRow(rowIndex, header, m_activeCsv);
 }
 
+const dataframe::DataFrame& NodeContext::viewCsv() const {
+    static const dataframe::DataFrame empty;
+    return m_activeCsv ? *m_activeCsv : empty;
+}
+
+LabelRegistry& NodeContext::labels() const {
+    return m_labels ? *m_labels : LabelRegistry::instance();
+}
+
 void NodeContext::setError(const std::string& message) {
     m_hasError = true;
     m_errorMessage = message;
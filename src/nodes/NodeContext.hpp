@@ -1,12 +1,16 @@
 #pragma once
 
 #include "nodes/Types.hpp"
+#include "nodes/ColumnView.hpp"
+#include "dataframe/Cancellation.hpp"
 #include <unordered_map>
 #include <string>
 #include <memory>
 
 namespace nodes {
 
+class LabelRegistry;
+
 /**
  * Execution context passed to node compile functions.
  * Provides access to inputs and allows setting outputs.
@@ -69,16 +73,54 @@ public:
      * Get value at specific row with automatic broadcasting
      * - Scalars: return same value for all rows
      * - Fields: lookup in active CSV
+     * Looks the column up on every call: use the views below in row loops
      */
     int64_t getIntAtRow(const std::string& inputName, size_t rowIndex) const;
     double getDoubleAtRow(const std::string& inputName, size_t rowIndex) const;
     std::string getStringAtRow(const std::string& inputName, size_t rowIndex) const;
 
+    /**
+     * Typed views of an input over the rows of the active CSV (see ColumnView.hpp)
+     * - Scalars: constant view
+     * - Fields: column resolved once, read in place
+     */
+    template<typename T = double>
+    NumericView<T> numericView(const std::string& inputName) const {
+        return NumericView<T>(getInputWorkload(inputName), viewCsv());
+    }
+    StringView stringView(const std::string& inputName) const {
+        return StringView(getInputWorkload(inputName), viewCsv());
+    }
+
     // === Request Context ===
 
     void setUserId(const std::string& userId) { m_userId = userId; }
     const std::string& getUserId() const { return m_userId; }
 
+    /**
+     * Labels of the current execution (label_define_* / label_ref_*).
+     * Falls back to LabelRegistry::instance() outside a NodeExecutor
+     */
+    void setLabels(LabelRegistry* labels) { m_labels = labels; }
+    LabelRegistry& labels() const;
+
+    /**
+     * Cancellation token of the current execution (nullptr: never cancelled).
+     * checkCancelled() throws dataframe::OperationCancelled once the execution
+     * is cancelled or past its deadline; the row overload only looks at the
+     * token every dataframe::CANCEL_CHECK_ROWS rows, for use in long loops
+     */
+    void setCancellation(std::shared_ptr<const dataframe::CancellationToken> token) {
+        m_cancellation = std::move(token);
+    }
+    const dataframe::CancellationToken* cancellation() const { return m_cancellation.get(); }
+    void checkCancelled() const {
+        if (m_cancellation) m_cancellation->throwIfCancelled();
+    }
+    void checkCancelled(size_t row) const {
+        if ((row & (dataframe::CANCEL_CHECK_ROWS - 1)) == 0) checkCancelled();
+    }
+
     // === Error Handling ===
 
     void setError(const std::string& message);
@@ -108,10 +150,15 @@ public:
     const std::unordered_map<std::string, Workload>& getInputs() const { return m_inputs; }
 
 private:
+    // Active CSV, or an empty frame (Field inputs then report a missing column)
+    const dataframe::DataFrame& viewCsv() const;
+
     std::unordered_map<std::string, Workload> m_inputs;
     std::unordered_map<std::string, Workload> m_outputs;
     std::shared_ptr<dataframe::DataFrame> m_activeCsv;
     std::string m_userId;
+    LabelRegistry* m_labels = nullptr;
+    std::shared_ptr<const dataframe::CancellationToken> m_cancellation;
     bool m_hasError = false;
     std::string m_errorMessage;
 };
@@ -8,7 +8,8 @@ NodeDefinition::NodeDefinition(
     std::vector<InputDef> inputs,
     std::vector<OutputDef> outputs,
     CompileFunction compileFunc,
-    bool isEntryPoint
+    bool isEntryPoint,
+    CachePolicy cachePolicy
 )
     : m_name(std::move(name))
     , m_category(std::move(category))
@@ -16,6 +17,7 @@ NodeDefinition::NodeDefinition(
     , m_outputs(std::move(outputs))
     , m_compileFunc(std::move(compileFunc))
     , m_isEntryPoint(isEntryPoint)
+    , m_cachePolicy(std::move(cachePolicy))
 {}
 
 const InputDef* NodeDefinition::findInput(const std::string& name) const {
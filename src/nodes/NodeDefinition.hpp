@@ -2,6 +2,7 @@
 
 #include "nodes/Types.hpp"
 #include "nodes/NodeContext.hpp"
+#include <chrono>
 #include <string>
 #include <vector>
 #include <functional>
@@ -38,6 +39,28 @@ struct OutputDef {
         : name(std::move(n)), type(std::move(t)) {}
 };
 
+/**
+ * How the results of a node may be reused across executions (see ResultCache)
+ */
+enum class CacheMode {
+    Never,       // Not declared reusable: always run (default, e.g. plugin nodes)
+    Memoize,     // Results depend only on inputs and properties (NodeBuilder::memoize)
+    SideEffect,  // Same, but compile has side effects (labels, connection pool): always run
+    Volatile     // Results may change between runs (clock, database)
+};
+
+struct CachePolicy {
+    CacheMode mode = CacheMode::Never;
+
+    /// Volatile only: results are reused for ttl (0: never reused).
+    /// Overridden per instance by the `_cache_ttl` property (seconds)
+    std::chrono::seconds ttl{0};
+
+    /// Extra key material computed from the inputs before compile,
+    /// for state the properties do not capture (e.g. a file's mtime)
+    std::function<std::string(const NodeContext&)> key;
+};
+
 /**
  * Complete node definition - immutable after creation
  *
@@ -52,7 +75,8 @@ public:
         std::vector<InputDef> inputs,
         std::vector<OutputDef> outputs,
         CompileFunction compileFunc,
-        bool isEntryPoint = false
+        bool isEntryPoint = false,
+        CachePolicy cachePolicy = {}
     );
 
     // Getters
@@ -61,6 +85,7 @@ public:
     const std::vector<InputDef>& getInputs() const { return m_inputs; }
     const std::vector<OutputDef>& getOutputs() const { return m_outputs; }
     bool isEntryPoint() const { return m_isEntryPoint; }
+    const CachePolicy& getCachePolicy() const { return m_cachePolicy; }
 
     /**
      * Find an input definition by name
@@ -86,6 +111,7 @@ private:
     std::vector<OutputDef> m_outputs;
     CompileFunction m_compileFunc;
     bool m_isEntryPoint;
+    CachePolicy m_cachePolicy;
 };
 
 using NodeDefinitionPtr = std::shared_ptr<const NodeDefinition>;
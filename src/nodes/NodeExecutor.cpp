@@ -1,13 +1,55 @@
 #include "nodes/NodeExecutor.hpp"
-#include "nodes/LabelRegistry.hpp"
-#include <queue>
+#include "dataframe/Parallel.hpp"
+#include "dataframe/ResourceMeter.hpp"
+#include <deque>
+#include <map>
 #include <unordered_set>
 #include <algorithm>
 #include <stdexcept>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace nodes {
 
+namespace {
+
+// StringPools reachable from a node's DataFrames: string nodes intern into
+// the pool of their input, so two nodes sharing a pool must not overlap
+std::vector<const dataframe::StringPool*> stringPoolsOf(const NodeContext& ctx) {
+    std::vector<const dataframe::StringPool*> pools;
+    auto add = [&](const std::shared_ptr<dataframe::DataFrame>& df) {
+        if (!df) return;
+        const auto* pool = df->getStringPool().get();
+        if (pool && std::find(pools.begin(), pools.end(), pool) == pools.end()) {
+            pools.push_back(pool);
+        }
+    };
+    add(ctx.getActiveCsv());
+    for (const auto& [name, input] : ctx.getInputs()) {
+        if (input.getType() == NodeType::Csv) {
+            add(input.getCsv());
+        }
+    }
+    return pools;
+}
+
+// Distinct DataFrames among Csv workloads
+std::vector<const dataframe::DataFrame*> framesOf(const std::unordered_map<std::string, Workload>& workloads) {
+    std::vector<const dataframe::DataFrame*> frames;
+    for (const auto& [name, workload] : workloads) {
+        if (workload.getType() != NodeType::Csv) continue;
+        const auto* df = workload.getCsv().get();
+        if (df && std::find(frames.begin(), frames.end(), df) == frames.end()) {
+            frames.push_back(df);
+        }
+    }
+    return frames;
+}
+
+} // namespace
+
 // =============================================================================
 // NodeGraph Implementation
 // =============================================================================
@@ -121,6 +163,7 @@ void NodeGraph::addNodeWithId(const std::string& id, const std::string& definiti
 
 NodeExecutor::NodeExecutor(const NodeRegistry& registry)
     : m_registry(registry)
+    , m_labels(std::make_unique<LabelRegistry>())
 {}
 
 void NodeExecutor::setExecutionCallback(ExecutionCallback callback) {
@@ -130,281 +173,627 @@ void NodeExecutor::setExecutionCallback(ExecutionCallback callback) {
 std::unordered_map<std::string, std::unordered_map<std::string, Workload>>
 NodeExecutor::execute(const NodeGraph& graph, const CsvOverrides& csvOverrides,
                       const std::string& userId) {
+    return execute(ExecutionPlan::compile(graph, m_registry), csvOverrides, userId);
+}
+
+std::unordered_map<std::string, std::unordered_map<std::string, Workload>>
+NodeExecutor::execute(const ExecutionPlanPtr& plan, const CsvOverrides& csvOverrides,
+                      const std::string& userId, const PropertyOverlay& overlay) {
+    m_plan = plan;
+    m_overlay = overlay.empty() ? nullptr : &overlay;
     m_results.clear();
+    m_results.resize(plan->size());
+    m_pendingConsumers.resize(plan->size());
+    if (m_options.targets.empty()) {
+        m_needed.clear();
+        for (size_t slot = 0; slot < plan->size(); ++slot) {
+            m_pendingConsumers[slot] = plan->nodes()[slot].consumerCount;
+        }
+    } else {
+        // Only the consumers that run count
+        m_needed = plan->cone(m_options.targets);
+        std::fill(m_pendingConsumers.begin(), m_pendingConsumers.end(), 0);
+        for (size_t slot = 0; slot < plan->size(); ++slot) {
+            if (!m_needed[slot]) continue;
+            for (size_t source : plan->nodes()[slot].sources) {
+                m_pendingConsumers[source]++;
+            }
+        }
+    }
+    m_fingerprints.assign(m_options.cache ? plan->size() : 0, 0);
+    m_knownPools.clear();
 
     // Clear labels from previous execution
-    LabelRegistry::instance().clear();
-
-    // Get execution order
-    auto order = topologicalSort(graph);
+    m_labels->clear();
 
-    // Execute each node
-    for (const auto& nodeId : order) {
-        const auto* instance = graph.getNode(nodeId);
-        if (!instance) continue;
+    // Kernels (filter, sort, join...) check the token of their thread
+    dataframe::CancellationScope cancellationScope(m_options.cancellation.get());
 
-        // Emit "started" event
-        if (m_callback) {
-            ExecutionEvent evt;
-            evt.nodeId = nodeId;
-            evt.status = ExecutionStatus::Started;
-            m_callback(evt);
+    size_t threads = std::min(dataframe::resolveThreads(m_options.threads), plan->size());
+    try {
+        if (threads > 1) {
+            executeParallel(csvOverrides, userId, threads);
+        } else {
+            executeSequential(csvOverrides, userId);
         }
+    } catch (...) {
+        m_overlay = nullptr;
+        throw;
+    }
+    m_overlay = nullptr;
 
-        auto startTime = std::chrono::high_resolution_clock::now();
-
-        auto def = m_registry.getNode(instance->definitionName);
-        if (!def) {
-            auto endTime = std::chrono::high_resolution_clock::now();
-            auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
-
-            NodeResult result;
-            result.nodeId = nodeId;
-            result.hasError = true;
-            result.errorMessage = "Node definition not found: " + instance->definitionName;
-            m_results[nodeId] = std::move(result);
-
-            // Emit "failed" event
-            if (m_callback) {
-                ExecutionEvent evt;
-                evt.nodeId = nodeId;
-                evt.status = ExecutionStatus::Failed;
-                evt.durationMs = durationMs;
-                evt.errorMessage = result.errorMessage;
-                m_callback(evt);
-            }
-            continue;
-        }
+    // Build return map
+    std::unordered_map<std::string, std::unordered_map<std::string, Workload>> outputs;
+    outputs.reserve(m_results.size());
+    for (const auto& result : m_results) {
+        if (result.nodeId.empty()) continue;  // Not executed
+        outputs[result.nodeId] = result.outputs;
+    }
+    return outputs;
+}
 
-        // Create context
-        NodeContext ctx;
-        ctx.setUserId(userId);
+NodeExecutor::PreparedNode NodeExecutor::prepareNode(size_t slot,
+                                                     const CsvOverrides& csvOverrides,
+                                                     const std::string& userId) const {
+    const auto& planNode = m_plan->nodes()[slot];
 
-        // Set active CSV if available
-        auto activeCsv = findActiveCsv(graph, nodeId);
-        if (activeCsv) {
-            ctx.setActiveCsv(activeCsv);
-        }
+    PreparedNode node;
+    node.slot = slot;
+    node.planNode = &planNode;
+    if (!planNode.definition) {
+        return node;
+    }
+
+    // Create context
+    NodeContext& ctx = node.ctx;
+    ctx.setUserId(userId);
+    ctx.setLabels(m_labels.get());
+    ctx.setCancellation(m_options.cancellation);
 
-        // Gather inputs from connected nodes
-        gatherInputs(graph, nodeId, ctx);
+    // Set active CSV if available
+    auto activeCsv = findActiveCsv(planNode);
+    if (activeCsv) {
+        ctx.setActiveCsv(activeCsv);
+    }
+
+    // Gather inputs from connected nodes
+    gatherInputs(planNode, ctx);
 
-        // Add properties as inputs (for widget values)
-        // Only if there's no connected input with the same name
-        for (const auto& [propName, propValue] : instance->properties) {
+    // Add properties as inputs (for widget values)
+    // Only if there's no connected input with the same name
+    // Overlay values come first and take precedence over the plan's
+    if (const auto* overridden = m_overlay ? m_overlay->find(slot) : nullptr) {
+        for (const auto& [propName, propValue] : *overridden) {
             if (!ctx.hasInputEntry(propName)) {
                 ctx.setInput(propName, propValue);
             }
         }
+    }
+    for (const auto& [propName, propValue] : planNode.properties) {
+        if (!ctx.hasInputEntry(propName)) {
+            ctx.setInput(propName, propValue);
+        }
+    }
 
-        // Check if this node has a DataFrame injected via _identifier (csvOverrides)
-        bool injected = false;
-        if (!csvOverrides.empty()) {
-            auto identIt = instance->properties.find("_identifier");
-            if (identIt != instance->properties.end() && !identIt->second.isNull()) {
-                std::string ident = identIt->second.getString();
-                if (!ident.empty()) {
-                    auto ovIt = csvOverrides.find(ident);
-                    if (ovIt != csvOverrides.end()) {
-                        ctx.setOutput("csv", Workload(ovIt->second));
-                        injected = true;
-                    }
-                }
+    // Check if this node has a DataFrame injected via _identifier (csvOverrides)
+    if (!csvOverrides.empty() && !planNode.identifier.empty()) {
+        auto ovIt = csvOverrides.find(planNode.identifier);
+        if (ovIt != csvOverrides.end()) {
+            ctx.setOutput("csv", Workload(ovIt->second));
+            node.injected = true;
+        }
+    }
+
+    if (m_options.cache) {
+        lookupResult(node);
+    }
+
+    return node;
+}
+
+void NodeExecutor::lookupResult(PreparedNode& node) const {
+    const auto& planNode = *node.planNode;
+    if (node.injected) {
+        node.fingerprint = ResultCache::uniqueFingerprint();
+        return;
+    }
+
+    // Properties sorted by name, overlay values first (same precedence as the inputs)
+    std::map<std::string, const Workload*> properties;
+    if (const auto* overridden = m_overlay ? m_overlay->find(node.slot) : nullptr) {
+        for (const auto& [propName, propValue] : *overridden) {
+            properties.emplace(propName, &propValue);
+        }
+    }
+    for (const auto& [propName, propValue] : planNode.properties) {
+        properties.emplace(propName, &propValue);
+    }
+
+    ResultHasher hasher;
+    hasher.add(planNode.definitionName).add(node.ctx.getUserId());
+    bool hashable = true;
+    for (const auto& [propName, propValue] : properties) {
+        hasher.add(propName);
+        hashable = hasher.add(*propValue) && hashable;  // Csv properties are not hashed
+    }
+    for (const auto& binding : planNode.inputs) {
+        hasher.add(binding.sourcePort).add(binding.targetPort)
+              .add(static_cast<uint64_t>(binding.expandFields))
+              .add(m_fingerprints[binding.source]);
+    }
+    if (planNode.labelSource != ExecutionPlan::npos) {
+        hasher.add(m_fingerprints[planNode.labelSource]);
+    }
+
+    const auto& policy = planNode.definition->getCachePolicy();
+    if (policy.key) {
+        hasher.add(policy.key(node.ctx));
+    }
+    if (!hashable) {
+        node.fingerprint = ResultCache::uniqueFingerprint();
+        return;
+    }
+    uint64_t key = hasher.value();
+    node.fingerprint = key;
+
+    switch (policy.mode) {
+        case CacheMode::Never:
+            // Unknown determinism: downstream keys follow the values produced
+            node.volatileOutputs = true;
+            return;
+        case CacheMode::SideEffect:
+            return;
+        case CacheMode::Volatile: {
+            auto ttlProp = node.ctx.getInputWorkload("_cache_ttl");
+            node.ttl = ttlProp.getType() == NodeType::Int ? std::chrono::seconds(ttlProp.getInt())
+                                                          : policy.ttl;
+            if (node.ttl.count() <= 0) {
+                node.volatileOutputs = true;
+                return;
             }
+            break;
         }
+        case CacheMode::Memoize:
+            break;
+    }
 
-        // Execute (skip compile if DataFrame was injected)
-        if (!injected) {
-            def->compile(ctx);
+    auto entry = m_options.cache->find(key);
+    if (!entry) {
+        node.key = key;
+        return;
+    }
+    for (const auto& [outName, outValue] : entry->outputs) {
+        node.ctx.setOutput(outName, outValue);
+    }
+    node.fingerprint = entry->fingerprint;
+    node.cached = true;
+}
+
+void NodeExecutor::storeResult(const PreparedNode& node) {
+    uint64_t fingerprint = node.fingerprint;
+    const auto& outputs = m_results[node.slot].outputs;
+
+    // Volatile without TTL: downstream keys follow the values produced this
+    // time (e.g. the current date); a DataFrame is never assumed unchanged
+    if (node.volatileOutputs) {
+        std::map<std::string, const Workload*> sorted;
+        for (const auto& [outName, outValue] : outputs) {
+            sorted.emplace(outName, &outValue);
         }
+        ResultHasher hasher;
+        hasher.add(fingerprint);
+        bool hashable = true;
+        for (const auto& [outName, outValue] : sorted) {
+            hasher.add(outName);
+            hashable = hasher.add(*outValue) && hashable;
+        }
+        fingerprint = hashable ? hasher.value() : ResultCache::uniqueFingerprint();
+    }
+
+    if (node.key && !node.ctx.hasError()) {
+        ResultCache::Entry entry;
+        entry.outputs = outputs;
+        if (node.ttl.count() > 0) {
+            // A refreshed volatile result must not match the previous one downstream
+            fingerprint = ResultHasher().add(fingerprint).add(ResultCache::uniqueFingerprint()).value();
+            entry.expiresAt = ResultCache::Clock::now() + node.ttl;
+        }
+        entry.fingerprint = fingerprint;
+        m_options.cache->put(*node.key, std::move(entry));
+    }
+    m_fingerprints[node.slot] = fingerprint;
+}
+
+void NodeExecutor::startNode(PreparedNode& node) {
+    // Emit "started" event
+    if (m_callback) {
+        ExecutionEvent evt;
+        evt.nodeId = node.planNode->id;
+        evt.status = ExecutionStatus::Started;
+        m_callback(evt);
+    }
+
+    node.startTime = std::chrono::high_resolution_clock::now();
+}
+
+void NodeExecutor::accountFrames(PreparedNode& node, std::chrono::microseconds wall) {
+    NodeResources& resources = node.resources;
+    resources.wallUs = wall.count();
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+    for (const auto* df : framesOf(node.ctx.getInputs())) {
+        resources.inputRows += static_cast<int64_t>(df->rowCount());
+        m_knownPools.insert(df->getStringPool().get());
+    }
+
+    // A pool no earlier node produced was filled by this node (csv_source, ...);
+    // pools of injected and cached outputs are only recorded
+    bool compiled = node.needsCompile();
+    for (const auto* df : framesOf(node.ctx.getOutputs())) {
+        resources.outputRows += static_cast<int64_t>(df->rowCount());
+        resources.outputBytes += static_cast<int64_t>(df->memoryUsage());
+        const auto* pool = df->getStringPool().get();
+        if (pool && m_knownPools.insert(pool).second && compiled) {
+            resources.stringPoolGrowth += static_cast<int64_t>(pool->size());
+        }
+    }
+}
+
+void NodeExecutor::finishNode(PreparedNode& node) {
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - node.startTime).count();
+    const std::string& nodeId = node.planNode->id;
+    accountFrames(node, std::chrono::duration_cast<std::chrono::microseconds>(endTime - node.startTime));
 
-        // Store result
+    if (!node.planNode->definition) {
         NodeResult result;
         result.nodeId = nodeId;
-        result.hasError = ctx.hasError();
-        result.errorMessage = ctx.getErrorMessage();
-        for (const auto& [outName, outValue] : ctx.getOutputs()) {
-            result.outputs[outName] = outValue;
-        }
-        m_results[nodeId] = std::move(result);
+        result.hasError = true;
+        result.errorMessage = "Node definition not found: " + node.planNode->definitionName;
+        result.resources = node.resources;
 
-        // Emit completion event
+        // Emit "failed" event
         if (m_callback) {
             ExecutionEvent evt;
             evt.nodeId = nodeId;
+            evt.status = ExecutionStatus::Failed;
             evt.durationMs = durationMs;
+            evt.resources = node.resources;
+            evt.errorMessage = result.errorMessage;
+            m_callback(evt);
+        }
+        m_results[node.slot] = std::move(result);
+        if (m_options.cache) {
+            m_fingerprints[node.slot] = ResultCache::uniqueFingerprint();
+        }
+        releaseInputs(node.slot);
+        return;
+    }
 
-            if (ctx.hasError()) {
-                evt.status = ExecutionStatus::Failed;
-                evt.errorMessage = ctx.getErrorMessage();
-            } else {
-                evt.status = ExecutionStatus::Completed;
-                // Add CSV metadata for outputs
-                for (const auto& [outName, outValue] : ctx.getOutputs()) {
-                    if (outValue.getType() == NodeType::Csv) {
-                        auto df = outValue.getCsv();
-                        if (df) {
-                            evt.csvMetadata[outName] = {
-                                {"rows", df->rowCount()},
-                                {"columns", df->getColumnNames()}
-                            };
-                        }
+    const NodeContext& ctx = node.ctx;
+
+    // Store result
+    NodeResult result;
+    result.nodeId = nodeId;
+    result.hasError = ctx.hasError();
+    result.errorMessage = ctx.getErrorMessage();
+    result.resources = node.resources;
+    for (const auto& [outName, outValue] : ctx.getOutputs()) {
+        result.outputs[outName] = outValue;
+    }
+    m_results[node.slot] = std::move(result);
+    if (m_options.cache) {
+        storeResult(node);
+    }
+
+    // Emit completion event
+    if (m_callback) {
+        ExecutionEvent evt;
+        evt.nodeId = nodeId;
+        evt.durationMs = durationMs;
+        evt.cached = node.cached;
+        evt.resources = node.resources;
+
+        if (ctx.hasError()) {
+            evt.status = ExecutionStatus::Failed;
+            evt.errorMessage = ctx.getErrorMessage();
+        } else {
+            evt.status = ExecutionStatus::Completed;
+            // Add CSV metadata for outputs
+            for (const auto& [outName, outValue] : ctx.getOutputs()) {
+                if (outValue.getType() == NodeType::Csv) {
+                    auto df = outValue.getCsv();
+                    if (df) {
+                        evt.csvMetadata[outName] = {
+                            {"rows", df->rowCount()},
+                            {"columns", df->getColumnNames()}
+                        };
                     }
                 }
             }
-            m_callback(evt);
         }
+        m_callback(evt);
     }
 
-    // Build return map
-    std::unordered_map<std::string, std::unordered_map<std::string, Workload>> outputs;
-    for (const auto& [nodeId, result] : m_results) {
-        outputs[nodeId] = result.outputs;
-    }
-    return outputs;
+    releaseInputs(node.slot);
 }
 
-NodeContext NodeExecutor::executeNode(const NodeDefinition& definition,
-                                       const std::unordered_map<std::string, Workload>& inputs) {
-    NodeContext ctx;
-    for (const auto& [name, value] : inputs) {
-        ctx.setInput(name, value);
+void NodeExecutor::releaseInputs(size_t slot) {
+    if (m_options.retention == Retention::All) return;
+
+    const auto& planNode = m_plan->nodes()[slot];
+    for (size_t source : planNode.sources) {
+        if (--m_pendingConsumers[source] == 0) {
+            releaseFrames(source);
+        }
+    }
+    // Nothing reads this node: its frames are only kept if they are outputs
+    if (m_pendingConsumers[slot] == 0) {
+        releaseFrames(slot);
     }
-    definition.compile(ctx);
-    return ctx;
 }
 
-const NodeResult* NodeExecutor::getResult(const std::string& nodeId) const {
-    auto it = m_results.find(nodeId);
-    return it != m_results.end() ? &it->second : nullptr;
-}
+void NodeExecutor::releaseFrames(size_t slot) {
+    const auto& planNode = m_plan->nodes()[slot];
+    if (planNode.retained || m_options.keep.contains(planNode.id) ||
+        m_options.targets.contains(planNode.id)) return;
 
-bool NodeExecutor::hasErrors() const {
-    for (const auto& [nodeId, result] : m_results) {
-        if (result.hasError) return true;
+    // Scalars are kept: they cost nothing and are reported with the results
+    auto& outputs = m_results[slot].outputs;
+    for (auto it = outputs.begin(); it != outputs.end();) {
+        it = it->second.getType() == NodeType::Csv ? outputs.erase(it) : std::next(it);
     }
-    return false;
 }
 
-std::vector<std::string> NodeExecutor::getErrors() const {
-    std::vector<std::string> errors;
-    for (const auto& [nodeId, result] : m_results) {
-        if (result.hasError) {
-            errors.push_back(nodeId + ": " + result.errorMessage);
+void NodeExecutor::executeSequential(const CsvOverrides& csvOverrides, const std::string& userId) {
+    // Slots are numbered in execution order
+    for (size_t slot = 0; slot < m_plan->size(); ++slot) {
+        if (!isNeeded(slot)) continue;
+        checkCancelled();
+        auto node = prepareNode(slot, csvOverrides, userId);
+        startNode(node);
+
+        // Execute (skip compile if DataFrame was injected)
+        if (node.needsCompile()) {
+            compileNode(node);
         }
+
+        finishNode(node);
     }
-    return errors;
 }
 
-std::vector<std::string> NodeExecutor::topologicalSort(const NodeGraph& graph) const {
-    // Build adjacency list and in-degree count
-    std::unordered_map<std::string, std::vector<std::string>> dependents;  // node -> nodes that depend on it
-    std::unordered_map<std::string, int> inDegree;
+void NodeExecutor::compileNode(PreparedNode& node) const {
+    // Pools the node may intern into (see stringPoolsOf), sizes before compile
+    std::vector<std::pair<const dataframe::StringPool*, size_t>> poolSizes;
+    for (const auto* pool : stringPoolsOf(node.ctx)) {
+        poolSizes.emplace_back(pool, pool->size());
+    }
+
+    dataframe::ResourceMeter meter;
+    {
+        dataframe::MeterScope scope(&meter);
+        node.planNode->definition->compile(node.ctx);
+    }
 
-    // Initialize
-    for (const auto& [nodeId, instance] : graph.getNodes()) {
-        inDegree[nodeId] = 0;
+    node.resources.cpuUs = static_cast<int64_t>(meter.cpuNs() / 1000);
+    if (dataframe::allocationHookInstalled()) {
+        node.resources.allocatedBytes = static_cast<int64_t>(meter.allocatedBytes());
+    }
+    for (const auto& [pool, before] : poolSizes) {
+        node.resources.stringPoolGrowth += static_cast<int64_t>(pool->size() - before);
     }
 
-    // Count incoming edges (dependencies)
-    for (const auto& conn : graph.getConnections()) {
-        inDegree[conn.targetNodeId]++;
-        dependents[conn.sourceNodeId].push_back(conn.targetNodeId);
+    if (node.ctx.hasError()) {
+        checkCancelled();
     }
+}
 
-    // Add implicit dependencies between label_define_* and label_ref_* with same _label
-    // This ensures that ref nodes execute after their corresponding define nodes
-    std::unordered_map<std::string, std::string> labelDefines;  // identifier -> nodeId
-    std::unordered_map<std::string, std::vector<std::string>> labelRefs;  // identifier -> nodeIds
+void NodeExecutor::executeParallel(const CsvOverrides& csvOverrides, const std::string& userId,
+                                   size_t threads) {
+    const auto& planNodes = m_plan->nodes();
+    std::vector<int> inDegree(planNodes.size());
+    for (size_t slot = 0; slot < planNodes.size(); ++slot) {
+        inDegree[slot] = planNodes[slot].dependencyCount;
+    }
 
-    for (const auto& [nodeId, instance] : graph.getNodes()) {
-        // Check if it's a label_define_* node (handles both "label_define_x" and "label/label_define_x")
-        if (instance.definitionName.find("label_define_") != std::string::npos) {
-            auto it = instance.properties.find("_label");
-            if (it != instance.properties.end() && !it->second.isNull()) {
-                std::string identifier = it->second.getString();
-                if (!identifier.empty()) {
-                    labelDefines[identifier] = nodeId;
-                }
+    // Ready nodes are dispatched by slot, i.e. in sequential execution order
+    std::map<size_t, std::unique_ptr<PreparedNode>> ready;
+    auto makeReady = [&](size_t slot) {
+        ready.emplace(slot, std::make_unique<PreparedNode>(prepareNode(slot, csvOverrides, userId)));
+    };
+    auto complete = [&](size_t slot) {
+        for (size_t dependent : planNodes[slot].dependents) {
+            if (--inDegree[dependent] == 0 && isNeeded(dependent)) {
+                makeReady(dependent);
             }
         }
-        // Check if it's a label_ref_* node (handles both "label_ref_x" and "label/label_ref_x")
-        else if (instance.definitionName.find("label_ref_") != std::string::npos) {
-            auto it = instance.properties.find("_label");
-            if (it != instance.properties.end() && !it->second.isNull()) {
-                std::string identifier = it->second.getString();
-                if (!identifier.empty()) {
-                    labelRefs[identifier].push_back(nodeId);
-                }
+    };
+
+    // Worker pool: compile only, everything else stays on this thread
+    struct Completion {
+        std::unique_ptr<PreparedNode> node;
+        std::vector<const dataframe::StringPool*> pools;
+        std::exception_ptr error;
+    };
+    std::mutex mutex;
+    std::condition_variable taskReady;
+    std::condition_variable taskDone;
+    std::deque<Completion> tasks;
+    std::deque<Completion> done;
+    bool stopping = false;
+
+    auto worker = [&]() {
+        dataframe::CancellationScope cancellationScope(m_options.cancellation.get());
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            taskReady.wait(lock, [&] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) return;
+            Completion task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+
+            try {
+                compileNode(*task.node);
+            } catch (...) {
+                task.error = std::current_exception();
             }
+
+            lock.lock();
+            done.push_back(std::move(task));
+            taskDone.notify_one();
         }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t k = 0; k < threads; ++k) {
+        workers.emplace_back(worker);
     }
 
-    // Add implicit edges: define -> ref (for same identifier)
-    for (const auto& [identifier, defineNodeId] : labelDefines) {
-        auto refIt = labelRefs.find(identifier);
-        if (refIt != labelRefs.end()) {
-            for (const auto& refNodeId : refIt->second) {
-                // Add implicit dependency: ref depends on define
-                inDegree[refNodeId]++;
-                dependents[defineNodeId].push_back(refNodeId);
+    std::unordered_set<const dataframe::StringPool*> busyPools;
+    size_t running = 0;
+    std::exception_ptr firstError;
+
+    try {
+        for (size_t slot = 0; slot < planNodes.size(); ++slot) {
+            if (inDegree[slot] == 0 && isNeeded(slot)) {
+                makeReady(slot);
             }
         }
-    }
 
-    // Start with nodes that have no dependencies (in-degree = 0)
-    std::queue<std::string> ready;
-    for (const auto& [nodeId, degree] : inDegree) {
-        if (degree == 0) {
-            ready.push(nodeId);
-        }
-    }
+        while (true) {
+            // Dispatch every ready node that does not share a StringPool with
+            // a running one; nodes without compile complete here, which can
+            // make others ready, hence the rescan
+            if (!firstError) checkCancelled();
+            bool rescan = true;
+            while (rescan && !firstError) {
+                rescan = false;
+                for (auto it = ready.begin(); it != ready.end();) {
+                    PreparedNode& node = *it->second;
+                    if (!node.needsCompile()) {
+                        auto inlineNode = std::move(it->second);
+                        it = ready.erase(it);
+                        startNode(*inlineNode);
+                        finishNode(*inlineNode);
+                        complete(inlineNode->slot);
+                        rescan = true;
+                        continue;
+                    }
 
-    // Process
-    std::vector<std::string> order;
-    while (!ready.empty()) {
-        std::string nodeId = ready.front();
-        ready.pop();
-        order.push_back(nodeId);
+                    auto pools = stringPoolsOf(node.ctx);
+                    bool conflict = std::any_of(pools.begin(), pools.end(),
+                        [&](const dataframe::StringPool* pool) { return busyPools.contains(pool); });
+                    if (conflict) {
+                        ++it;
+                        continue;
+                    }
 
-        // Reduce in-degree of dependents
-        for (const auto& dependent : dependents[nodeId]) {
-            inDegree[dependent]--;
-            if (inDegree[dependent] == 0) {
-                ready.push(dependent);
+                    busyPools.insert(pools.begin(), pools.end());
+                    startNode(node);
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        tasks.push_back({std::move(it->second), std::move(pools), nullptr});
+                    }
+                    taskReady.notify_one();
+                    running++;
+                    it = ready.erase(it);
+                }
+            }
+
+            if (running == 0) break;
+
+            // Wait for completions, handled in order of arrival
+            std::deque<Completion> completed;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskDone.wait(lock, [&] { return !done.empty(); });
+                completed.swap(done);
+            }
+            for (auto& completion : completed) {
+                running--;
+                for (const auto* pool : completion.pools) {
+                    busyPools.erase(pool);
+                }
+                if (completion.error) {
+                    if (!firstError) firstError = completion.error;
+                    continue;
+                }
+                finishNode(*completion.node);
+                if (!firstError) {
+                    complete(completion.node->slot);
+                }
             }
         }
+    } catch (...) {
+        // Callback or input gathering failed: queued nodes are dropped,
+        // running ones finish before the workers are joined
+        if (!firstError) firstError = std::current_exception();
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.clear();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskReady.notify_all();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+NodeContext NodeExecutor::executeNode(const NodeDefinition& definition,
+                                       const std::unordered_map<std::string, Workload>& inputs) {
+    NodeContext ctx;
+    for (const auto& [name, value] : inputs) {
+        ctx.setInput(name, value);
     }
+    definition.compile(ctx);
+    return ctx;
+}
 
-    // Check for cycles
-    if (order.size() != graph.getNodes().size()) {
-        throw std::runtime_error("Cycle detected in node graph");
+const NodeResult* NodeExecutor::getResult(const std::string& nodeId) const {
+    if (!m_plan) return nullptr;
+    size_t slot = m_plan->slotOf(nodeId);
+    if (slot == ExecutionPlan::npos || m_results[slot].nodeId.empty()) {
+        return nullptr;
     }
+    return &m_results[slot];
+}
 
-    return order;
+bool NodeExecutor::hasErrors() const {
+    for (const auto& result : m_results) {
+        if (result.hasError) return true;
+    }
+    return false;
 }
 
-void NodeExecutor::gatherInputs(const NodeGraph& graph,
-                                const std::string& nodeId,
-                                NodeContext& ctx) const {
-    // For each connection targeting this node
-    for (const auto& conn : graph.getConnections()) {
-        if (conn.targetNodeId != nodeId) continue;
+std::vector<std::string> NodeExecutor::getErrors() const {
+    std::vector<std::string> errors;
+    for (const auto& result : m_results) {
+        if (result.hasError) {
+            errors.push_back(result.nodeId + ": " + result.errorMessage);
+        }
+    }
+    return errors;
+}
 
+void NodeExecutor::gatherInputs(const ExecutionPlan::Node& planNode, NodeContext& ctx) const {
+    // For each binding targeting this node
+    for (const auto& binding : planNode.inputs) {
         // Get output from source node
-        auto it = m_results.find(conn.sourceNodeId);
-        if (it == m_results.end()) continue;
+        const auto& source = m_results[binding.source];
+        if (source.nodeId.empty()) continue;
 
-        // Check if source is a string_as_fields node → expand into multiple inputs
-        const auto* sourceInstance = graph.getNode(conn.sourceNodeId);
-        if (sourceInstance &&
-            sourceInstance->definitionName.find("string_as_fields") != std::string::npos) {
+        // Source is a string_as_fields node → expand into multiple inputs
+        if (binding.expandFields) {
             // Expand: map value→targetPort, value_N→targetPort_N
-            const std::string& basePort = conn.targetPortName;
-            for (const auto& [outName, outValue] : it->second.outputs) {
+            const std::string& basePort = binding.targetPort;
+            for (const auto& [outName, outValue] : source.outputs) {
                 if (outValue.isNull()) continue;
                 std::string targetPort;
                 if (outName == "value") {
@@ -421,27 +810,21 @@ void NodeExecutor::gatherInputs(const NodeGraph& graph,
             continue;
         }
 
-        auto outIt = it->second.outputs.find(conn.sourcePortName);
-        if (outIt == it->second.outputs.end()) continue;
+        auto outIt = source.outputs.find(binding.sourcePort);
+        if (outIt == source.outputs.end()) continue;
 
         // Set as input
-        ctx.setInput(conn.targetPortName, outIt->second);
+        ctx.setInput(binding.targetPort, outIt->second);
     }
 }
 
-std::shared_ptr<dataframe::DataFrame> NodeExecutor::findActiveCsv(
-    const NodeGraph& graph,
-    const std::string& nodeId) const {
-
+std::shared_ptr<dataframe::DataFrame> NodeExecutor::findActiveCsv(const ExecutionPlan::Node& planNode) const {
     // Look through inputs for a CSV
-    for (const auto& conn : graph.getConnections()) {
-        if (conn.targetNodeId != nodeId) continue;
-
-        auto it = m_results.find(conn.sourceNodeId);
-        if (it == m_results.end()) continue;
+    for (const auto& binding : planNode.inputs) {
+        const auto& source = m_results[binding.source];
 
-        auto outIt = it->second.outputs.find(conn.sourcePortName);
-        if (outIt == it->second.outputs.end()) continue;
+        auto outIt = source.outputs.find(binding.sourcePort);
+        if (outIt == source.outputs.end()) continue;
 
         if (outIt->second.getType() == NodeType::Csv) {
             return outIt->second.getCsv();
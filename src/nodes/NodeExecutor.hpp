@@ -5,11 +5,16 @@
 #include "nodes/NodeDefinition.hpp"
 #include "nodes/NodeRegistry.hpp"
 #include "nodes/ExecutionEvent.hpp"
+#include "nodes/ExecutionPlan.hpp"
+#include "nodes/LabelRegistry.hpp"
+#include "nodes/ResultCache.hpp"
 #include "dataframe/DataFrame.hpp"
 #include <array>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <optional>
 #include <functional>
@@ -151,17 +156,74 @@ struct NodeResult {
     std::unordered_map<std::string, Workload> outputs;
     bool hasError = false;
     std::string errorMessage;
+    NodeResources resources;
 };
 
 /// Map from _identifier string to a DataFrame to inject into matching csv_source nodes
 using CsvOverrides = std::unordered_map<std::string, std::shared_ptr<dataframe::DataFrame>>;
 
+/**
+ * What happens to intermediate DataFrames during an execution
+ */
+enum class Retention {
+    All,      // Debug: every node's outputs are kept until the end of execute()
+    Outputs   // Production: a node's DataFrame outputs are dropped once its last
+              // consumer has run, except output nodes, label definitions and
+              // nodes listed in ExecutionOptions::keep
+};
+
+/**
+ * Execution options
+ */
+struct ExecutionOptions {
+    /// Worker threads: 1 executes nodes one at a time in topological order,
+    /// 0 uses std::thread::hardware_concurrency()
+    size_t threads = 1;
+
+    Retention retention = Retention::All;
+
+    /// Node ids whose outputs are kept with Retention::Outputs (inspection)
+    std::unordered_set<std::string> keep;
+
+    /// Memoized node results shared across executions (nullptr: every node runs)
+    ResultCachePtr cache;
+
+    /// Node ids or output names to compute (empty: the whole graph). Only
+    /// the targets and their upstream nodes run; their outputs are kept
+    /// with Retention::Outputs
+    std::unordered_set<std::string> targets;
+
+    /// Cancellation and deadline (nullptr: runs to completion). Checked
+    /// before each node and periodically inside long kernels; execute()
+    /// then throws dataframe::OperationCancelled
+    std::shared_ptr<dataframe::CancellationToken> cancellation;
+};
+
 /**
  * Executes a node graph
  *
- * Uses topological sort to determine execution order,
- * then executes each node in sequence, passing outputs
- * from upstream nodes as inputs to downstream nodes.
+ * Compiles the graph into an ExecutionPlan (topological order, input
+ * bindings), then executes each node in sequence, passing outputs
+ * from upstream nodes as inputs to downstream nodes. A precompiled
+ * plan can be executed directly to skip the compile step.
+ *
+ * With ExecutionOptions::threads > 1, nodes are dispatched to a worker
+ * pool as soon as all their upstream nodes (including implicit label
+ * define -> ref edges) have completed. Ready nodes are dispatched in
+ * topological order, and two nodes whose input DataFrames share a
+ * StringPool never run concurrently (nodes intern strings into the pool
+ * of their input). Inputs are gathered, results stored and callbacks
+ * invoked on the calling thread, so events and result maps are the same
+ * as in sequential mode.
+ *
+ * With ExecutionOptions::cache, each node is keyed by its definition,
+ * properties, user and the fingerprints of its upstream results. A node
+ * whose key is cached completes with the cached outputs instead of
+ * compiling; only nodes downstream of a changed property or input run.
+ * Only nodes declared with NodeBuilder::memoize (or volatileResults with
+ * a TTL) are served from the cache; the others, plugin nodes included,
+ * always run. Injected DataFrames (csvOverrides)
+ * are not hashed: everything downstream of them runs.
  */
 class NodeExecutor {
 public:
@@ -176,6 +238,12 @@ public:
      */
     void setExecutionCallback(ExecutionCallback callback);
 
+    /**
+     * Set execution options (sequential by default)
+     */
+    void setOptions(const ExecutionOptions& options) { m_options = options; }
+    const ExecutionOptions& getOptions() const { return m_options; }
+
     /**
      * Execute all nodes in the graph
      *
@@ -186,6 +254,15 @@ public:
     execute(const NodeGraph& graph, const CsvOverrides& csvOverrides = {},
             const std::string& userId = "");
 
+    /**
+     * Execute a precompiled plan (see ExecutionPlan::compile)
+     *
+     * @param overlay Property values replacing the plan's for this execution
+     */
+    std::unordered_map<std::string, std::unordered_map<std::string, Workload>>
+    execute(const ExecutionPlanPtr& plan, const CsvOverrides& csvOverrides = {},
+            const std::string& userId = "", const PropertyOverlay& overlay = {});
+
     /**
      * Execute a single node definition (for testing)
      */
@@ -207,30 +284,114 @@ public:
      */
     std::vector<std::string> getErrors() const;
 
+    /**
+     * Labels defined by the last execution
+     */
+    const LabelRegistry& labels() const { return *m_labels; }
+
 private:
     const NodeRegistry& m_registry;
-    std::unordered_map<std::string, NodeResult> m_results;
+    ExecutionPlanPtr m_plan;              // Plan of the last execution
+    const PropertyOverlay* m_overlay = nullptr;  // During execute() only
+    std::vector<size_t> m_pendingConsumers;      // By slot, consumers not yet finished
+    std::vector<uint64_t> m_fingerprints;        // By slot, with ExecutionOptions::cache
+    std::vector<bool> m_needed;                  // By slot, with ExecutionOptions::targets
+    std::unordered_set<const dataframe::StringPool*> m_knownPools;  // Pools of the outputs so far
+    std::unique_ptr<LabelRegistry> m_labels;     // Label scope of the executions
+    std::vector<NodeResult> m_results;    // By plan slot, nodeId empty if not executed
     ExecutionCallback m_callback;  // Optional callback for real-time events
+    ExecutionOptions m_options;
+
+    /**
+     * A node whose inputs are gathered, ready to compile
+     */
+    struct PreparedNode {
+        size_t slot = 0;
+        const ExecutionPlan::Node* planNode = nullptr;
+        NodeContext ctx;
+        bool injected = false;         // Output injected via csvOverrides, no compile
+        std::chrono::high_resolution_clock::time_point startTime;
+
+        // Memoization (ExecutionOptions::cache)
+        bool cached = false;           // Outputs served from the cache, no compile
+        std::optional<uint64_t> key;   // Set if the result is to be stored
+        std::chrono::seconds ttl{0};   // Volatile results: lifetime of the stored entry
+        uint64_t fingerprint = 0;      // Identity of the outputs in downstream keys
+        bool volatileOutputs = false;  // Fingerprint taken from the outputs themselves
+
+        // Filled by compileNode (CPU, allocations, growth of the input pools)
+        // and finishNode (wall time, rows, sizes, new pools)
+        NodeResources resources;
+
+        bool needsCompile() const { return planNode->definition && !injected && !cached; }
+    };
+
+    PreparedNode prepareNode(size_t slot, const CsvOverrides& csvOverrides,
+                             const std::string& userId) const;
+
+    /**
+     * Compute the node's key and serve its outputs from the cache if present
+     */
+    void lookupResult(PreparedNode& node) const;
+
+    /**
+     * Record the node's fingerprint and store its result in the cache
+     */
+    void storeResult(const PreparedNode& node);
+
+    /**
+     * Emit the "started" event and start the node's clock
+     */
+    void startNode(PreparedNode& node);
+
+    /**
+     * Store the node's result and emit its completion event
+     */
+    void finishNode(PreparedNode& node);
 
     /**
-     * Topological sort - returns execution order
-     * Entry points first, then nodes in dependency order
+     * Whether a slot runs in this execution (ExecutionOptions::targets)
      */
-    std::vector<std::string> topologicalSort(const NodeGraph& graph) const;
+    bool isNeeded(size_t slot) const { return m_needed.empty() || m_needed[slot]; }
+
+    /**
+     * Throw dataframe::OperationCancelled if the execution is cancelled
+     */
+    void checkCancelled() const {
+        if (m_options.cancellation) m_options.cancellation->throwIfCancelled();
+    }
+
+    /**
+     * Compile a node and meter it; an error reported while the execution is
+     * cancelled (a node catching OperationCancelled) is rethrown as a cancellation
+     */
+    void compileNode(PreparedNode& node) const;
+
+    /**
+     * Rows and sizes of the node's frames, strings added to pools first seen
+     * in its outputs
+     */
+    void accountFrames(PreparedNode& node, std::chrono::microseconds wall);
+
+    /**
+     * Liveness: a node finished, drop the DataFrames nobody will read anymore
+     */
+    void releaseInputs(size_t slot);
+    void releaseFrames(size_t slot);
+
+    void executeSequential(const CsvOverrides& csvOverrides, const std::string& userId);
+    void executeParallel(const CsvOverrides& csvOverrides, const std::string& userId,
+                         size_t threads);
 
     /**
      * Gather inputs for a node from already-executed nodes
      */
-    void gatherInputs(const NodeGraph& graph,
-                      const std::string& nodeId,
-                      NodeContext& ctx) const;
+    void gatherInputs(const ExecutionPlan::Node& planNode, NodeContext& ctx) const;
 
     /**
-     * Find which CSV should be active for a node
+     * Find which CSV should be active for a node: first Csv input
      */
-    std::shared_ptr<dataframe::DataFrame> findActiveCsv(
-        const NodeGraph& graph,
-        const std::string& nodeId) const;
+    std::shared_ptr<dataframe::DataFrame> findActiveCsv(const ExecutionPlan::Node& planNode) const;
 };
 
 } // namespace nodes
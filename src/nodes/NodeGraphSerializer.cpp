@@ -170,6 +170,45 @@ json NodeGraphSerializer::workloadToJson(const Workload& w) {
     return result;
 }
 
+void NodeGraphSerializer::writeWorkload(dataframe::JsonWriter& out, const Workload& w) {
+    out.beginObject();
+    out.key("type").value(nodeTypeToString(w.getType()));
+
+    switch (w.getType()) {
+        case NodeType::Int:
+            out.key("value").value(w.getInt());
+            break;
+        case NodeType::Double:
+            out.key("value").value(w.getDouble());
+            break;
+        case NodeType::String:
+        case NodeType::Field:
+            out.key("value").value(w.getString());
+            break;
+        case NodeType::Bool:
+            out.key("value").value(w.getBool());
+            break;
+        case NodeType::Null:
+            out.key("value").null();
+            break;
+        case NodeType::Csv: {
+            auto df = w.getCsv();
+            if (df && df->rowCount() > 0) {
+                out.key("value");
+                dataframe::DataFrameSerializer::writeWithSchema(
+                    out,
+                    df->rowCount(),
+                    df->getColumnNames(),
+                    [&df](const std::string& name) { return df->getColumn(name); }
+                );
+            }
+            break;
+        }
+    }
+
+    out.endObject();
+}
+
 Workload NodeGraphSerializer::jsonToWorkload(const json& j) {
     if (!j.contains("type")) {
         throw std::runtime_error("Invalid workload: missing 'type'");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "nodes/NodeExecutor.hpp"
+#include "dataframe/JsonWriter.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 
@@ -50,6 +51,8 @@ public:
     // === Helpers (public for result serialization) ===
 
     static json workloadToJson(const Workload& w);
+    // Same document as workloadToJson, streamed into out (execution results)
+    static void writeWorkload(dataframe::JsonWriter& out, const Workload& w);
     static Workload jsonToWorkload(const json& j);
 
 private:
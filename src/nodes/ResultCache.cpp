@@ -0,0 +1,160 @@
+#include "nodes/ResultCache.hpp"
+#include "dataframe/DataFrame.hpp"
+#include <atomic>
+#include <cstring>
+#include <unordered_set>
+
+namespace nodes {
+
+void ResultCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+size_t ResultCache::capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+size_t ResultCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+void ResultCache::setMaxBytes(size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxBytes = maxBytes;
+    evict();
+}
+
+size_t ResultCache::maxBytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_maxBytes;
+}
+
+size_t ResultCache::bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytes;
+}
+
+std::optional<ResultCache::Entry> ResultCache::find(uint64_t key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        m_stats.misses++;
+        return std::nullopt;
+    }
+    if (it->second->second.expiresAt <= Clock::now()) {
+        m_bytes -= it->second->second.bytes;
+        m_lru.erase(it->second);
+        m_entries.erase(it);
+        m_stats.misses++;
+        return std::nullopt;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    m_stats.hits++;
+    return it->second->second;
+}
+
+void ResultCache::put(uint64_t key, Entry entry) {
+    // Each DataFrame counted once, even when several outputs share it
+    std::unordered_set<const dataframe::DataFrame*> frames;
+    entry.bytes = 0;
+    for (const auto& [name, output] : entry.outputs) {
+        if (output.getType() == NodeType::Csv) {
+            auto df = output.getCsv();
+            if (df && frames.insert(df.get()).second) {
+                entry.bytes += df->memoryUsage();
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0 || entry.bytes > m_maxBytes) {
+        return;
+    }
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        m_bytes -= it->second->second.bytes;
+        m_lru.erase(it->second);
+    }
+    m_bytes += entry.bytes;
+    m_lru.emplace_front(key, std::move(entry));
+    m_entries[key] = m_lru.begin();
+    evict();
+}
+
+void ResultCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lru.clear();
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+ResultCache::Stats ResultCache::stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+uint64_t ResultCache::uniqueFingerprint() {
+    static std::atomic<uint64_t> counter{0};
+    return ResultHasher().add(std::string("unique")).add(++counter).value();
+}
+
+void ResultCache::evict() {
+    while (!m_lru.empty() && (m_entries.size() > m_capacity || m_bytes > m_maxBytes)) {
+        m_bytes -= m_lru.back().second.bytes;
+        m_entries.erase(m_lru.back().first);
+        m_lru.pop_back();
+    }
+}
+
+// =============================================================================
+// ResultHasher
+// =============================================================================
+
+ResultHasher& ResultHasher::add(const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        m_hash ^= bytes[i];
+        m_hash *= 0x100000001b3ULL;
+    }
+    return *this;
+}
+
+ResultHasher& ResultHasher::add(const std::string& value) {
+    add(static_cast<uint64_t>(value.size()));
+    return add(value.data(), value.size());
+}
+
+bool ResultHasher::add(const Workload& workload) {
+    add(static_cast<uint64_t>(workload.getType()));
+    switch (workload.getType()) {
+        case NodeType::Int:
+            add(static_cast<uint64_t>(workload.getInt()));
+            return true;
+        case NodeType::Double: {
+            double value = workload.getDouble();
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            add(bits);
+            return true;
+        }
+        case NodeType::String:
+        case NodeType::Field:
+            add(workload.getString());
+            return true;
+        case NodeType::Bool:
+            add(static_cast<uint64_t>(workload.getBool()));
+            return true;
+        case NodeType::Null:
+            return true;
+        case NodeType::Csv:
+            return false;
+    }
+    return false;
+}
+
+} // namespace nodes
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "nodes/Types.hpp"
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace nodes {
+
+/**
+ * Bounded LRU cache of node results, shared across executions
+ *
+ * Entries are content-addressed: the key of a node is a hash of its
+ * definition name, its properties, the user and the fingerprints of
+ * its upstream results (see NodeExecutor). Editing one widget changes
+ * the key of that node and of everything downstream of it; every other
+ * node is served from the cache without running its compile function.
+ *
+ * Cached DataFrames are shared with the executions that hit them and
+ * must not be modified (nodes always build new frames). They keep those
+ * frames alive across executions, so the cache is bounded both by entry
+ * count and by the DataFrame bytes it holds (DataFrame::memoryUsage);
+ * a result larger than the byte budget is not cached.
+ * Thread-safe.
+ *
+ * Usage:
+ *   ExecutionOptions options;
+ *   options.cache = std::make_shared<ResultCache>(256, 256 << 20);
+ *   executor.setOptions(options);
+ */
+class ResultCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::unordered_map<std::string, Workload> outputs;
+        uint64_t fingerprint = 0;  // Identity of these outputs in downstream keys
+        Clock::time_point expiresAt = Clock::time_point::max();
+        size_t bytes = 0;  // DataFrame outputs, set by put()
+    };
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    static constexpr size_t DEFAULT_MAX_BYTES = size_t(256) << 20;
+
+    explicit ResultCache(size_t capacity = 256, size_t maxBytes = DEFAULT_MAX_BYTES)
+        : m_capacity(capacity), m_maxBytes(maxBytes) {}
+
+    /**
+     * Maximum number of node results kept (0 disables the cache)
+     */
+    void setCapacity(size_t capacity);
+    size_t capacity() const;
+    size_t size() const;
+
+    /**
+     * Maximum DataFrame bytes held by the cached results
+     */
+    void setMaxBytes(size_t maxBytes);
+    size_t maxBytes() const;
+    size_t bytes() const;
+
+    /**
+     * Entry for a key, marked as most recently used (expired entries are dropped)
+     */
+    std::optional<Entry> find(uint64_t key);
+
+    void put(uint64_t key, Entry entry);
+    void clear();
+
+    Stats stats() const;
+
+    /**
+     * A fingerprint no other result has, for outputs that cannot be
+     * identified by their inputs (injected DataFrames, volatile nodes)
+     */
+    static uint64_t uniqueFingerprint();
+
+private:
+    void evict();
+
+    size_t m_capacity;
+    size_t m_maxBytes;
+    size_t m_bytes = 0;
+    std::list<std::pair<uint64_t, Entry>> m_lru;  // Most recently used first
+    std::unordered_map<uint64_t, std::list<std::pair<uint64_t, Entry>>::iterator> m_entries;
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+};
+
+using ResultCachePtr = std::shared_ptr<ResultCache>;
+
+/**
+ * FNV-1a hash used for result keys and fingerprints
+ */
+class ResultHasher {
+public:
+    ResultHasher& add(const void* data, size_t size);
+    ResultHasher& add(const std::string& value);
+    ResultHasher& add(uint64_t value) { return add(&value, sizeof(value)); }
+
+    /**
+     * Scalar and Field values; returns false for a Csv workload,
+     * whose content is not hashed
+     */
+    bool add(const Workload& workload);
+
+    uint64_t value() const { return m_hash; }
+
+private:
+    uint64_t m_hash = 0xcbf29ce484222325ULL;
+};
+
+} // namespace nodes
@@ -17,6 +17,7 @@ void registerAggregateNodes() {
 
 void registerGroupNode() {
     auto builder = NodeBuilder("group", "aggregate")
+        .memoize()
         .input("csv", Type::Csv)
         .input("field", Type::Field);             // First field (required)
 
@@ -112,6 +113,7 @@ void registerGroupNode() {
 
 void registerPivotNode() {
     auto builder = NodeBuilder("pivot", "aggregate")
+        .memoize()
         .input("csv", Type::Csv)
         .input("pivot_column", Type::Field)
         .input("value_column", Type::Field)
@@ -189,6 +191,7 @@ void registerPivotNode() {
 
 void registerTreeGroupNode() {
     auto builder = NodeBuilder("tree_group", "aggregate")
+        .memoize()
         .input("csv", Type::Csv)
         .input("field", Type::Field);
 
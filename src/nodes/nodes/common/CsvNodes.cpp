@@ -2,14 +2,139 @@
 #include "nodes/NodeBuilder.hpp"
 #include "nodes/NodeRegistry.hpp"
 #include "dataframe/DataFrame.hpp"
+#include "dataframe/DataFrameIO.hpp"
 #include "dataframe/DataFrameJoiner.hpp"
 #include "dataframe/Column.hpp"
+#include "dataframe/CsvReader.hpp"
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <optional>
 
 namespace nodes {
 
 using json = nlohmann::json;
 
+namespace {
+
+// Root directory for csv_source `_path` (empty: file loading disabled)
+std::filesystem::path& csvSourceRoot() {
+    static std::filesystem::path root;
+    return root;
+}
+
+// Resolves a path relative to the CSV root; empty if outside the root
+std::filesystem::path resolveCsvPath(const std::string& relativePath) {
+    const auto& root = csvSourceRoot();
+    if (root.empty() || std::filesystem::path(relativePath).is_absolute()) {
+        return {};
+    }
+    auto full = std::filesystem::weakly_canonical(root / relativePath);
+    auto [rootEnd, fullIt] = std::mismatch(root.begin(), root.end(), full.begin(), full.end());
+    return rootEnd == root.end() ? full : std::filesystem::path{};
+}
+
+// Appends the rows of a batch (same columns, same string pool)
+void appendFrame(dataframe::DataFrame& target, const dataframe::DataFrame& batch) {
+    for (const auto& name : target.getColumnNames()) {
+        auto source = batch.getColumn(name);
+        dataframe::visitColumn(*target.getColumn(name), [&](auto& typed) {
+            using Col = dataframe::ColumnT<decltype(typed)>;
+            const auto& from = static_cast<const Col&>(*source);
+            if constexpr (std::is_same_v<Col, dataframe::StringColumn>) {
+                typed.appendIds(from.data());
+            } else {
+                typed.append(from.data());
+            }
+        });
+    }
+}
+
+// Loads `_path`, streamed by `_batch_rows` with `_filter` applied per batch
+void loadCsvFile(NodeContext& ctx, const std::string& relativePath) {
+    auto path = resolveCsvPath(relativePath);
+    if (path.empty()) {
+        ctx.setError(csvSourceRoot().empty()
+            ? "CSV file loading is disabled (start the server with --csv-root)"
+            : "CSV path outside the CSV root: " + relativePath);
+        return;
+    }
+
+    std::optional<json> filter;
+    auto filterProp = ctx.getInputWorkload("_filter");
+    if (!filterProp.isNull() && !filterProp.getString().empty()) {
+        auto parsed = json::parse(filterProp.getString(), nullptr, false);
+        if (parsed.is_discarded()) {
+            ctx.setError("Invalid _filter JSON");
+            return;
+        }
+        filter = std::move(parsed);
+    }
+
+    auto batchProp = ctx.getInputWorkload("_batch_rows");
+    int64_t batchRows = batchProp.isNull() ? 0 : batchProp.getInt();
+    if (batchRows > 0 && !filter) {
+        // Without a filter every batch would be kept: the whole file ends up in memory
+        ctx.setError("_batch_rows requires a _filter");
+        return;
+    }
+
+    try {
+        if (batchRows <= 0) {
+            auto df = dataframe::DataFrameIO::readCSV(path.string());
+            ctx.setOutput("csv", filter ? df->filter(*filter) : df);
+            return;
+        }
+
+        // Batch mode: only the rows kept by the filter stay in memory
+        dataframe::CsvBatchReader::Options options;
+        options.batchRows = static_cast<size_t>(batchRows);
+        dataframe::CsvBatchReader reader(path.string(), options);
+
+        auto result = reader.emptyFrame();
+        while (auto batch = reader.next()) {
+            appendFrame(*result, filter ? *batch->filter(*filter) : *batch);
+        }
+        ctx.setOutput("csv", result);
+    }
+    catch (const std::exception& e) {
+        ctx.setError(std::string("CSV load error: ") + e.what());
+    }
+}
+
+// Memoization key of `_path`: the file's size and mtime, so an edited file is reloaded
+std::string csvFileVersion(const NodeContext& ctx) {
+    auto pathProp = ctx.getInputWorkload("_path");
+    if (pathProp.isNull() || pathProp.getType() != NodeType::String || pathProp.getString().empty()) {
+        return "";
+    }
+    auto path = resolveCsvPath(pathProp.getString());
+    if (path.empty()) {
+        return "";
+    }
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return "missing";
+    }
+    return path.string() + "|" + std::to_string(size) + "|" +
+           std::to_string(mtime.time_since_epoch().count());
+}
+
+} // namespace
+
+void setCsvSourceRoot(const std::string& directory) {
+    std::filesystem::path root;
+    if (!directory.empty()) {
+        root = std::filesystem::weakly_canonical(directory);
+        if (!root.has_filename()) {
+            root = root.parent_path();  // Trailing separator
+        }
+    }
+    csvSourceRoot() = root;
+}
+
 void registerCsvNodes() {
     registerCsvSourceNode();
     registerFieldNode();
@@ -19,9 +144,11 @@ void registerCsvNodes() {
 
 void registerCsvSourceNode() {
     NodeBuilder("csv_source", "data")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .output("csv", Type::Csv)
         .entryPoint()
+        .cacheKey(csvFileVersion)
         .onCompile([](NodeContext& ctx) {
             // Priority 1: connected csv input (passthrough)
             auto inputWl = ctx.getInputWorkload("csv");
@@ -30,7 +157,14 @@ void registerCsvSourceNode() {
                 return;
             }
 
-            // Priority 2: test data (fallback)
+            // Priority 2: file under the CSV root (optionally streamed in batches)
+            auto pathProp = ctx.getInputWorkload("_path");
+            if (!pathProp.isNull() && !pathProp.getString().empty()) {
+                loadCsvFile(ctx, pathProp.getString());
+                return;
+            }
+
+            // Priority 3: test data (fallback)
             auto df = std::make_shared<dataframe::DataFrame>();
 
             df->addIntColumn("id");
@@ -49,6 +183,7 @@ void registerCsvSourceNode() {
 
 void registerFieldNode() {
     NodeBuilder("field", "csv")
+        .memoize()
         .input("csv", Type::Csv)
         .output("field", Type::Field)
         .output("csv", Type::Csv)  // Pass-through
@@ -87,6 +222,7 @@ void registerFieldNode() {
 
 void registerJoinFlexNode() {
     NodeBuilder("join_flex", "csv")
+        .memoize()
         // CSV inputs first (convention)
         .input("left_csv", Type::Csv)
         .input("right_csv", Type::Csv)
@@ -202,6 +338,7 @@ void registerJoinFlexNode() {
 
 void registerOutputNode() {
     NodeBuilder("output", "data")
+        .memoize()
         .input("csv", Type::Csv)
         .output("csv", Type::Csv)
         .output("output_name", Type::String)   // Output the resolved name for persistence
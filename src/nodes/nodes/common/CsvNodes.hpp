@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 namespace nodes {
 
 /**
@@ -13,12 +15,31 @@ void registerCsvNodes();
  * Register csv_source node
  *
  * Outputs:
- *   - csv (Csv): a test DataFrame with columns: id, name, price
+ *   - csv (Csv): in order of priority
+ *       1. the connected csv input (passthrough)
+ *       2. the file `_path`, relative to the CSV root (see setCsvSourceRoot)
+ *       3. a test DataFrame with columns: id, name, price
+ *
+ * Properties:
+ *   - _path (String): CSV file to load
+ *   - _batch_rows (Int): > 0 streams the file in batches of that many rows
+ *     (CsvBatchReader); only the rows kept by _filter stay in memory.
+ *     Requires _filter. Memory stays bounded only if the kept rows are few
+ *     and the string columns have low cardinality (the pool keeps every
+ *     distinct string read, including those of dropped rows)
+ *   - _filter (String): JSON filter applied to the loaded rows (same format
+ *     as DataFrame::filter)
  *
  * This is an entry point node (no inputs required).
  */
 void registerCsvSourceNode();
 
+/**
+ * Directory that csv_source `_path` values are resolved against.
+ * Paths escaping it are rejected. Empty (default): file loading disabled.
+ */
+void setCsvSourceRoot(const std::string& directory);
+
 /**
  * Register field node
  *
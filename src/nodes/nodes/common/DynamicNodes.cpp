@@ -11,6 +11,7 @@ void registerDynamicNodes() {
 
 void registerDynamicBeginNode() {
     NodeBuilder("dynamic_begin", "dynamic")
+        .memoize()
         .input("csv", Type::Csv)
         .output("csv", Type::Csv)
         .onCompile([](NodeContext& ctx) {
@@ -27,6 +28,7 @@ void registerDynamicBeginNode() {
 
 void registerDynamicEndNode() {
     NodeBuilder("dynamic_end", "dynamic")
+        .memoize()
         .input("csv", Type::Csv)
         .output("csv", Type::Csv)
         .onCompile([](NodeContext& ctx) {
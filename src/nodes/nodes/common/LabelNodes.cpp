@@ -13,6 +13,7 @@ void registerLabelDefineCsvNode() {
     NodeBuilder("label_define_csv", "label")
         .input("value", Type::Csv)
         .output("value", Type::Csv)
+        .sideEffects()
         .onCompile([](NodeContext& ctx) {
             auto identifierProp = ctx.getInputWorkload("_label");
             if (identifierProp.isNull() || identifierProp.getString().empty()) {
@@ -26,7 +27,7 @@ void registerLabelDefineCsvNode() {
                 return;
             }
 
-            LabelRegistry::instance().defineLabel(identifierProp.getString(), value);
+            ctx.labels().defineLabel(identifierProp.getString(), value);
             ctx.setOutput("value", value);
         })
         .buildAndRegister();
@@ -36,6 +37,7 @@ void registerLabelDefineFieldNode() {
     NodeBuilder("label_define_field", "label")
         .input("value", Type::Field)
         .output("value", Type::Field)
+        .sideEffects()
         .onCompile([](NodeContext& ctx) {
             auto identifierProp = ctx.getInputWorkload("_label");
             if (identifierProp.isNull() || identifierProp.getString().empty()) {
@@ -49,7 +51,7 @@ void registerLabelDefineFieldNode() {
                 return;
             }
 
-            LabelRegistry::instance().defineLabel(identifierProp.getString(), value);
+            ctx.labels().defineLabel(identifierProp.getString(), value);
             ctx.setOutput("value", value);
         })
         .buildAndRegister();
@@ -59,6 +61,7 @@ void registerLabelDefineIntNode() {
     NodeBuilder("label_define_int", "label")
         .input("value", Type::Int)
         .output("value", Type::Int)
+        .sideEffects()
         .onCompile([](NodeContext& ctx) {
             auto identifierProp = ctx.getInputWorkload("_label");
             if (identifierProp.isNull() || identifierProp.getString().empty()) {
@@ -72,7 +75,7 @@ void registerLabelDefineIntNode() {
                 return;
             }
 
-            LabelRegistry::instance().defineLabel(identifierProp.getString(), value);
+            ctx.labels().defineLabel(identifierProp.getString(), value);
             ctx.setOutput("value", value);
         })
         .buildAndRegister();
@@ -82,6 +85,7 @@ void registerLabelDefineDoubleNode() {
     NodeBuilder("label_define_double", "label")
         .input("value", Type::Double)
         .output("value", Type::Double)
+        .sideEffects()
         .onCompile([](NodeContext& ctx) {
             auto identifierProp = ctx.getInputWorkload("_label");
             if (identifierProp.isNull() || identifierProp.getString().empty()) {
@@ -95,7 +99,7 @@ void registerLabelDefineDoubleNode() {
                 return;
             }
 
-            LabelRegistry::instance().defineLabel(identifierProp.getString(), value);
+            ctx.labels().defineLabel(identifierProp.getString(), value);
             ctx.setOutput("value", value);
         })
         .buildAndRegister();
@@ -105,6 +109,7 @@ void registerLabelDefineStringNode() {
     NodeBuilder("label_define_string", "label")
         .input("value", Type::String)
         .output("value", Type::String)
+        .sideEffects()
         .onCompile([](NodeContext& ctx) {
             auto identifierProp = ctx.getInputWorkload("_label");
             if (identifierProp.isNull() || identifierProp.getString().empty()) {
@@ -118,7 +123,7 @@ void registerLabelDefineStringNode() {
                 return;
             }
 
-            LabelRegistry::instance().defineLabel(identifierProp.getString(), value);
+            ctx.labels().defineLabel(identifierProp.getString(), value);
             ctx.setOutput("value", value);
         })
         .buildAndRegister();
@@ -131,6 +136,7 @@ void registerLabelDefineStringNode() {
 
 void registerLabelRefCsvNode() {
     NodeBuilder("label_ref_csv", "label")
+        .memoize()
         .output("value", Type::Csv)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -141,12 +147,12 @@ void registerLabelRefCsvNode() {
             }
 
             std::string identifier = identifierProp.getString();
-            if (!LabelRegistry::instance().hasLabel(identifier)) {
+            if (!ctx.labels().hasLabel(identifier)) {
                 ctx.setError("Label not found: " + identifier);
                 return;
             }
 
-            auto value = LabelRegistry::instance().getLabel(identifier);
+            auto value = ctx.labels().getLabel(identifier);
             if (value.getType() != Type::Csv) {
                 ctx.setError("Label '" + identifier + "' is not a CSV");
                 return;
@@ -159,6 +165,7 @@ void registerLabelRefCsvNode() {
 
 void registerLabelRefFieldNode() {
     NodeBuilder("label_ref_field", "label")
+        .memoize()
         .output("value", Type::Field)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -169,12 +176,12 @@ void registerLabelRefFieldNode() {
             }
 
             std::string identifier = identifierProp.getString();
-            if (!LabelRegistry::instance().hasLabel(identifier)) {
+            if (!ctx.labels().hasLabel(identifier)) {
                 ctx.setError("Label not found: " + identifier);
                 return;
             }
 
-            auto value = LabelRegistry::instance().getLabel(identifier);
+            auto value = ctx.labels().getLabel(identifier);
             if (value.getType() != Type::Field) {
                 ctx.setError("Label '" + identifier + "' is not a Field");
                 return;
@@ -187,6 +194,7 @@ void registerLabelRefFieldNode() {
 
 void registerLabelRefIntNode() {
     NodeBuilder("label_ref_int", "label")
+        .memoize()
         .output("value", Type::Int)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -197,12 +205,12 @@ void registerLabelRefIntNode() {
             }
 
             std::string identifier = identifierProp.getString();
-            if (!LabelRegistry::instance().hasLabel(identifier)) {
+            if (!ctx.labels().hasLabel(identifier)) {
                 ctx.setError("Label not found: " + identifier);
                 return;
             }
 
-            auto value = LabelRegistry::instance().getLabel(identifier);
+            auto value = ctx.labels().getLabel(identifier);
             if (value.getType() != Type::Int) {
                 ctx.setError("Label '" + identifier + "' is not an Int");
                 return;
@@ -215,6 +223,7 @@ void registerLabelRefIntNode() {
 
 void registerLabelRefDoubleNode() {
     NodeBuilder("label_ref_double", "label")
+        .memoize()
         .output("value", Type::Double)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -225,12 +234,12 @@ void registerLabelRefDoubleNode() {
             }
 
             std::string identifier = identifierProp.getString();
-            if (!LabelRegistry::instance().hasLabel(identifier)) {
+            if (!ctx.labels().hasLabel(identifier)) {
                 ctx.setError("Label not found: " + identifier);
                 return;
             }
 
-            auto value = LabelRegistry::instance().getLabel(identifier);
+            auto value = ctx.labels().getLabel(identifier);
             if (value.getType() != Type::Double) {
                 ctx.setError("Label '" + identifier + "' is not a Double");
                 return;
@@ -243,6 +252,7 @@ void registerLabelRefDoubleNode() {
 
 void registerLabelRefStringNode() {
     NodeBuilder("label_ref_string", "label")
+        .memoize()
         .output("value", Type::String)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -253,12 +263,12 @@ void registerLabelRefStringNode() {
             }
 
             std::string identifier = identifierProp.getString();
-            if (!LabelRegistry::instance().hasLabel(identifier)) {
+            if (!ctx.labels().hasLabel(identifier)) {
                 ctx.setError("Label not found: " + identifier);
                 return;
             }
 
-            auto value = LabelRegistry::instance().getLabel(identifier);
+            auto value = ctx.labels().getLabel(identifier);
             if (value.getType() != Type::String) {
                 ctx.setError("Label '" + identifier + "' is not a String");
                 return;
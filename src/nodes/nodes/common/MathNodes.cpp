@@ -1,6 +1,7 @@
 #include "MathNodes.hpp"
 #include "nodes/NodeBuilder.hpp"
 #include "nodes/NodeRegistry.hpp"
+#include "nodes/ColumnView.hpp"
 #include "dataframe/DataFrame.hpp"
 #include "dataframe/Column.hpp"
 #include <functional>
@@ -21,6 +22,7 @@ using MathOp = std::function<double(double, double)>;
 
 static void registerMathNode(const std::string& name, MathOp op) {
     NodeBuilder(name, "math")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::Int, Type::Double, Type::Field})
         .inputOptional("dest", Type::Field)
@@ -87,10 +89,10 @@ static void registerMathNode(const std::string& name, MathOp op) {
             resultCol->reserve(rowCount);
 
             // Compute for each row (with broadcasting for scalars)
+            NumericView<double> va(src, *csv);
+            NumericView<double> vb(operand, *csv);
             for (size_t i = 0; i < rowCount; ++i) {
-                double va = src.getDoubleAtRow(i, header, csv);
-                double vb = operand.getDoubleAtRow(i, header, csv);
-                resultCol->push_back(op(va, vb));
+                resultCol->push_back(op(va[i], vb[i]));
             }
 
             // Create output CSV: clone original + set result column
@@ -17,6 +17,7 @@ void registerPostgresConfigNode() {
     NodeBuilder("postgres_config", "database")
         .output("connection", Type::String)
         .entryPoint()
+        .sideEffects()
         .onCompile([](NodeContext& ctx) {
             // Récupérer les propriétés de configuration
             auto hostProp = ctx.getInputWorkload("_host");
@@ -77,6 +78,7 @@ void registerPostgresQueryNode() {
     NodeBuilder("postgres_query", "database")
         .input("query", Type::String)
         .output("csv", Type::Csv)
+        .volatileResults()  // Résultat réutilisable pendant _cache_ttl secondes
         .onCompile([](NodeContext& ctx) {
             // Récupérer la requête
             auto queryWL = ctx.getInputWorkload("query");
@@ -109,6 +111,15 @@ void registerPostgresQueryNode() {
                 }
 
                 auto result = pool.executeQuery(sql);
+
+                // Ordre garanti par le ORDER BY de la requête (ex: "region, amount desc")
+                // Vérifié à la déclaration : une collation différente est ignorée
+                auto sortedByProp = ctx.getInputWorkload("_sorted_by");
+                if (!sortedByProp.isNull() && !sortedByProp.getString().empty()) {
+                    result->declareSortedBy(
+                        dataframe::DataFrameSorter::parseSortSpec(sortedByProp.getString()));
+                }
+
                 ctx.setOutput("csv", result);
             }
             catch (const std::exception& e) {
@@ -123,6 +134,7 @@ void registerPostgresFuncNode() {
         .inputOptional("csv", Type::Csv)
         .input("function", Type::String)
         .output("csv", Type::Csv)
+        .volatileResults()
         .onCompile([](NodeContext& ctx) {
             // Récupérer le nom de la fonction
             auto funcWL = ctx.getInputWorkload("function");
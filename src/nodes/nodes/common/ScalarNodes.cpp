@@ -31,6 +31,7 @@ void registerScalarNodes() {
 
 void registerIntValueNode() {
     NodeBuilder("int_value", "scalar")
+        .memoize()
         .output("value", Type::Int)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -46,6 +47,7 @@ void registerIntValueNode() {
 
 void registerDoubleValueNode() {
     NodeBuilder("double_value", "scalar")
+        .memoize()
         .output("value", Type::Double)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -61,6 +63,7 @@ void registerDoubleValueNode() {
 
 void registerStringValueNode() {
     NodeBuilder("string_value", "scalar")
+        .memoize()
         .output("value", Type::String)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -76,6 +79,7 @@ void registerStringValueNode() {
 
 void registerBoolValueNode() {
     NodeBuilder("bool_value", "scalar")
+        .memoize()
         .output("value", Type::Bool)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -91,6 +95,7 @@ void registerBoolValueNode() {
 
 void registerNullValueNode() {
     NodeBuilder("null_value", "scalar")
+        .memoize()
         .output("value", Type::Null)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -103,6 +108,7 @@ void registerNullValueNode() {
 
 void registerStringAsFieldNode() {
     NodeBuilder("string_as_field", "scalar")
+        .memoize()
         .output("value", Type::Field)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -120,6 +126,7 @@ void registerStringAsFieldsNode() {
     using json = nlohmann::json;
 
     NodeBuilder("string_as_fields", "scalar")
+        .memoize()
         .output("value", Type::Field)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -151,6 +158,7 @@ void registerStringAsFieldsNode() {
 
 void registerDateValueNode() {
     NodeBuilder("date_value", "scalar")
+        .memoize()
         .output("value", Type::Int)  // timestamp as int
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
@@ -179,6 +187,7 @@ void registerCurrentDateNode() {
         .output("month", Type::Int)
         .output("day", Type::Int)
         .entryPoint()
+        .volatileResults()
         .onCompile([](NodeContext& ctx) {
             auto yearOffsetProp = ctx.getInputWorkload("_year_offset");
             auto monthOffsetProp = ctx.getInputWorkload("_month_offset");
@@ -210,6 +219,7 @@ void registerCurrentDateNode() {
 
 void registerScalarsToCsvNode() {
     auto builder = NodeBuilder("scalars_to_csv", "scalar")
+        .memoize()
         .inputOptional("field", {Type::Field, Type::String})
         .inputOptional("value", {Type::Int, Type::Double, Type::String, Type::Bool, Type::Null});
 
@@ -303,6 +313,7 @@ void registerScalarsToCsvNode() {
 
 void registerCsvValueNode() {
     NodeBuilder("csv_value", "scalar")
+        .memoize()
         .output("csv", Type::Csv)
         .entryPoint()
         .onCompile([](NodeContext& ctx) {
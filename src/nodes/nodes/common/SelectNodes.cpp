@@ -17,6 +17,7 @@ void registerSelectNodes() {
 
 void registerSelectByNameNode() {
     auto builder = NodeBuilder("select_by_name", "select")
+        .memoize()
         .input("csv", Type::Csv)
         .input("column", Type::Field);  // First column (required)
 
@@ -87,6 +88,7 @@ void registerSelectByNameNode() {
 
 void registerSelectByPosNode() {
     auto builder = NodeBuilder("select_by_pos", "select")
+        .memoize()
         .input("csv", Type::Csv);
 
     // Column selection inputs (optional, col_0 to col_99)
@@ -154,6 +156,7 @@ void registerSelectByPosNode() {
 
 void registerReorderColumnsNode() {
     auto builder = NodeBuilder("reorder_columns", "select")
+        .memoize()
         .input("csv", Type::Csv)
         .input("column", Type::Field);  // First column (required)
 
@@ -236,6 +239,7 @@ void registerReorderColumnsNode() {
 
 void registerCleanTmpColumnsNode() {
     NodeBuilder("clean_tmp_columns", "select")
+        .memoize()
         .input("csv", Type::Csv)
         .output("csv", Type::Csv)
         .onCompile([](NodeContext& ctx) {
@@ -272,6 +276,7 @@ void registerCleanTmpColumnsNode() {
 
 void registerRemapByNameNode() {
     auto builder = NodeBuilder("remap_by_name", "select")
+        .memoize()
         .input("csv", Type::Csv)
         .input("col", Type::Field)      // First old column name (required)
         .input("dest", Type::Field);    // First new column name (required)
@@ -365,6 +370,7 @@ void registerRemapByNameNode() {
 
 void registerRemapByCsvNode() {
     NodeBuilder("remap_by_csv", "select")
+        .memoize()
         .input("csv", Type::Csv)
         .input("mapping", Type::Csv)
         .input("col", Type::Field)
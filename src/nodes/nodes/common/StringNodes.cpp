@@ -1,11 +1,13 @@
 #include "StringNodes.hpp"
 #include "nodes/NodeBuilder.hpp"
 #include "nodes/NodeRegistry.hpp"
+#include "nodes/ColumnView.hpp"
 #include "dataframe/DataFrame.hpp"
 #include "dataframe/Column.hpp"
 #include <algorithm>
 #include <cctype>
 #include <functional>
+#include <optional>
 #include <sstream>
 #include <regex>
 
@@ -32,6 +34,7 @@ using StringOp = std::function<std::string(const std::string&)>;
 
 static void registerSimpleStringNode(const std::string& name, StringOp op) {
     NodeBuilder(name, "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field})
         .inputOptional("dest", Type::Field)
@@ -76,9 +79,10 @@ static void registerSimpleStringNode(const std::string& name, StringOp op) {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView values(src, *csv);
             for (size_t i = 0; i < rowCount; ++i) {
-                std::string val = src.getStringAtRow(i, header, csv);
-                resultCol->push_back(op(val));
+                ctx.checkCancelled(i);
+                resultCol->push_back(op(values[i]));
             }
 
             // Create output CSV: clone original + set result column
@@ -103,6 +107,7 @@ static void registerSimpleStringNode(const std::string& name, StringOp op) {
 
 void registerAddColumnNode() {
     NodeBuilder("add_column", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("value", {Type::Int, Type::Double, Type::String, Type::Bool, Type::Field})
         .input("dest", Type::Field)
@@ -142,8 +147,10 @@ void registerAddColumnNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView values(value, *csv);
             for (size_t i = 0; i < rowCount; ++i) {
-                resultCol->push_back(value.getStringAtRow(i, header, csv));
+                ctx.checkCancelled(i);
+                resultCol->push_back(values[i]);
             }
 
             auto resultCsv = std::make_shared<dataframe::DataFrame>();
@@ -329,6 +336,7 @@ void registerTrimIntegerNode() {
 
 void registerReplaceNode() {
     NodeBuilder("replace", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field})
         .inputOptional("dest", Type::Field)
@@ -402,9 +410,10 @@ void registerReplaceNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView values(src, *csv);
             for (size_t i = 0; i < rowCount; ++i) {
-                std::string val = src.getStringAtRow(i, header, csv);
-                resultCol->push_back(replaceFirst(val));
+                ctx.checkCancelled(i);
+                resultCol->push_back(replaceFirst(values[i]));
             }
 
             auto resultCsv = std::make_shared<dataframe::DataFrame>();
@@ -428,6 +437,7 @@ void registerReplaceNode() {
 
 void registerToIntegerNode() {
     NodeBuilder("to_integer", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field})
         .inputOptional("dest", Type::Field)
@@ -494,9 +504,10 @@ void registerToIntegerNode() {
             resultCol->reserve(rowCount);
 
             try {
+                StringView values(src, *csv);
                 for (size_t i = 0; i < rowCount; ++i) {
-                    std::string val = src.getStringAtRow(i, header, csv);
-                    resultCol->push_back(static_cast<int>(toInt(val)));
+                    ctx.checkCancelled(i);
+                    resultCol->push_back(static_cast<int>(toInt(values[i])));
                 }
             } catch (const std::exception& e) {
                 ctx.setError(e.what());
@@ -524,6 +535,7 @@ void registerToIntegerNode() {
 
 void registerSubstringNode() {
     NodeBuilder("substring", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field})
         .inputOptional("dest", Type::Field)
@@ -582,11 +594,18 @@ void registerSubstringNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView values(src, *csv);
+            std::optional<NumericView<int64_t>> begins;
+            std::optional<NumericView<int64_t>> ends;
+            if (!beginWork.isNull()) begins.emplace(beginWork, *csv);
+            if (!endWork.isNull()) ends.emplace(endWork, *csv);
+
             for (size_t i = 0; i < rowCount; ++i) {
-                std::string s = src.getStringAtRow(i, header, csv);
+                ctx.checkCancelled(i);
+                const std::string& s = values[i];
 
-                int64_t beginPos = beginWork.isNull() ? 0 : beginWork.getIntAtRow(i, header, csv);
-                int64_t endPos = endWork.isNull() ? static_cast<int64_t>(s.length()) : endWork.getIntAtRow(i, header, csv);
+                int64_t beginPos = begins ? (*begins)[i] : 0;
+                int64_t endPos = ends ? (*ends)[i] : static_cast<int64_t>(s.length());
 
                 if (beginPos < 0) beginPos = 0;
                 if (endPos > static_cast<int64_t>(s.length())) endPos = s.length();
@@ -618,6 +637,7 @@ void registerSubstringNode() {
 
 void registerSplitNode() {
     NodeBuilder("split", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field})
         .inputOptional("dest", Type::Field)
@@ -693,9 +713,10 @@ void registerSplitNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView values(src, *csv);
             for (size_t i = 0; i < rowCount; ++i) {
-                std::string val = src.getStringAtRow(i, header, csv);
-                resultCol->push_back(splitAndGet(val));
+                ctx.checkCancelled(i);
+                resultCol->push_back(splitAndGet(values[i]));
             }
 
             auto resultCsv = std::make_shared<dataframe::DataFrame>();
@@ -720,6 +741,7 @@ void registerSplitNode() {
 
 void registerConcatNode() {
     auto builder = NodeBuilder("concat", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field, Type::Int, Type::Double})
         .inputOptional("dest", Type::Field)
@@ -753,18 +775,6 @@ void registerConcatNode() {
                 suffixes.push_back(suffixI);
             }
 
-            auto getStringValue = [](const Workload& w, size_t row,
-                                     const std::vector<std::string>& header,
-                                     const std::shared_ptr<dataframe::DataFrame>& csv) -> std::string {
-                if (w.getType() == Type::Int) {
-                    return std::to_string(w.getIntAtRow(row, header, csv));
-                } else if (w.getType() == Type::Double) {
-                    return std::to_string(w.getDoubleAtRow(row, header, csv));
-                } else {
-                    return w.getStringAtRow(row, header, csv);
-                }
-            };
-
             // Check if any input is a field (vector mode needed)
             bool needsVector = (src.getType() == Type::Field);
             for (const auto& s : suffixes) {
@@ -829,10 +839,18 @@ void registerConcatNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView srcValues(src, *csv);
+            std::vector<StringView> suffixValues;
+            suffixValues.reserve(suffixes.size());
+            for (const auto& s : suffixes) {
+                suffixValues.emplace_back(s, *csv);
+            }
+
             for (size_t i = 0; i < rowCount; ++i) {
-                std::string result = getStringValue(src, i, header, csv);
-                for (const auto& s : suffixes) {
-                    result += getStringValue(s, i, header, csv);
+                ctx.checkCancelled(i);
+                std::string result = srcValues[i];
+                for (const auto& values : suffixValues) {
+                    result += values[i];
                 }
                 resultCol->push_back(result);
             }
@@ -858,6 +876,7 @@ void registerConcatNode() {
 
 void registerConcatPrefixNode() {
     auto builder = NodeBuilder("concat_prefix", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field, Type::Int, Type::Double})
         .inputOptional("dest", Type::Field)
@@ -891,18 +910,6 @@ void registerConcatPrefixNode() {
                 prefixes.push_back(prefixI);
             }
 
-            auto getStringValue = [](const Workload& w, size_t row,
-                                     const std::vector<std::string>& header,
-                                     const std::shared_ptr<dataframe::DataFrame>& csv) -> std::string {
-                if (w.getType() == Type::Int) {
-                    return std::to_string(w.getIntAtRow(row, header, csv));
-                } else if (w.getType() == Type::Double) {
-                    return std::to_string(w.getDoubleAtRow(row, header, csv));
-                } else {
-                    return w.getStringAtRow(row, header, csv);
-                }
-            };
-
             // Check if any input is a field (vector mode needed)
             bool needsVector = (src.getType() == Type::Field);
             for (const auto& p : prefixes) {
@@ -970,16 +977,24 @@ void registerConcatPrefixNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView srcValues(src, *csv);
+            std::vector<StringView> prefixValues;
+            prefixValues.reserve(prefixes.size());
+            for (const auto& p : prefixes) {
+                prefixValues.emplace_back(p, *csv);
+            }
+
             for (size_t i = 0; i < rowCount; ++i) {
+                ctx.checkCancelled(i);
                 std::string result;
 
                 // Add all prefixes first
-                for (const auto& p : prefixes) {
-                    result += getStringValue(p, i, header, csv);
+                for (const auto& values : prefixValues) {
+                    result += values[i];
                 }
 
                 // Then add src
-                result += getStringValue(src, i, header, csv);
+                result += srcValues[i];
 
                 resultCol->push_back(result);
             }
@@ -1041,6 +1056,7 @@ static std::string extractJsonValue(const std::string& json, const std::string&
 
 void registerJsonExtractNode() {
     NodeBuilder("json_extract", "string")
+        .memoize()
         .inputOptional("csv", Type::Csv)
         .input("src", {Type::String, Type::Field})
         .input("key", {Type::String, Type::Field})
@@ -1104,9 +1120,12 @@ void registerJsonExtractNode() {
                 destColName, csv->getStringPool());
             resultCol->reserve(rowCount);
 
+            StringView jsonValues(src, *csv);
+            StringView keyValues(key, *csv);
             for (size_t i = 0; i < rowCount; ++i) {
-                std::string jsonStr = src.getStringAtRow(i, header, csv);
-                std::string keyStr = key.getStringAtRow(i, header, csv);
+                ctx.checkCancelled(i);
+                const std::string& jsonStr = jsonValues[i];
+                const std::string& keyStr = keyValues[i];
                 std::string extracted = extractJsonValue(jsonStr, keyStr);
                 if (extracted.empty() && identityOnFailure) {
                     resultCol->push_back(jsonStr);
@@ -3,6 +3,7 @@
 #include "dataframe/DataFrame.hpp"
 #include "dataframe/Column.hpp"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <unordered_map>
 
 namespace nodes {
@@ -10,6 +11,31 @@ namespace nodes {
 using json = nlohmann::json;
 using namespace dataframe;
 
+namespace {
+
+// Column resolved once per diff (nullptr when the frame lacks it)
+const IColumn* findColumn(const DataFrame& df, const std::string& name) {
+    return df.hasColumn(name) ? df.getColumn(name).get() : nullptr;
+}
+
+// String key of every row of a key column, in one typed pass
+std::vector<std::string> rowKeys(const IColumn& col, size_t rowCount) {
+    std::vector<std::string> keys;
+    keys.reserve(rowCount);
+    visitColumn(col, [&](const auto& typed) {
+        for (size_t i = 0; i < rowCount; ++i) {
+            if constexpr (std::is_same_v<ColumnT<decltype(typed)>, StringColumn>) {
+                keys.push_back(typed.at(i));
+            } else {
+                keys.push_back(std::to_string(typed.at(i)));
+            }
+        }
+    });
+    return keys;
+}
+
+} // namespace
+
 void registerVizNodes() {
     registerTimelineOutputNode();
     registerDiffOutputNode();
@@ -20,6 +46,7 @@ void registerVizNodes() {
 
 void registerTimelineOutputNode() {
     NodeBuilder("timeline_output", "viz")
+        .memoize()
         .input("csv", Type::Csv)
         .input("start_date", Type::Field)
         .input("name", Type::Field)
@@ -111,6 +138,7 @@ void registerTimelineOutputNode() {
 
 void registerDiffOutputNode() {
     NodeBuilder("diff_output", "viz")
+        .memoize()
         .input("left", Type::Csv)
         .input("right", Type::Csv)
         .inputOptional("key", Type::Field)
@@ -223,100 +251,12 @@ void registerDiffOutputNode() {
                 changedCols[name] = col;
             }
 
-            // Helper lambdas to read cell values generically
-            auto pushRightValue = [&](const std::string& colName, size_t row, bool hasValue) {
-                auto& outCol = rightOutCols[colName];
-                if (!hasValue || !rightDf->hasColumn(colName)) {
-                    // Push default
-                    switch (outCol->getType()) {
-                        case ColumnTypeOpt::INT:
-                            std::dynamic_pointer_cast<IntColumn>(outCol)->push_back(0);
-                            break;
-                        case ColumnTypeOpt::DOUBLE:
-                            std::dynamic_pointer_cast<DoubleColumn>(outCol)->push_back(0.0);
-                            break;
-                        default:
-                            std::dynamic_pointer_cast<StringColumn>(outCol)->push_back("");
-                            break;
-                    }
-                    return;
-                }
-                auto srcCol = rightDf->getColumn(colName);
-                switch (srcCol->getType()) {
-                    case ColumnTypeOpt::INT:
-                        std::dynamic_pointer_cast<IntColumn>(outCol)->push_back(
-                            std::dynamic_pointer_cast<IntColumn>(srcCol)->at(row));
-                        break;
-                    case ColumnTypeOpt::DOUBLE:
-                        std::dynamic_pointer_cast<DoubleColumn>(outCol)->push_back(
-                            std::dynamic_pointer_cast<DoubleColumn>(srcCol)->at(row));
-                        break;
-                    default:
-                        std::dynamic_pointer_cast<StringColumn>(outCol)->push_back(
-                            std::dynamic_pointer_cast<StringColumn>(srcCol)->at(row));
-                        break;
-                }
-            };
-
-            auto pushOldValue = [&](const std::string& colName, size_t row, bool hasValue) {
-                auto& outCol = oldOutCols[colName];
-                if (!hasValue || !leftDf->hasColumn(colName)) {
-                    switch (outCol->getType()) {
-                        case ColumnTypeOpt::INT:
-                            std::dynamic_pointer_cast<IntColumn>(outCol)->push_back(0);
-                            break;
-                        case ColumnTypeOpt::DOUBLE:
-                            std::dynamic_pointer_cast<DoubleColumn>(outCol)->push_back(0.0);
-                            break;
-                        default:
-                            std::dynamic_pointer_cast<StringColumn>(outCol)->push_back("");
-                            break;
-                    }
-                    return;
-                }
-                auto srcCol = leftDf->getColumn(colName);
-                switch (srcCol->getType()) {
-                    case ColumnTypeOpt::INT:
-                        std::dynamic_pointer_cast<IntColumn>(outCol)->push_back(
-                            std::dynamic_pointer_cast<IntColumn>(srcCol)->at(row));
-                        break;
-                    case ColumnTypeOpt::DOUBLE:
-                        std::dynamic_pointer_cast<DoubleColumn>(outCol)->push_back(
-                            std::dynamic_pointer_cast<DoubleColumn>(srcCol)->at(row));
-                        break;
-                    default:
-                        std::dynamic_pointer_cast<StringColumn>(outCol)->push_back(
-                            std::dynamic_pointer_cast<StringColumn>(srcCol)->at(row));
-                        break;
-                }
-            };
-
-            // Compare a cell between left row and right row for a given column
-            auto cellsEqual = [&](const std::string& colName, size_t leftRow, size_t rightRow) -> bool {
-                bool leftHas = leftDf->hasColumn(colName);
-                bool rightHas = rightDf->hasColumn(colName);
-                if (!leftHas && !rightHas) return true;
-                if (!leftHas || !rightHas) return false;
-
-                auto lCol = leftDf->getColumn(colName);
-                auto rCol = rightDf->getColumn(colName);
-
-                // Compare by type
-                if (lCol->getType() == ColumnTypeOpt::INT && rCol->getType() == ColumnTypeOpt::INT) {
-                    return std::dynamic_pointer_cast<IntColumn>(lCol)->at(leftRow) ==
-                           std::dynamic_pointer_cast<IntColumn>(rCol)->at(rightRow);
-                }
-                if (lCol->getType() == ColumnTypeOpt::DOUBLE && rCol->getType() == ColumnTypeOpt::DOUBLE) {
-                    return std::dynamic_pointer_cast<DoubleColumn>(lCol)->at(leftRow) ==
-                           std::dynamic_pointer_cast<DoubleColumn>(rCol)->at(rightRow);
-                }
-                if (lCol->getType() == ColumnTypeOpt::STRING && rCol->getType() == ColumnTypeOpt::STRING) {
-                    return std::dynamic_pointer_cast<StringColumn>(lCol)->at(leftRow) ==
-                           std::dynamic_pointer_cast<StringColumn>(rCol)->at(rightRow);
-                }
-                // Mixed types: not equal
-                return false;
-            };
+            // Source columns, resolved once (nullptr when absent on that side)
+            std::vector<const IColumn*> leftSrcCols, rightSrcCols;
+            for (const auto& name : allCols) {
+                leftSrcCols.push_back(findColumn(*leftDf, name));
+                rightSrcCols.push_back(findColumn(*rightDf, name));
+            }
 
             // Match rows
             struct MatchedRow {
@@ -338,26 +278,12 @@ void registerDiffOutputNode() {
                 size_t commonRows = std::min(leftRows, rightRows);
 
                 for (size_t i = 0; i < commonRows; ++i) {
-                    // Check if any cell differs
-                    std::vector<bool> changed(allCols.size(), false);
-                    bool anyChanged = false;
-                    for (size_t c = 0; c < allCols.size(); ++c) {
-                        if (!cellsEqual(allCols[c], i, i)) {
-                            changed[c] = true;
-                            anyChanged = true;
-                        }
-                    }
+                    // Cells compared below, column by column
                     MatchedRow mr;
+                    mr.status = MatchedRow::Unchanged;
                     mr.leftIdx = i;
                     mr.rightIdx = i;
-                    mr.changedFlags = std::move(changed);
-                    if (anyChanged) {
-                        mr.status = MatchedRow::Modified;
-                        statsModified++;
-                    } else {
-                        mr.status = MatchedRow::Unchanged;
-                        statsUnchanged++;
-                    }
+                    mr.changedFlags.assign(allCols.size(), false);
                     rows.push_back(std::move(mr));
                 }
 
@@ -387,21 +313,9 @@ void registerDiffOutputNode() {
                 // Build key-to-row index for left
                 std::unordered_map<std::string, size_t> leftKeyMap;
                 if (leftDf->hasColumn(keyCol)) {
-                    auto lkCol = leftDf->getColumn(keyCol);
+                    auto leftKeys = rowKeys(*leftDf->getColumn(keyCol), leftRows);
                     for (size_t i = 0; i < leftRows; ++i) {
-                        std::string key;
-                        switch (lkCol->getType()) {
-                            case ColumnTypeOpt::INT:
-                                key = std::to_string(std::dynamic_pointer_cast<IntColumn>(lkCol)->at(i));
-                                break;
-                            case ColumnTypeOpt::DOUBLE:
-                                key = std::to_string(std::dynamic_pointer_cast<DoubleColumn>(lkCol)->at(i));
-                                break;
-                            default:
-                                key = std::dynamic_pointer_cast<StringColumn>(lkCol)->at(i);
-                                break;
-                        }
-                        leftKeyMap[key] = i;
+                        leftKeyMap[leftKeys[i]] = i;
                     }
                 }
 
@@ -409,45 +323,20 @@ void registerDiffOutputNode() {
                 std::unordered_map<std::string, bool> matchedLeftKeys;
 
                 if (rightDf->hasColumn(keyCol)) {
-                    auto rkCol = rightDf->getColumn(keyCol);
+                    auto rightKeys = rowKeys(*rightDf->getColumn(keyCol), rightRows);
                     for (size_t ri = 0; ri < rightRows; ++ri) {
-                        std::string key;
-                        switch (rkCol->getType()) {
-                            case ColumnTypeOpt::INT:
-                                key = std::to_string(std::dynamic_pointer_cast<IntColumn>(rkCol)->at(ri));
-                                break;
-                            case ColumnTypeOpt::DOUBLE:
-                                key = std::to_string(std::dynamic_pointer_cast<DoubleColumn>(rkCol)->at(ri));
-                                break;
-                            default:
-                                key = std::dynamic_pointer_cast<StringColumn>(rkCol)->at(ri);
-                                break;
-                        }
+                        const std::string& key = rightKeys[ri];
 
                         auto it = leftKeyMap.find(key);
                         if (it != leftKeyMap.end()) {
                             size_t li = it->second;
                             matchedLeftKeys[key] = true;
 
-                            std::vector<bool> changed(allCols.size(), false);
-                            bool anyChanged = false;
-                            for (size_t c = 0; c < allCols.size(); ++c) {
-                                if (!cellsEqual(allCols[c], li, ri)) {
-                                    changed[c] = true;
-                                    anyChanged = true;
-                                }
-                            }
                             MatchedRow mr;
+                            mr.status = MatchedRow::Unchanged;
                             mr.leftIdx = li;
                             mr.rightIdx = ri;
-                            mr.changedFlags = std::move(changed);
-                            if (anyChanged) {
-                                mr.status = MatchedRow::Modified;
-                                statsModified++;
-                            } else {
-                                mr.status = MatchedRow::Unchanged;
-                                statsUnchanged++;
-                            }
+                            mr.changedFlags.assign(allCols.size(), false);
                             rows.push_back(std::move(mr));
                         } else {
                             // Added
@@ -476,12 +365,47 @@ void registerDiffOutputNode() {
                 }
             }
 
+            // Compare matched rows column by column (one typed loop per column)
+            for (size_t c = 0; c < allCols.size(); ++c) {
+                const IColumn* lCol = leftSrcCols[c];
+                const IColumn* rCol = rightSrcCols[c];
+                if (!lCol && !rCol) continue;
+
+                // Missing on one side or mixed types: every matched cell differs
+                bool sameType = lCol && rCol && lCol->getType() == rCol->getType();
+                if (!sameType) {
+                    for (auto& mr : rows) {
+                        if (mr.status == MatchedRow::Unchanged) mr.changedFlags[c] = true;
+                    }
+                    continue;
+                }
+
+                visitColumn(*lCol, [&](const auto& left) {
+                    const auto& right = static_cast<const ColumnT<decltype(left)>&>(*rCol);
+                    for (auto& mr : rows) {
+                        if (mr.status == MatchedRow::Unchanged) {
+                            mr.changedFlags[c] = !(left.at(mr.leftIdx) == right.at(mr.rightIdx));
+                        }
+                    }
+                });
+            }
+
+            for (auto& mr : rows) {
+                if (mr.status != MatchedRow::Unchanged) continue;
+                if (std::find(mr.changedFlags.begin(), mr.changedFlags.end(), true) != mr.changedFlags.end()) {
+                    mr.status = MatchedRow::Modified;
+                    statsModified++;
+                } else {
+                    statsUnchanged++;
+                }
+            }
+
             // Sort: removed, modified, added, unchanged
             std::stable_sort(rows.begin(), rows.end(), [](const MatchedRow& a, const MatchedRow& b) {
                 return static_cast<int>(a.status) < static_cast<int>(b.status);
             });
 
-            // Emit rows to output DataFrame
+            // Emit rows to output DataFrame, column by column
             for (const auto& mr : rows) {
                 // __diff__
                 const char* statusStr = "";
@@ -492,22 +416,37 @@ void registerDiffOutputNode() {
                     case MatchedRow::Unchanged:  statusStr = "unchanged"; break;
                 }
                 diffCol->push_back(statusStr);
+            }
 
-                // Right-side values (current)
-                bool hasRight = (mr.status != MatchedRow::Removed);
-                for (const auto& colName : allCols) {
-                    pushRightValue(colName, mr.rightIdx, hasRight);
-                }
+            // Copy one side's values (default value when the row or column is absent)
+            auto emitColumn = [&](IColumn& outCol, const IColumn* srcCol, bool rightSide) {
+                outCol.reserve(rows.size());
+                visitColumn(outCol, [&](auto& out) {
+                    using Col = ColumnT<decltype(out)>;
+                    using Value = std::decay_t<decltype(out.at(0))>;
+                    const Col* src = (srcCol && srcCol->getType() == outCol.getType())
+                        ? static_cast<const Col*>(srcCol) : nullptr;
+                    for (const auto& mr : rows) {
+                        bool hasValue = rightSide ? mr.status != MatchedRow::Removed
+                                                  : mr.status != MatchedRow::Added;
+                        if (src && hasValue) {
+                            out.push_back(src->at(rightSide ? mr.rightIdx : mr.leftIdx));
+                        } else {
+                            out.push_back(Value{});
+                        }
+                    }
+                });
+            };
 
-                // Old-side values (before)
-                bool hasLeft = (mr.status != MatchedRow::Added);
-                for (const auto& colName : allCols) {
-                    pushOldValue(colName, mr.leftIdx, hasLeft);
-                }
+            for (size_t c = 0; c < allCols.size(); ++c) {
+                // Right-side values (current), then old-side values (before)
+                emitColumn(*rightOutCols[allCols[c]], rightSrcCols[c], true);
+                emitColumn(*oldOutCols[allCols[c]], leftSrcCols[c], false);
 
                 // Changed flags
-                for (size_t c = 0; c < allCols.size(); ++c) {
-                    changedCols[allCols[c]]->push_back(mr.changedFlags[c] ? 1 : 0);
+                auto& changed = *changedCols[allCols[c]];
+                for (const auto& mr : rows) {
+                    changed.push_back(mr.changedFlags[c] ? 1 : 0);
                 }
             }
 
@@ -536,6 +475,7 @@ void registerDiffOutputNode() {
 
 void registerBarChartOutputNode() {
     NodeBuilder("bar_chart_output", "viz")
+        .memoize()
         .input("csv", Type::Csv)
         .inputOptional("category", Type::Field)
         .input("value", Type::Field)
@@ -627,6 +567,7 @@ void registerBarChartOutputNode() {
 
 void registerListOutputNode() {
     NodeBuilder("list_output", "viz")
+        .memoize()
         .input("csv", Type::Csv)
         .input("label", Type::Field)
         .inputOptional("value", Type::Field)
@@ -688,6 +629,7 @@ void registerListOutputNode() {
 
 void registerButtonOutputNode() {
     NodeBuilder("button_output", "viz")
+        .memoize()
         .input("csv", Type::Csv)
         .input("name", {Type::Field, Type::String})
         .input("label", {Type::Field, Type::String})
@@ -7,7 +7,14 @@
 #include "nodes/NodeGraphSerializer.hpp"
 #include "server/SessionManager.hpp"
 #include "storage/GraphStorage.hpp"
+#include "dataframe/ArrowIpc.hpp"
+#include "dataframe/ColumnarFile.hpp"
+#include <unistd.h>
+#include <atomic>
+#include <filesystem>
+#include <limits>
 #include <map>
+#include <utility>
 
 namespace dataframe {
 namespace server {
@@ -23,19 +30,78 @@ void HttpSession::run() {
         beast::bind_front_handler(&HttpSession::doRead, shared_from_this()));
 }
 
+// Supprime un fichier temporaire d'upload en fin de portée (sauf si path a été déplacé)
+struct RemoveFile {
+    std::string path;
+    ~RemoveFile() {
+        if (path.empty()) return;
+        std::error_code removeEc;
+        std::filesystem::remove(path, removeEc);
+    }
+};
+
+// Route d'upload brut : PUT /api/graph/:slug/inputs/:identifier (prochaine
+// exécution) ou PUT /api/graph/:slug/parameters/:identifier (parameter override)
+struct UploadRoute {
+    std::string slug;
+    std::string identifier;
+    bool persist = false;
+};
+
+std::optional<UploadRoute> parseUploadRoute(http::verb method, beast::string_view target) {
+    const beast::string_view prefix = "/api/graph/";
+    if (method != http::verb::put || !target.starts_with(prefix)) {
+        return std::nullopt;
+    }
+    beast::string_view rest = target.substr(prefix.size());
+    size_t slash = rest.find('/');
+    if (slash == 0 || slash == beast::string_view::npos) {
+        return std::nullopt;
+    }
+
+    UploadRoute route;
+    route.slug = std::string(rest.substr(0, slash));
+    beast::string_view subPath = rest.substr(slash);
+    beast::string_view identifier;
+    if (subPath.starts_with("/inputs/")) {
+        identifier = subPath.substr(8);
+    } else if (subPath.starts_with("/parameters/")) {
+        identifier = subPath.substr(12);
+        route.persist = true;
+    }
+    if (identifier.empty() || identifier.find('/') != beast::string_view::npos) {
+        return std::nullopt;
+    }
+    route.identifier = std::string(identifier);
+    return route;
+}
+
+// Format d'un corps d'upload d'après son Content-Type (nullopt : JSON ou autre)
+std::optional<UploadFormat> parseUploadFormat(beast::string_view contentType) {
+    contentType = contentType.substr(0, contentType.find(';'));
+    while (!contentType.empty() && contentType.back() == ' ') contentType.remove_suffix(1);
+
+    if (beast::iequals(contentType, "text/csv")) return UploadFormat::Csv;
+    if (beast::iequals(contentType, ColumnarFile::MIME_TYPE)) return UploadFormat::Columnar;
+    if (beast::iequals(contentType, ArrowIpc::MIME_TYPE)) return UploadFormat::Arrow;
+    if (beast::iequals(contentType, "application/octet-stream")) return UploadFormat::Binary;
+    return std::nullopt;
+}
+
 void HttpSession::doRead() {
-    m_parser.emplace();
-    m_parser->body_limit(50 * 1024 * 1024); // 50 MB
+    // Limite du corps appliquée par route une fois le header lu (voir onReadHeader)
+    m_headerParser.emplace();
+    m_headerParser->body_limit(std::numeric_limits<std::uint64_t>::max());
     m_stream.expires_after(std::chrono::seconds(30));
 
-    http::async_read(
+    http::async_read_header(
         m_stream,
         m_buffer,
-        *m_parser,
-        beast::bind_front_handler(&HttpSession::onRead, shared_from_this()));
+        *m_headerParser,
+        beast::bind_front_handler(&HttpSession::onReadHeader, shared_from_this()));
 }
 
-void HttpSession::onRead(beast::error_code ec, std::size_t /*bytes_transferred*/) {
+void HttpSession::onReadHeader(beast::error_code ec, std::size_t /*bytes_transferred*/) {
     if (ec == http::error::end_of_stream) {
         return doClose();
     }
@@ -45,6 +111,35 @@ void HttpSession::onRead(beast::error_code ec, std::size_t /*bytes_transferred*/
         return;
     }
 
+    // Upload brut (CSV, .adf, Arrow) : corps écrit sur disque au fil de l'eau
+    const auto& header = m_headerParser->get();
+    if (parseUploadRoute(header.method(), header.target()) &&
+        parseUploadFormat(header[http::field::content_type])) {
+        return startUpload();
+    }
+
+    // Autres requêtes : corps (JSON) lu en mémoire
+    const uint64_t bodyLimit = 50 * 1024 * 1024; // 50 MB
+    if (m_headerParser->content_length().value_or(0) > bodyLimit) {
+        LOG_ERROR("Read error: body limit exceeded");
+        return;
+    }
+    m_parser.emplace(std::move(*m_headerParser));
+    m_parser->body_limit(bodyLimit);
+
+    http::async_read(
+        m_stream,
+        m_buffer,
+        *m_parser,
+        beast::bind_front_handler(&HttpSession::onRead, shared_from_this()));
+}
+
+void HttpSession::onRead(beast::error_code ec, std::size_t /*bytes_transferred*/) {
+    if (ec) {
+        LOG_ERROR("Read error: " + ec.message());
+        return;
+    }
+
     auto response = handleRequest(m_parser->release());
 
     // If SSE mode was activated, the connection is handled by SSE methods
@@ -84,31 +179,200 @@ void HttpSession::doClose() {
     m_stream.socket().shutdown(tcp::socket::shutdown_send, ec);
 }
 
-// Création d'une réponse JSON
-http::response<http::string_body> makeJsonResponse(
+// Création d'une réponse à partir d'un corps déjà encodé (JSON, ou flux
+// Arrow IPC pour les pages DataFrame négociées)
+http::response<http::string_body> makeEncodedJsonResponse(
     http::status status,
-    const json& body,
+    std::string body,
     unsigned version,
     bool keepAlive,
-    uint64_t requestId)
+    uint64_t requestId,
+    const std::string& contentType = "application/json")
 {
     http::response<http::string_body> res{status, version};
     res.set(http::field::server, "AnodeServer/1.0");
-    res.set(http::field::content_type, "application/json");
+    res.set(http::field::content_type, contentType);
     res.set(http::field::cache_control, "no-store");
     res.set(http::field::access_control_allow_origin, "*");
     res.set(http::field::access_control_allow_methods, "GET, POST, PUT, DELETE, OPTIONS");
     res.set(http::field::access_control_allow_headers, "Content-Type");
     res.keep_alive(keepAlive);
-    res.body() = body.dump();
+    res.body() = std::move(body);
     res.prepare_payload();
 
-    // Log response with request ID correlation
-    Logger::instance().logResponse(requestId, static_cast<int>(status), res.body(), res.body().size());
+    // Log response with request ID correlation (binary bodies: size only)
+    bool binary = contentType != "application/json";
+    Logger::instance().logResponse(requestId, static_cast<int>(status),
+                                   binary ? std::string() : res.body(), res.body().size());
 
     return res;
 }
 
+// Format des pages DataFrame : Arrow IPC si le client l'accepte, JSON sinon
+PageFormat negotiatePageFormat(const http::request<http::string_body>& req) {
+    auto it = req.find(http::field::accept);
+    if (it != req.end() && it->value().find(ArrowIpc::MIME_TYPE) != std::string_view::npos) {
+        return PageFormat::Arrow;
+    }
+    return PageFormat::Json;
+}
+
+// Création d'une réponse JSON
+http::response<http::string_body> makeJsonResponse(
+    http::status status,
+    const json& body,
+    unsigned version,
+    bool keepAlive,
+    uint64_t requestId)
+{
+    return makeEncodedJsonResponse(status, body.dump(), version, keepAlive, requestId);
+}
+
+// Cookies de la requête (header Cookie)
+std::map<std::string, std::string> parseCookies(const http::fields& fields) {
+    std::map<std::string, std::string> cookies;
+    auto it = fields.find(http::field::cookie);
+    if (it != fields.end()) {
+        std::string cookieStr(it->value());
+        size_t pos = 0;
+        while (pos < cookieStr.size()) {
+            size_t eq = cookieStr.find('=', pos);
+            if (eq == std::string::npos) break;
+            size_t semi = cookieStr.find(';', eq);
+            if (semi == std::string::npos) semi = cookieStr.size();
+            std::string key = cookieStr.substr(pos, eq - pos);
+            std::string val = cookieStr.substr(eq + 1, semi - eq - 1);
+            // Trim whitespace
+            while (!key.empty() && key.front() == ' ') key.erase(key.begin());
+            while (!key.empty() && key.back() == ' ') key.pop_back();
+            while (!val.empty() && val.front() == ' ') val.erase(val.begin());
+            while (!val.empty() && val.back() == ' ') val.pop_back();
+            if (!key.empty()) cookies[key] = val;
+            pos = semi + 1;
+        }
+    }
+    return cookies;
+}
+
+void HttpSession::startUpload() {
+    auto& handler = RequestHandler::instance();
+    const auto& header = m_headerParser->get();
+    std::string target(header.target());
+    std::string method(header.method_string());
+    unsigned version = header.version();
+
+    // Authentification avant de recevoir le corps ; la connexion est fermée
+    // ensuite puisque le corps n'a pas été lu
+    RequestContext ctx;
+    auto validationResult = handler.validateRequest(method, target, parseCookies(header), ctx);
+    if (validationResult) {
+        uint64_t requestId = Logger::instance().logRequest(method, target);
+        auto [code, respJson] = *validationResult;
+        return sendResponse(makeJsonResponse(
+            static_cast<http::status>(code), respJson, version, false, requestId));
+    }
+
+    m_uploadUserId = ctx.userId;
+
+    static std::atomic<uint64_t> uploadCounter{0};
+    m_uploadPath = (std::filesystem::temp_directory_path() /
+                    ("anode-upload-" + std::to_string(::getpid()) + "-" +
+                     std::to_string(++uploadCounter))).string();
+    bool expectContinue = beast::iequals(header[http::field::expect], "100-continue");
+
+    const uint64_t uploadLimit = 4ULL * 1024 * 1024 * 1024; // 4 GB (sur disque)
+    if (m_headerParser->content_length().value_or(0) > uploadLimit) {
+        uint64_t requestId = Logger::instance().logRequest(method, target);
+        return sendResponse(makeJsonResponse(
+            http::status::payload_too_large,
+            json{{"status", "error"}, {"message", "Upload too large"}},
+            version, false, requestId));
+    }
+    m_uploadParser.emplace(std::move(*m_headerParser));
+    m_uploadParser->body_limit(uploadLimit);
+    beast::error_code ec;
+    // write_new (O_EXCL) : ne suit pas un lien ou un fichier préparé sous ce nom dans /tmp
+    m_uploadParser->get().body().open(m_uploadPath.c_str(), beast::file_mode::write_new, ec);
+    if (ec) {
+        LOG_ERROR("Cannot create upload file " + m_uploadPath + ": " + ec.message());
+        uint64_t requestId = Logger::instance().logRequest(method, target);
+        return sendResponse(makeJsonResponse(
+            http::status::internal_server_error,
+            json{{"status", "error"}, {"message", "Cannot store upload"}},
+            version, false, requestId));
+    }
+    m_stream.expires_after(std::chrono::minutes(10));
+
+    auto readBody = [self = shared_from_this()]() {
+        http::async_read(
+            self->m_stream,
+            self->m_buffer,
+            *self->m_uploadParser,
+            beast::bind_front_handler(&HttpSession::onReadUpload, self));
+    };
+
+    // Les clients (curl...) attendent "100 Continue" avant d'envoyer un gros corps
+    if (expectContinue) {
+        auto res = std::make_shared<http::response<http::empty_body>>(http::status::continue_, version);
+        http::async_write(m_stream, *res, [res, readBody](beast::error_code writeEc, std::size_t) {
+            if (writeEc) {
+                LOG_ERROR("Write error: " + writeEc.message());
+                return;
+            }
+            readBody();
+        });
+        return;
+    }
+    readBody();
+}
+
+void HttpSession::onReadUpload(beast::error_code ec, std::size_t bytes_transferred) {
+    auto req = m_uploadParser->release();
+    req.body().close();
+    m_uploadParser.reset();
+
+    // Le fichier temporaire est supprimé une fois le DataFrame chargé (par le worker)
+    RemoveFile cleanup{m_uploadPath};
+
+    std::string target(req.target());
+    std::string method(req.method_string());
+
+    if (ec == http::error::body_limit) {
+        uint64_t requestId = Logger::instance().logRequest(method, target);
+        return sendResponse(makeJsonResponse(
+            http::status::payload_too_large,
+            json{{"status", "error"}, {"message", "Upload too large"}},
+            req.version(), false, requestId));
+    }
+    if (ec) {
+        LOG_ERROR("Upload read error: " + ec.message());
+        return;
+    }
+
+    uint64_t requestId = Logger::instance().logRequest(
+        method, target, "<" + std::to_string(bytes_transferred) + " bytes>");
+    auto route = parseUploadRoute(req.method(), target);
+    auto format = parseUploadFormat(req[http::field::content_type]);
+
+    // Chargement (jusqu'à 4 GB) hors du thread IO : les autres connexions, dont
+    // l'annulation, restent servies. La réponse est renvoyée sur le thread IO.
+    auto& handler = RequestHandler::instance();
+    handler.startExecutionWorker(
+        [self = shared_from_this(), route = *route, format = *format, path = std::exchange(cleanup.path, {}),
+         version = req.version(), keepAlive = req.keep_alive(), requestId]() {
+            RemoveFile workerCleanup{path};
+            json result = RequestHandler::instance().handleUploadInput(
+                route.slug, route.identifier, path, format, route.persist, self->m_uploadUserId);
+            http::status status = result.value("status", "") == "ok"
+                ? http::status::ok : http::status::bad_request;
+            auto response = makeJsonResponse(status, result, version, keepAlive, requestId);
+            net::post(self->m_stream.get_executor(),
+                [self, response = std::move(response)]() mutable {
+                    self->sendResponse(std::move(response));
+                });
+        });
+}
+
 http::response<http::string_body> HttpSession::handleRequest(
     http::request<http::string_body>&& req)
 {
@@ -136,28 +400,7 @@ http::response<http::string_body> HttpSession::handleRequest(
     // Run request validators (authentication)
     RequestContext ctx;
     {
-        std::map<std::string, std::string> cookies;
-        auto it = req.find(http::field::cookie);
-        if (it != req.end()) {
-            std::string cookieStr(it->value());
-            size_t pos = 0;
-            while (pos < cookieStr.size()) {
-                size_t eq = cookieStr.find('=', pos);
-                if (eq == std::string::npos) break;
-                size_t semi = cookieStr.find(';', eq);
-                if (semi == std::string::npos) semi = cookieStr.size();
-                std::string key = cookieStr.substr(pos, eq - pos);
-                std::string val = cookieStr.substr(eq + 1, semi - eq - 1);
-                // Trim whitespace
-                while (!key.empty() && key.front() == ' ') key.erase(key.begin());
-                while (!key.empty() && key.back() == ' ') key.pop_back();
-                while (!val.empty() && val.front() == ' ') val.erase(val.begin());
-                while (!val.empty() && val.back() == ' ') val.pop_back();
-                if (!key.empty()) cookies[key] = val;
-                pos = semi + 1;
-            }
-        }
-        auto validationResult = handler.validateRequest(method, target, cookies, ctx);
+        auto validationResult = handler.validateRequest(method, target, parseCookies(req), ctx);
         if (validationResult) {
             auto [code, respJson] = *validationResult;
             return makeJsonResponse(
@@ -210,6 +453,25 @@ http::response<http::string_body> HttpSession::handleRequest(
                 requestId);
         }
 
+        // POST /api/snapshot
+        if (req.method() == http::verb::post && target == "/api/snapshot") {
+            if (!handler.hasSnapshots()) {
+                return makeJsonResponse(
+                    http::status::service_unavailable,
+                    json{{"status", "error"}, {"message", "Snapshots are not enabled (--snapshot-dir)"}},
+                    req.version(),
+                    req.keep_alive(),
+                    requestId);
+            }
+            json result = handler.saveSnapshots();
+            return makeJsonResponse(
+                result["status"] == "ok" ? http::status::ok : http::status::internal_server_error,
+                result,
+                req.version(),
+                req.keep_alive(),
+                requestId);
+        }
+
         // POST /api/dataset/query
         if (req.method() == http::verb::post && target == "/api/dataset/query") {
             if (!handler.isLoaded()) {
@@ -233,9 +495,9 @@ http::response<http::string_body> HttpSession::handleRequest(
                     requestId);
             }
 
-            return makeJsonResponse(
+            return makeEncodedJsonResponse(
                 http::status::ok,
-                handler.handleQuery(requestBody),
+                handler.handleQuery(requestBody).body,
                 req.version(),
                 req.keep_alive(),
                 requestId);
@@ -344,12 +606,13 @@ http::response<http::string_body> HttpSession::handleRequest(
                     }
                 }
 
-                json result = handler.handleExecuteGraph(slug, requestBody, {}, ctx.userId);
-                http::status status = result.value("status", "") == "ok"
+                EncodedJson result = handler.handleExecuteGraph(slug, requestBody, {}, ctx.userId);
+                http::status status = result.ok
                     ? http::status::ok
                     : http::status::internal_server_error;
 
-                return makeJsonResponse(status, result, req.version(), req.keep_alive(), requestId);
+                return makeEncodedJsonResponse(status, std::move(result.body), req.version(), req.keep_alive(),
+                                               requestId);
             }
 
             // POST /api/graph/:slug/execute-dynamic
@@ -368,12 +631,13 @@ http::response<http::string_body> HttpSession::handleRequest(
                     }
                 }
 
-                json result = handler.handleExecuteDynamic(slug, requestBody);
-                http::status status = result.value("status", "") == "ok"
+                EncodedJson result = handler.handleExecuteDynamic(slug, requestBody);
+                http::status status = result.ok
                     ? http::status::ok
                     : http::status::internal_server_error;
 
-                return makeJsonResponse(status, result, req.version(), req.keep_alive(), requestId);
+                return makeEncodedJsonResponse(status, std::move(result.body), req.version(), req.keep_alive(),
+                                               requestId);
             }
 
             // GET /api/graph/:slug/dynamic-equations
@@ -464,6 +728,27 @@ http::response<http::string_body> HttpSession::handleRequest(
                 }
             }
 
+            // PUT /api/graph/:slug/inputs/:identifier, DELETE /api/graph/:slug/inputs/:upload_id
+            // (PUT with a CSV / .adf / Arrow body is streamed, see startUpload)
+            if (subPath.rfind("/inputs/", 0) == 0 && subPath.length() > 8) {
+                std::string identifier = subPath.substr(8);
+
+                if (req.method() == http::verb::put) {
+                    return makeJsonResponse(http::status::unsupported_media_type,
+                        json{{"status", "error"}, {"message",
+                            "Expected Content-Type text/csv, " + std::string(ColumnarFile::MIME_TYPE) + ", " +
+                            ArrowIpc::MIME_TYPE + " or application/octet-stream"}},
+                        req.version(), req.keep_alive(), requestId);
+                }
+
+                if (req.method() == http::verb::delete_) {
+                    json result = handler.handleDeleteInput(slug, identifier, ctx.userId);
+                    http::status status = result.value("status", "") == "ok"
+                        ? http::status::ok : http::status::not_found;
+                    return makeJsonResponse(status, result, req.version(), req.keep_alive(), requestId);
+                }
+            }
+
             // ============================================================
             // Test Scenarios
             // ============================================================
@@ -585,12 +870,14 @@ http::response<http::string_body> HttpSession::handleRequest(
                         }
                     }
 
-                    json result = handler.handleGetOutput(slug, outputName, requestBody);
-                    http::status status = result.value("status", "") == "ok"
+                    EncodedJson result = handler.handleGetOutput(slug, outputName, requestBody,
+                                                                 negotiatePageFormat(req));
+                    http::status status = result.ok
                         ? http::status::ok
                         : http::status::not_found;
 
-                    return makeJsonResponse(status, result, req.version(), req.keep_alive(), requestId);
+                    return makeEncodedJsonResponse(status, std::move(result.body), req.version(), req.keep_alive(),
+                                                   requestId, result.contentType);
                 }
             }
 
@@ -708,6 +995,16 @@ http::response<http::string_body> HttpSession::handleRequest(
             std::string sessionId = remaining.substr(0, pos1);
             remaining = remaining.substr(pos1 + 1);
 
+            // POST /api/session/{sessionId}/cancel - stop a running execution
+            if (req.method() == http::verb::post && remaining == "cancel") {
+                json result = handler.handleCancelExecution(sessionId);
+                http::status status = result.value("status", "") == "ok"
+                    ? http::status::ok
+                    : http::status::not_found;
+
+                return makeJsonResponse(status, result, req.version(), req.keep_alive(), requestId);
+            }
+
             // Expect "dataframe/"
             if (remaining.rfind("dataframe/", 0) != 0) {
                 return makeJsonResponse(http::status::bad_request,
@@ -738,12 +1035,14 @@ http::response<http::string_body> HttpSession::handleRequest(
                     }
                 }
 
-                json result = handler.handleSessionDataFrame(sessionId, nodeId, portName, requestBody);
-                http::status status = result.value("status", "") == "ok"
+                EncodedJson result = handler.handleSessionDataFrame(sessionId, nodeId, portName, requestBody,
+                                                                    negotiatePageFormat(req));
+                http::status status = result.ok
                     ? http::status::ok
                     : http::status::not_found;
 
-                return makeJsonResponse(status, result, req.version(), req.keep_alive(), requestId);
+                return makeEncodedJsonResponse(status, std::move(result.body), req.version(), req.keep_alive(),
+                                               requestId, result.contentType);
             }
         }
 
@@ -817,9 +1116,9 @@ void HttpSession::handleSseExecuteStream(const std::string& slug, unsigned /*ver
         return;
     }
 
-    nodes::NodeGraph graph;
+    storage::CompiledGraphPtr compiled;
     try {
-        graph = graphStorage->loadGraph(slug);
+        compiled = graphStorage->loadCompiled(slug);
     } catch (const std::exception& e) {
         sendSseEvent("error", "{\"message\":\"Failed to load graph: " + std::string(e.what()) + "\"}");
         closeSseConnection();
@@ -833,17 +1132,39 @@ void HttpSession::handleSseExecuteStream(const std::string& slug, unsigned /*ver
     // Send start event
     json startEvent = {
         {"session_id", sessionId},
-        {"node_count", graph.nodeCount()}
+        {"node_count", compiled->plan->size()}
     };
     sendSseEvent("execution_start", startEvent.dump());
 
+    // Annulation : déconnexion du client, POST /api/session/:id/cancel, délai du graphe
+    m_sseCancellation = handler.makeCancellation(slug);
+    handler.registerExecution(sessionId, m_sseCancellation);
+
+    auto options = handler.executionOptions();
+    options.cancellation = m_sseCancellation;
+
+    // Exécution hors du thread IO : l'annulation (POST /api/session/:id/cancel)
+    // et les autres requêtes restent servies. Le worker est seul à utiliser
+    // la socket de cette session jusqu'à sa fermeture.
+    handler.startExecutionWorker([self = shared_from_this(), slug, sessionId, compiled, options]() {
+        self->runSseExecution(slug, sessionId, compiled, options);
+    });
+}
+
+void HttpSession::runSseExecution(const std::string& slug, const std::string& sessionId,
+                                  const storage::CompiledGraphPtr& compiled,
+                                  const nodes::ExecutionOptions& options) {
+    auto& handler = RequestHandler::instance();
+    auto& sessionMgr = SessionManager::instance();
+
     // Create executor with callback for real-time events
     nodes::NodeExecutor executor(nodes::NodeRegistry::instance());
+    executor.setOptions(options);
 
     // Track results for CSV storage
     std::unordered_map<std::string, std::unordered_map<std::string, nodes::Workload>> allResults;
 
-    executor.setExecutionCallback([this, &sessionMgr, &sessionId, &allResults](const nodes::ExecutionEvent& evt) {
+    executor.setExecutionCallback([this, &sessionId](const nodes::ExecutionEvent& evt) {
         json eventJson = evt.toJson();
         eventJson["session_id"] = sessionId;
 
@@ -865,7 +1186,7 @@ void HttpSession::handleSseExecuteStream(const std::string& slug, unsigned /*ver
 
     // Execute the graph
     try {
-        allResults = executor.execute(graph);
+        allResults = executor.execute(compiled->plan);
 
         // Store all CSV results in session
         for (const auto& [nodeId, outputs] : allResults) {
@@ -886,6 +1207,13 @@ void HttpSession::handleSseExecuteStream(const std::string& slug, unsigned /*ver
         };
         sendSseEvent("execution_complete", completeEvent.dump());
 
+    } catch (const OperationCancelled& e) {
+        LOG_INFO("Execution of " + slug + " stopped: " + e.what());
+        json cancelledEvent = {
+            {"session_id", sessionId},
+            {"message", e.what()}
+        };
+        sendSseEvent("execution_cancelled", cancelledEvent.dump());
     } catch (const std::exception& e) {
         json errorEvent = {
             {"message", e.what()}
@@ -893,6 +1221,8 @@ void HttpSession::handleSseExecuteStream(const std::string& slug, unsigned /*ver
         sendSseEvent("error", errorEvent.dump());
     }
 
+    handler.unregisterExecution(sessionId);
+    m_sseCancellation.reset();
     closeSseConnection();
 }
 
@@ -905,6 +1235,10 @@ void HttpSession::sendSseEvent(const std::string& eventType, const std::string&
     net::write(m_stream.socket(), net::buffer(sseMessage), ec);
     if (ec) {
         LOG_ERROR("SSE event write error: " + ec.message());
+        // Client parti : inutile de poursuivre l'exécution
+        if (m_sseCancellation) {
+            m_sseCancellation->cancel();
+        }
     }
 }
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "dataframe/Cancellation.hpp"
+#include "nodes/NodeExecutor.hpp"
+#include "storage/CompiledGraphCache.hpp"
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
 #include <memory>
@@ -26,6 +29,7 @@ public:
 
 private:
     void doRead();
+    void onReadHeader(beast::error_code ec, std::size_t bytes_transferred);
     void onRead(beast::error_code ec, std::size_t bytes_transferred);
     void sendResponse(http::response<http::string_body> response);
     void onWrite(bool close, beast::error_code ec, std::size_t bytes_transferred);
@@ -35,15 +39,29 @@ private:
     http::response<http::string_body> handleRequest(
         http::request<http::string_body>&& req);
 
+    // Raw DataFrame uploads (PUT /api/graph/:slug/inputs|parameters/:identifier):
+    // the body is streamed to a temporary file instead of memory
+    void startUpload();
+    void onReadUpload(beast::error_code ec, std::size_t bytes_transferred);
+
     // SSE streaming for graph execution
     void handleSseExecuteStream(const std::string& slug, unsigned version, bool keepAlive);
+    // Exécution du flux, sur un worker (voir RequestHandler::startExecutionWorker)
+    void runSseExecution(const std::string& slug, const std::string& sessionId,
+                         const storage::CompiledGraphPtr& compiled,
+                         const nodes::ExecutionOptions& options);
     void sendSseEvent(const std::string& eventType, const std::string& data);
     void closeSseConnection();
 
     beast::tcp_stream m_stream;
     beast::flat_buffer m_buffer;
+    std::optional<http::request_parser<http::empty_body>> m_headerParser;
     std::optional<http::request_parser<http::string_body>> m_parser;
+    std::optional<http::request_parser<http::file_body>> m_uploadParser;
+    std::string m_uploadPath;
+    std::string m_uploadUserId;
     bool m_sseMode = false;  // True when handling SSE stream
+    std::shared_ptr<CancellationToken> m_sseCancellation;  // Annulée si le client se déconnecte
 };
 
 } // namespace server
@@ -2,13 +2,21 @@
 #include "server/SessionManager.hpp"
 #include "server/Logger.hpp"
 #include "server/Profiler.hpp"
+#include "dataframe/ArrowIpc.hpp"
 #include "dataframe/DataFrameIO.hpp"
 #include "dataframe/DataFrameSerializer.hpp"
+#include "dataframe/JsonReader.hpp"
+#include "dataframe/JsonWriter.hpp"
 #include "dataframe/Column.hpp"
 #include "nodes/NodeGraphSerializer.hpp"
 #include "nodes/NodeExecutor.hpp"
 #include "nodes/NodeRegistry.hpp"
 #include "nodes/EquationParser.hpp"
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <thread>
 #include <unordered_set>
 #include <cmath>
 
@@ -64,6 +72,153 @@ std::string nodeTypeToErrorString(nodes::NodeType type) {
     }
 }
 
+/**
+ * Execution options of a request: server defaults, then "retention"
+ * ("all" or "outputs") and "inspect" (node ids whose DataFrames are kept)
+ */
+nodes::ExecutionOptions requestExecutionOptions(const nodes::ExecutionOptions& defaults,
+                                                const json& request) {
+    nodes::ExecutionOptions options = defaults;
+    if (request.contains("retention") && request["retention"].is_string()) {
+        std::string retention = request["retention"].get<std::string>();
+        if (retention == "all") {
+            options.retention = nodes::Retention::All;
+        } else if (retention == "outputs") {
+            options.retention = nodes::Retention::Outputs;
+        } else {
+            throw std::invalid_argument("retention must be \"all\" or \"outputs\"");
+        }
+    }
+    if (request.contains("inspect") && request["inspect"].is_array()) {
+        for (const auto& nodeId : request["inspect"]) {
+            options.keep.insert(nodeId.get<std::string>());
+        }
+    }
+    if (request.contains("targets") && request["targets"].is_array()) {
+        for (const auto& target : request["targets"]) {
+            options.targets.insert(target.get<std::string>());
+        }
+    }
+    if (request.contains("cache") && request["cache"].is_boolean() && !request["cache"].get<bool>()) {
+        options.cache = nullptr;
+    }
+    return options;
+}
+
+/**
+ * Resources of the executed nodes, by node id (see nodes::NodeResources)
+ */
+json nodeResourcesJson(const nodes::NodeExecutor& executor,
+                       const std::unordered_map<std::string, std::unordered_map<std::string, nodes::Workload>>& results) {
+    json resources = json::object();
+    for (const auto& [nodeId, outputs] : results) {
+        if (const auto* result = executor.getResult(nodeId)) {
+            resources[nodeId] = result->resources.toJson();
+        }
+    }
+    return resources;
+}
+
+/**
+ * Random id of a pending upload: upl_<16 hex chars>
+ */
+std::string makeUploadId() {
+    static std::mutex mutex;
+    static std::mt19937_64 gen(std::random_device{}());
+    std::lock_guard<std::mutex> lock(mutex);
+    std::stringstream ss;
+    ss << "upl_" << std::hex << std::setfill('0') << std::setw(16) << gen();
+    return ss.str();
+}
+
+/**
+ * Column type as exposed in JSON responses
+ */
+std::string columnTypeName(ColumnTypeOpt type) {
+    switch (type) {
+        case ColumnTypeOpt::INT: return "int";
+        case ColumnTypeOpt::DOUBLE: return "double";
+        case ColumnTypeOpt::STRING: return "string";
+    }
+    return "unknown";
+}
+
+/**
+ * Write the "columns" and "data" members of a DataFrame page [startRow, endRow)
+ */
+void writePage(JsonWriter& out, const DataFrame& df, const std::vector<std::string>& columns,
+               size_t startRow, size_t endRow) {
+    out.key("columns").beginArray();
+    for (const auto& name : columns) {
+        out.value(name);
+    }
+    out.endArray();
+    out.key("data").rows(startRow, endRow, columns,
+        [&df](const std::string& name) { return df.getColumn(name); });
+}
+
+using ExecutionResults =
+    std::unordered_map<std::string, std::unordered_map<std::string, nodes::Workload>>;
+
+/**
+ * Encode la réponse d'une exécution : les sorties des nœuds sont écrites en flux
+ * depuis les workloads, sans passer par un DOM json
+ */
+EncodedJson encodeExecutionResults(const std::string& sessionId, int64_t executionId,
+                                   const ExecutionResults& results, const json& csvMetadata,
+                                   int durationMs, const json* nodeResources) {
+    JsonWriter out;
+    out.beginObject();
+    out.key("status").value("ok");
+    out.key("session_id").value(sessionId);
+    out.key("execution_id").value(executionId);
+    out.key("results").beginObject();
+    for (const auto& [nodeId, outputs] : results) {
+        out.key(nodeId).beginObject();
+        for (const auto& [portName, workload] : outputs) {
+            out.key(portName);
+            nodes::NodeGraphSerializer::writeWorkload(out, workload);
+        }
+        out.endObject();
+    }
+    out.endObject();
+    out.key("csv_metadata").value(csvMetadata);
+    out.key("duration_ms").value(durationMs);
+    if (nodeResources) {
+        out.key("node_resources").value(*nodeResources);
+    }
+    out.endObject();
+    return {true, out.take()};
+}
+
+// execution_timeout_ms : entier >= 0 (0 : délai du serveur)
+bool validExecutionTimeout(const json& value) {
+    return value.is_number_integer() && value.get<int64_t>() >= 0;
+}
+
+constexpr const char* DATASET_SNAPSHOT = "dataset";
+constexpr const char* DATASET_INDEX_SECTION = "index";
+
+/**
+ * Fingerprint of a CSV dataset: source file and the options that change its content
+ */
+std::string datasetFingerprint(const std::string& csvPath, const SortOrder& sortedBy,
+                               const CsvReader::Schema& schema) {
+    std::string fingerprint = "csv:" + storage::SnapshotStore::fileFingerprint(csvPath) + "|sorted:";
+    for (const auto& key : sortedBy) {
+        fingerprint += key.column + (key.ascending ? " asc," : " desc,");
+    }
+    std::map<std::string, int> types;
+    for (const auto& [column, type] : schema) {
+        types[column] = static_cast<int>(type);
+    }
+    fingerprint += "|schema:";
+    for (const auto& [column, type] : types) {
+        fingerprint += column + "=" + std::to_string(type) + ",";
+    }
+    return fingerprint;
+}
+
 } // anonymous namespace
 
 RequestHandler& RequestHandler::instance() {
@@ -71,20 +226,194 @@ RequestHandler& RequestHandler::instance() {
     return instance;
 }
 
-void RequestHandler::loadDataset(const std::string& csvPath) {
+void RequestHandler::loadDataset(const std::string& csvPath, const SortOrder& sortedBy,
+                                 const CsvReader::Schema& schema) {
     LOG_INFO("Loading dataset: " + csvPath);
 
     ScopedTimer timer("loadDataset");
 
-    m_dataset = DataFrameIO::readCSV(csvPath);
+    // .adf : format binaire colonnaire (types et ordre de tri déjà stockés)
+    if (csvPath.ends_with(".adf")) {
+        m_dataset = DataFrameIO::readColumnar(csvPath);
+        if (!schema.empty()) {
+            LOG_WARN("Dataset schema ignored: column types are stored in the .adf file");
+        }
+        if (!sortedBy.empty()) {
+            m_dataset->declareSortedBy(sortedBy);
+        }
+        m_datasetFingerprint.clear();
+    } else {
+        m_datasetFingerprint = datasetFingerprint(csvPath, sortedBy, schema);
+        m_dataset = restoreDatasetSnapshot();
+        if (!m_dataset) {
+            m_dataset = DataFrameIO::readCSV(csvPath, ',', true, sortedBy, schema);
+        }
+    }
     m_datasetPath = csvPath;
     m_originalRows = m_dataset->rowCount();
 
+    if (!sortedBy.empty() && m_dataset->getSortedBy().empty()) {
+        LOG_WARN("Dataset is not sorted as declared, sort metadata ignored");
+    }
+
+    // Les index de l'ancien dataset ne sont plus valides
+    m_datasetIndex.reset();
+    if (m_datasetIndexEnabled) {
+        rebuildDatasetIndex();
+    }
+
     double duration = timer.stop();
     LOG_INFO("Dataset loaded: " + std::to_string(m_originalRows) + " rows in " +
              std::to_string(static_cast<int>(duration)) + "ms");
 }
 
+std::shared_ptr<DataFrame> RequestHandler::restoreDatasetSnapshot() {
+    if (!m_snapshots) {
+        return nullptr;
+    }
+    try {
+        auto frames = m_snapshots->load(DATASET_SNAPSHOT, m_datasetFingerprint);
+        if (frames && frames->contains("main")) {
+            LOG_INFO("Dataset restored from snapshot");
+            return frames->at("main");
+        }
+        LOG_INFO("No up-to-date dataset snapshot, parsing source");
+    } catch (const std::exception& e) {
+        LOG_WARN(std::string("Dataset snapshot unreadable, parsing source: ") + e.what());
+    }
+    return nullptr;
+}
+
+void RequestHandler::enableSnapshots(const std::string& directory) {
+    m_snapshots = std::make_unique<storage::SnapshotStore>(directory);
+    LOG_INFO("Snapshots enabled: " + directory);
+}
+
+json RequestHandler::saveSnapshots() {
+    if (!m_snapshots) {
+        return json{{"status", "error"}, {"message", "Snapshots are not enabled (--snapshot-dir)"}};
+    }
+
+    ScopedTimer timer("saveSnapshots");
+    json saved = json::array();
+    json unchanged = json::array();
+    json failed = json::array();
+
+    // Une entrée n'est réécrite que si sa source a changé depuis le dernier snapshot
+    auto saveEntry = [&](const std::string& name, const std::string& fingerprint,
+                         const std::function<storage::SnapshotStore::Frames()>& frames,
+                         const storage::SnapshotStore::Sections& sections = {}) {
+        try {
+            if (m_snapshots->fingerprint(name) == fingerprint) {
+                unchanged.push_back(name);
+                return;
+            }
+            m_snapshots->save(name, fingerprint, frames(), sections);
+            saved.push_back(name);
+        } catch (const std::exception& e) {
+            LOG_ERROR("Snapshot '" + name + "' failed: " + e.what());
+            failed.push_back({{"name", name}, {"error", e.what()}});
+        }
+    };
+
+    if (m_dataset && !m_datasetFingerprint.empty()) {
+        // Index construits (hash, trié, trigrammes) persistés avec le dataset
+        storage::SnapshotStore::Sections sections;
+        if (m_datasetIndex) {
+            sections[DATASET_INDEX_SECTION] = [this](std::ostream& out) { m_datasetIndex->save(out); };
+        }
+        saveEntry(DATASET_SNAPSHOT, m_datasetFingerprint, [&]() {
+            return storage::SnapshotStore::Frames{{"main", m_dataset}};
+        }, sections);
+    }
+    for (const auto& cache : m_snapshotCaches) {
+        std::string fingerprint;
+        try {
+            fingerprint = cache.fingerprint();
+        } catch (const std::exception& e) {
+            LOG_ERROR("Snapshot '" + cache.name + "' failed: " + e.what());
+            failed.push_back({{"name", cache.name}, {"error", e.what()}});
+            continue;
+        }
+        saveEntry(cache.name, fingerprint, cache.save);
+    }
+
+    double duration = timer.stop();
+    LOG_INFO("Snapshots saved: " + std::to_string(saved.size()) + " written, " +
+             std::to_string(unchanged.size()) + " unchanged in " +
+             std::to_string(static_cast<int>(duration)) + "ms");
+
+    return json{
+        {"status", failed.empty() ? "ok" : "error"},
+        {"directory", m_snapshots->directory()},
+        {"saved", saved},
+        {"unchanged", unchanged},
+        {"failed", failed},
+        {"duration_ms", duration}
+    };
+}
+
+bool RequestHandler::registerSnapshotCache(SnapshotCache cache) {
+    if (cache.name == DATASET_SNAPSHOT) {
+        throw std::invalid_argument("Snapshot name is reserved: " + cache.name);
+    }
+    m_snapshotCaches.push_back(cache);
+    if (!m_snapshots) {
+        return false;
+    }
+
+    try {
+        auto frames = m_snapshots->load(cache.name, cache.fingerprint());
+        if (!frames) {
+            return false;
+        }
+        cache.restore(*frames);
+        LOG_INFO("Snapshot restored: " + cache.name);
+        return true;
+    } catch (const std::exception& e) {
+        LOG_WARN("Snapshot '" + cache.name + "' not restored: " + e.what());
+        return false;
+    }
+}
+
+void RequestHandler::enableDatasetIndex(const DataFrameIndex::Spec& eager) {
+    m_datasetIndexEnabled = true;
+    m_datasetIndexSpec = eager;
+    if (m_dataset) {
+        rebuildDatasetIndex();
+    }
+}
+
+void RequestHandler::rebuildDatasetIndex() {
+    ScopedTimer timer("buildDatasetIndex");
+
+    m_datasetIndex = std::make_unique<DataFrameIndex>(m_dataset);
+    if (m_snapshots && !m_datasetFingerprint.empty()) {
+        try {
+            if (m_snapshots->loadSection(DATASET_SNAPSHOT, m_datasetFingerprint, DATASET_INDEX_SECTION,
+                                         [this](std::istream& in) { m_datasetIndex->load(in); })) {
+                LOG_INFO("Dataset indexes restored from snapshot");
+            }
+        } catch (const std::exception& e) {
+            LOG_WARN(std::string("Dataset index snapshot unreadable, rebuilding: ") + e.what());
+        }
+    }
+
+    // Index de la spec absents du snapshot
+    for (const auto& [column, kind] : m_datasetIndexSpec) {
+        try {
+            m_datasetIndex->build(column, kind);
+        } catch (const std::exception& e) {
+            LOG_WARN(std::string("Dataset index skipped: ") + e.what());
+        }
+    }
+
+    if (!m_datasetIndexSpec.empty()) {
+        LOG_INFO("Dataset indexes built: " + m_datasetIndex->stats()["indexes"].dump() +
+                 " in " + std::to_string(static_cast<int>(timer.stop())) + "ms");
+    }
+}
+
 json RequestHandler::handleHealth() {
     return json{
         {"status", "ok"},
@@ -103,33 +432,30 @@ json RequestHandler::handleDatasetInfo() {
     json columnsInfo = json::array();
 
     for (const auto& colName : columns) {
-        auto col = m_dataset->getColumn(colName);
-        std::string typeStr;
-        switch (col->getType()) {
-            case ColumnTypeOpt::INT: typeStr = "int"; break;
-            case ColumnTypeOpt::DOUBLE: typeStr = "double"; break;
-            case ColumnTypeOpt::STRING: typeStr = "string"; break;
-        }
         columnsInfo.push_back({
             {"name", colName},
-            {"type", typeStr}
+            {"type", columnTypeName(m_dataset->getColumn(colName)->getType())}
         });
     }
 
-    return json{
+    json info = {
         {"status", "ok"},
         {"path", m_datasetPath},
         {"rows", m_dataset->rowCount()},
         {"columns", columnsInfo}
     };
+    if (m_datasetIndex) {
+        info["index"] = m_datasetIndex->stats();
+    }
+    return info;
 }
 
-json RequestHandler::handleQuery(const json& request) {
+EncodedJson RequestHandler::handleQuery(const json& request) {
     ScopedTimer queryTimer("handleQuery");
 
     if (!m_dataset) {
         LOG_WARN("Query received but no dataset loaded");
-        return json{{"status", "error"}, {"message", "No dataset loaded"}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "No dataset loaded"}});
     }
 
     // Copie du dataset pour les opérations
@@ -164,30 +490,40 @@ json RequestHandler::handleQuery(const json& request) {
                     result = result->pivotDf(params);
                     if (!result) {
                         LOG_ERROR("Operation 'pivot' returned null");
-                        return json{
+                        return EncodedJson::from(json{
                             {"status", "error"},
                             {"message", "Operation 'pivot' returned null"}
-                        };
+                        });
                     }
                     LOG_INFO("PivotDf result: " + std::to_string(result->rowCount()) + " rows, " +
                              std::to_string(result->columnCount()) + " columns");
                     continue;
                 }
 
-                result = executeOperation(result, opType, params);
+                // Opérations directement sur le dataset : passer par les index
+                std::shared_ptr<DataFrame> indexed;
+                if (m_datasetIndex && result == m_dataset) {
+                    if (opType == "filter") {
+                        indexed = m_datasetIndex->filter(params);
+                    } else if (opType == "orderby" || opType == "order_by" || opType == "sort") {
+                        indexed = m_datasetIndex->orderBy(params);
+                    }
+                }
+
+                result = indexed ? indexed : executeOperation(result, opType, params);
                 if (!result) {
                     LOG_ERROR("Operation '" + opType + "' returned null");
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"message", "Operation '" + opType + "' returned null"}
-                    };
+                    });
                 }
             } catch (const std::exception& e) {
                 LOG_ERROR("Operation '" + opType + "' failed: " + std::string(e.what()));
-                return json{
+                return EncodedJson::from(json{
                     {"status", "error"},
                     {"message", "Operation '" + opType + "' failed: " + e.what()}
-                };
+                });
             }
         }
     }
@@ -199,7 +535,7 @@ json RequestHandler::handleQuery(const json& request) {
         size_t numGroups = treeData.contains("data") ? treeData["data"].size() : 0;
         LOG_DEBUG("GroupByTree completed: " + std::to_string(numGroups) + " groups in " +
                   std::to_string(static_cast<int>(duration)) + "ms");
-        return json{
+        return EncodedJson::from(json{
             {"status", "ok"},
             {"stats", {
                 {"input_rows", m_originalRows},
@@ -209,7 +545,7 @@ json RequestHandler::handleQuery(const json& request) {
             }},
             {"columns", treeData.value("columns", json::array())},
             {"data", treeData.value("data", json::array())}
-        };
+        });
     }
 
     // Pagination: offset et limit
@@ -225,37 +561,25 @@ json RequestHandler::handleQuery(const json& request) {
     size_t endRow = std::min(offset + limit, outputRows);
 
     // Format columnar: {"columns": [...], "data": [[...], [...]]}
-    json data = json::array();
-    for (size_t i = startRow; i < endRow; ++i) {
-        json row = json::array();
-        for (const auto& colName : columns) {
-            auto col = result->getColumn(colName);
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                row.push_back(intCol->at(i));
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                row.push_back(doubleCol->at(i));
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                row.push_back(stringCol->at(i));
-            }
-        }
-        data.push_back(row);
-    }
+    // encodé directement depuis les colonnes, sans DOM intermédiaire
+    size_t returnedRows = endRow - startRow;
+    JsonWriter out;
+    out.beginObject();
+    out.key("status").value("ok");
+    out.key("stats").beginObject()
+        .key("input_rows").value(m_originalRows)
+        .key("output_rows").value(outputRows)
+        .key("offset").value(startRow)
+        .key("returned_rows").value(returnedRows)
+        .key("duration_ms").value(static_cast<int>(duration))
+        .endObject();
+    writePage(out, *result, columns, startRow, endRow);
+    out.endObject();
 
     LOG_DEBUG("Query completed: " + std::to_string(outputRows) + " rows, returned " +
-              std::to_string(data.size()) + " in " + std::to_string(static_cast<int>(duration)) + "ms");
+              std::to_string(returnedRows) + " in " + std::to_string(static_cast<int>(duration)) + "ms");
 
-    return json{
-        {"status", "ok"},
-        {"stats", {
-            {"input_rows", m_originalRows},
-            {"output_rows", outputRows},
-            {"offset", startRow},
-            {"returned_rows", data.size()},
-            {"duration_ms", static_cast<int>(duration)}
-        }},
-        {"columns", columns},
-        {"data", data}
-    };
+    return {true, out.take()};
 }
 
 std::shared_ptr<DataFrame> RequestHandler::executeOperation(
@@ -370,6 +694,7 @@ json RequestHandler::handleListGraphs() {
             {"tags", g.tags},
             {"created_at", g.createdAt},
             {"updated_at", g.updatedAt},
+            {"execution_timeout_ms", g.executionTimeoutMs},
             {"links", {
                 {"outgoing", outgoing},
                 {"incoming", incoming}
@@ -404,7 +729,8 @@ json RequestHandler::handleGetGraph(const std::string& slug) {
             {"author", metadata->author},
             {"tags", metadata->tags},
             {"created_at", metadata->createdAt},
-            {"updated_at", metadata->updatedAt}
+            {"updated_at", metadata->updatedAt},
+            {"execution_timeout_ms", metadata->executionTimeoutMs}
         }}
     };
 
@@ -478,6 +804,10 @@ json RequestHandler::handleCreateGraph(const json& request) {
         return json{{"status", "error"}, {"message", "Slug cannot be empty"}};
     }
 
+    if (request.contains("execution_timeout_ms") && !validExecutionTimeout(request["execution_timeout_ms"])) {
+        return json{{"status", "error"}, {"message", "execution_timeout_ms must be a non-negative integer"}};
+    }
+
     // Check if graph already exists
     if (m_graphStorage->graphExists(slug)) {
         return json{{"status", "error"}, {"message", "Graph already exists: " + slug}};
@@ -489,6 +819,7 @@ json RequestHandler::handleCreateGraph(const json& request) {
     metadata.name = name;
     metadata.description = request.value("description", "");
     metadata.author = request.value("author", "");
+    metadata.executionTimeoutMs = request.value("execution_timeout_ms", int64_t{0});
 
     if (request.contains("tags") && request["tags"].is_array()) {
         for (const auto& tag : request["tags"]) {
@@ -523,6 +854,19 @@ json RequestHandler::handleUpdateGraph(const std::string& slug, const json& requ
         return json{{"status", "error"}, {"message", "Graph not found: " + slug}};
     }
 
+    // Execution deadline (metadata only, no new version)
+    if (request.contains("execution_timeout_ms")) {
+        if (!validExecutionTimeout(request["execution_timeout_ms"])) {
+            return json{{"status", "error"}, {"message", "execution_timeout_ms must be a non-negative integer"}};
+        }
+        auto metadata = m_graphStorage->getGraph(slug);
+        metadata->executionTimeoutMs = request["execution_timeout_ms"].get<int64_t>();
+        m_graphStorage->updateGraph(*metadata);
+        if (!request.contains("graph")) {
+            return json{{"status", "ok"}, {"execution_timeout_ms", metadata->executionTimeoutMs}};
+        }
+    }
+
     // Graph content is required
     if (!request.contains("graph")) {
         return json{{"status", "error"}, {"message", "Missing required field: graph"}};
@@ -569,58 +913,43 @@ json RequestHandler::handleDeleteGraph(const std::string& slug) {
     };
 }
 
-json RequestHandler::handleExecuteGraph(const std::string& slug, const json& request,
+EncodedJson RequestHandler::handleExecuteGraph(const std::string& slug, const json& request,
                                         const nodes::CsvOverrides& csvOverrides,
                                         const std::string& userId) {
     if (!m_graphStorage) {
-        return json{{"status", "error"}, {"message", "Graph storage not initialized"}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Graph storage not initialized"}});
     }
 
     ScopedTimer timer("executeGraph");
 
-    // Load the graph
-    nodes::NodeGraph graph;
-    std::optional<int64_t> versionId;
+    // Load the graph: parsed and compiled once per version (see CompiledGraphCache)
+    storage::CompiledGraphPtr compiled;
     try {
+        std::optional<int64_t> requestedVersion;
         if (request.contains("version_id") && !request["version_id"].is_null()) {
-            versionId = request["version_id"].get<int64_t>();
-            graph = m_graphStorage->loadVersion(*versionId);
-        } else {
-            graph = m_graphStorage->loadGraph(slug);
-            // Get the latest version ID
-            auto latestVersion = m_graphStorage->getLatestVersion(slug);
-            if (latestVersion) {
-                versionId = latestVersion->id;
-            }
+            requestedVersion = request["version_id"].get<int64_t>();
         }
+        compiled = m_graphStorage->loadCompiled(slug, requestedVersion);
     } catch (const std::exception& e) {
-        return json{{"status", "error"}, {"message", std::string("Failed to load graph: ") + e.what()}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", std::string("Failed to load graph: ") + e.what()}});
     }
+    const nodes::NodeGraph& graph = compiled->graph;
+    std::optional<int64_t> versionId = compiled->versionId;
+
+    // Input values of this execution, on top of the shared plan
+    nodes::PropertyOverlay overlay;
+    auto setValue = [&](const std::string& nodeId, const nodes::Workload& value) {
+        overlay.set(compiled->plan->slotOf(nodeId), "_value", value);
+    };
 
     // Parse and apply input overrides
     std::unordered_set<std::string> inputIdentifiers;
     if (request.contains("inputs") && request["inputs"].is_object()) {
-        // Build map identifier -> (nodeId, nodeType) for validation
-        std::unordered_map<std::string, std::pair<std::string, std::string>> identifierToNode;
-
-        for (const auto& [nodeId, instance] : graph.getNodes()) {
-            auto it = instance.properties.find("_identifier");
-            if (it != instance.properties.end() && !it->second.isNull()) {
-                std::string identifier = it->second.getString();
-                if (!identifier.empty()) {
-                    // Check for duplicate identifiers
-                    auto existing = identifierToNode.find(identifier);
-                    if (existing != identifierToNode.end()) {
-                        return json{
-                            {"status", "error"},
-                            {"error", "Duplicate identifier '" + identifier +
-                                      "' in nodes " + existing->second.first + " and " + nodeId}
-                        };
-                    }
-                    identifierToNode[identifier] = {nodeId, instance.definitionName};
-                }
-            }
+        // Map identifier -> (nodeId, nodeType) for validation
+        if (!compiled->duplicateIdentifierError.empty()) {
+            return EncodedJson::from(json{{"status", "error"}, {"error", compiled->duplicateIdentifierError}});
         }
+        const auto& identifierToNode = compiled->identifiers;
 
         // Apply the overrides with strict type validation
         bool skipUnknown = request.value("skip_unknown_inputs", false);
@@ -628,10 +957,10 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
             auto it = identifierToNode.find(identifier);
             if (it == identifierToNode.end()) {
                 if (skipUnknown) continue;
-                return json{
+                return EncodedJson::from(json{
                     {"status", "error"},
                     {"error", "Input identifier '" + identifier + "' not found in graph"}
-                };
+                });
             }
 
             const auto& [nodeId, nodeType] = it->second;
@@ -640,19 +969,17 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
             if (nodeType == "scalar/string_as_fields") {
                 if (value.is_array()) {
                     // Convert ["col_a","col_b"] → store as JSON array string
-                    graph.setProperty(nodeId, "_value",
-                        nodes::Workload(value.dump(), nodes::NodeType::String));
+                    setValue(nodeId, nodes::Workload(value.dump(), nodes::NodeType::String));
                 } else if (value.is_string()) {
                     // Accept raw JSON array string too
-                    graph.setProperty(nodeId, "_value",
-                        nodes::Workload(value.get<std::string>(), nodes::NodeType::String));
+                    setValue(nodeId, nodes::Workload(value.get<std::string>(), nodes::NodeType::String));
                 } else {
                     if (skipUnknown) continue;
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"error", "string_as_fields identifier '" + identifier +
                                   "' expects a JSON array of field names"}
-                    };
+                    });
                 }
                 inputIdentifiers.insert(identifier);
                 continue;
@@ -706,36 +1033,51 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
 
                 if (!converted) {
                     if (skipUnknown) continue;
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"error", "Type mismatch for identifier '" + identifier +
                                   "': expected " + nodeTypeToErrorString(expectedType.value()) +
                                   ", got " + nodeTypeToErrorString(workload.getType())}
-                    };
+                    });
                 }
             }
 
-            graph.setProperty(nodeId, "_value", workload);
+            setValue(nodeId, workload);
             inputIdentifiers.insert(identifier);
         }
     }
 
-    // Apply parameter overrides from DB (viewer mode)
+    // Uploaded inputs (PUT /inputs/:identifier) named in "uploads" are consumed by this execution
     nodes::CsvOverrides mergedOverrides = csvOverrides;
+    if (request.contains("uploads")) {
+        if (!request["uploads"].is_array()) {
+            return EncodedJson::from(json{{"status", "error"}, {"error", "'uploads' must be an array of upload ids"}});
+        }
+        std::lock_guard<std::mutex> lock(m_pendingInputsMutex);
+        prunePendingInputs();
+        std::vector<std::map<std::string, PendingInput>::iterator> consumed;
+        for (const auto& uploadId : request["uploads"]) {
+            auto pending = uploadId.is_string() ? m_pendingInputs.find(uploadId.get<std::string>())
+                                                : m_pendingInputs.end();
+            if (pending == m_pendingInputs.end() || pending->second.slug != slug ||
+                pending->second.userId != userId) {
+                return EncodedJson::from(json{{"status", "error"}, {"error", "Unknown or expired upload: " + uploadId.dump()}});
+            }
+            consumed.push_back(pending);
+        }
+        for (auto pending : consumed) {
+            mergedOverrides[pending->second.identifier] = pending->second.frame;
+            inputIdentifiers.insert(pending->second.identifier);
+            m_pendingInputBytes -= pending->second.bytes;
+            m_pendingInputs.erase(pending);
+        }
+    }
+
+    // Apply parameter overrides from DB (viewer mode)
     if (request.contains("apply_overrides") && request["apply_overrides"] == true) {
         auto overrides = m_graphStorage->getParameterOverrides(slug);
 
-        // Build identifier -> (nodeId, nodeType) map
-        std::unordered_map<std::string, std::pair<std::string, std::string>> identifierToNode;
-        for (const auto& [nodeId, instance] : graph.getNodes()) {
-            auto it = instance.properties.find("_identifier");
-            if (it != instance.properties.end() && !it->second.isNull()) {
-                std::string identifier = it->second.getString();
-                if (!identifier.empty()) {
-                    identifierToNode[identifier] = {nodeId, instance.definitionName};
-                }
-            }
-        }
+        const auto& identifierToNode = compiled->identifiers;
 
         for (const auto& [identifier, valueJsonStr] : overrides) {
             if (inputIdentifiers.count(identifier)) continue;  // Inline inputs have priority
@@ -743,30 +1085,47 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
             if (nodeIt == identifierToNode.end()) continue;  // Skip unknown identifiers silently
 
             const auto& [nodeId, nodeType] = nodeIt->second;
-            json valueJson = json::parse(valueJsonStr);
 
-            if (valueJson.contains("type") && valueJson["type"] == "csv") {
-                // CSV override → inject via CsvOverrides
-                if (valueJson.contains("value")) {
-                    auto df = dataframe::DataFrameSerializer::fromJson(valueJson["value"]);
-                    if (df) {
-                        mergedOverrides[identifier] = df;
+            // Read "type" first without building "value", which may be a large DataFrame
+            bool hasValue = false;
+            json header = json::parse(valueJsonStr,
+                [&hasValue](int depth, json::parse_event_t event, json& parsed) {
+                    if (depth == 1 && event == json::parse_event_t::key && parsed == "value") {
+                        hasValue = true;
+                        return false;
                     }
+                    return true;
+                });
+            if (!hasValue) continue;
+
+            if (header.value("type", "") == "csv") {
+                // CSV override → inject via CsvOverrides, columns filled while parsing
+                auto df = dataframe::JsonReader::parse(valueJsonStr, "value");
+                if (df) {
+                    mergedOverrides[identifier] = df;
                 }
             } else {
                 // Scalar override → set _value property on the node
-                if (valueJson.contains("value")) {
-                    nodes::Workload workload = parseInputValue(valueJson["value"]);
-                    graph.setProperty(nodeId, "_value", workload);
-                }
+                json valueJson = json::parse(valueJsonStr);
+                nodes::Workload workload = parseInputValue(valueJson["value"]);
+                setValue(nodeId, workload);
             }
         }
+
+        // DataFrame overrides uploaded as binary (Arrow IPC blobs)
+        for (auto& [identifier, df] : m_graphStorage->getParameterOverrideFrames(slug)) {
+            if (inputIdentifiers.count(identifier) || !identifierToNode.count(identifier)) continue;
+            mergedOverrides[identifier] = std::move(df);
+        }
     }
 
     // Execute the graph
     try {
         nodes::NodeExecutor executor(nodes::NodeRegistry::instance());
-        auto results = executor.execute(graph, mergedOverrides, userId);
+        auto options = requestExecutionOptions(m_executionOptions, request);
+        options.cancellation = makeCancellation(slug);
+        executor.setOptions(options);
+        auto results = executor.execute(compiled->plan, mergedOverrides, userId, overlay);
 
         // Check for node errors
         if (executor.hasErrors()) {
@@ -777,24 +1136,19 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
                 errorMsg += errors[i];
             }
             LOG_ERROR(errorMsg);
-            return json{{"status", "error"}, {"message", errorMsg}};
+            return EncodedJson::from(json{{"status", "error"}, {"message", errorMsg}});
         }
 
         // Create session and store DataFrames in RAM (cache)
         auto& sessionMgr = SessionManager::instance();
         std::string sessionId = sessionMgr.createSession();
 
-        // Convert results to JSON and store CSV outputs in session
-        json resultsJson = json::object();
+        // Store CSV outputs in session
         json csvMetadata = json::object();
         int nodeCount = static_cast<int>(results.size());
 
         for (const auto& [nodeId, outputs] : results) {
-            json nodeOutputs = json::object();
-
             for (const auto& [portName, workload] : outputs) {
-                nodeOutputs[portName] = nodes::NodeGraphSerializer::workloadToJson(workload);
-
                 // Store DataFrame in session if CSV type
                 if (workload.getType() == nodes::NodeType::Csv) {
                     auto df = workload.getCsv();
@@ -812,15 +1166,15 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
                     }
                 }
             }
-            resultsJson[nodeId] = nodeOutputs;
         }
 
         double duration = timer.stop();
         int durationMs = static_cast<int>(duration);
 
         // Persist execution to SQLite for cross-session access
+        json nodeResources = nodeResourcesJson(executor, results);
         int64_t executionId = m_graphStorage->saveExecution(
-            slug, sessionId, versionId, durationMs, nodeCount);
+            slug, sessionId, versionId, durationMs, nodeCount, nodeResources.dump());
 
         // Persist all DataFrames to SQLite
         for (const auto& [nodeId, outputs] : results) {
@@ -921,23 +1275,17 @@ json RequestHandler::handleExecuteGraph(const std::string& slug, const json& req
         // Cleanup old executions (keep only 10 most recent)
         m_graphStorage->cleanupOldExecutions(slug, 10);
 
-        return json{
-            {"status", "ok"},
-            {"session_id", sessionId},
-            {"execution_id", executionId},
-            {"results", resultsJson},
-            {"csv_metadata", csvMetadata},
-            {"duration_ms", durationMs}
-        };
+        return encodeExecutionResults(sessionId, executionId, results, csvMetadata, durationMs,
+                                      &nodeResources);
     } catch (const std::exception& e) {
         LOG_ERROR("Graph execution failed: " + std::string(e.what()));
-        return json{{"status", "error"}, {"message", std::string("Execution failed: ") + e.what()}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", std::string("Execution failed: ") + e.what()}});
     }
 }
 
-json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& request) {
+EncodedJson RequestHandler::handleExecuteDynamic(const std::string& slug, const json& request) {
     if (!m_graphStorage) {
-        return json{{"status", "error"}, {"message", "Graph storage not initialized"}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Graph storage not initialized"}});
     }
 
     ScopedTimer timer("executeDynamic");
@@ -945,9 +1293,9 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
     // Load the graph (working copy)
     nodes::NodeGraph graph;
     try {
-        graph = m_graphStorage->loadGraph(slug);
+        graph = m_graphStorage->loadCompiled(slug)->graph;
     } catch (const std::exception& e) {
-        return json{{"status", "error"}, {"message", std::string("Failed to load graph: ") + e.what()}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", std::string("Failed to load graph: ") + e.what()}});
     }
 
     // Parse and apply input overrides (same logic as handleExecuteGraph)
@@ -961,11 +1309,11 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
                 if (!identifier.empty()) {
                     auto existing = identifierToNode.find(identifier);
                     if (existing != identifierToNode.end()) {
-                        return json{
+                        return EncodedJson::from(json{
                             {"status", "error"},
                             {"error", "Duplicate identifier '" + identifier +
                                       "' in nodes " + existing->second.first + " and " + nodeId}
-                        };
+                        });
                     }
                     identifierToNode[identifier] = {nodeId, instance.definitionName};
                 }
@@ -975,10 +1323,10 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
         for (const auto& [identifier, value] : request["inputs"].items()) {
             auto it = identifierToNode.find(identifier);
             if (it == identifierToNode.end()) {
-                return json{
+                return EncodedJson::from(json{
                     {"status", "error"},
                     {"error", "Input identifier '" + identifier + "' not found in graph"}
-                };
+                });
             }
 
             const auto& [nodeId, nodeType] = it->second;
@@ -992,11 +1340,11 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
                     graph.setProperty(nodeId, "_value",
                         nodes::Workload(value.get<std::string>(), nodes::NodeType::String));
                 } else {
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"error", "string_as_fields identifier '" + identifier +
                                   "' expects a JSON array of field names"}
-                    };
+                    });
                 }
                 continue;
             }
@@ -1008,12 +1356,12 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
                 bool allowedConversion = (expectedType.value() == nodes::NodeType::Double
                                           && workload.getType() == nodes::NodeType::Int);
                 if (!allowedConversion) {
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"error", "Type mismatch for identifier '" + identifier +
                                   "': expected " + nodeTypeToErrorString(expectedType.value()) +
                                   ", got " + nodeTypeToErrorString(workload.getType())}
-                    };
+                    });
                 }
                 workload = nodes::Workload(static_cast<double>(workload.getInt()), nodes::NodeType::Double);
             }
@@ -1024,14 +1372,14 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
 
     // Validate request
     if (!request.contains("dynamic_nodes") || !request["dynamic_nodes"].is_array()) {
-        return json{{"status", "error"}, {"message", "Missing or invalid 'dynamic_nodes' array"}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Missing or invalid 'dynamic_nodes' array"}});
     }
 
     try {
         // For each dynamic_nodes entry
         for (const auto& dyn : request["dynamic_nodes"]) {
             if (!dyn.contains("_name") || !dyn.contains("params")) {
-                return json{{"status", "error"}, {"message", "Each dynamic_nodes entry requires '_name' and 'params'"}};
+                return EncodedJson::from(json{{"status", "error"}, {"message", "Each dynamic_nodes entry requires '_name' and 'params'"}});
             }
 
             std::string name = dyn["_name"].get<std::string>();
@@ -1054,10 +1402,10 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
             }
 
             if (beginId.empty()) {
-                return json{{"status", "error"}, {"message", "dynamic_begin with _name='" + name + "' not found"}};
+                return EncodedJson::from(json{{"status", "error"}, {"message", "dynamic_begin with _name='" + name + "' not found"}});
             }
             if (endId.empty()) {
-                return json{{"status", "error"}, {"message", "dynamic_end with _name='" + name + "' not found"}};
+                return EncodedJson::from(json{{"status", "error"}, {"message", "dynamic_end with _name='" + name + "' not found"}});
             }
 
             // Find the connection from begin to end (on "csv" ports)
@@ -1071,7 +1419,7 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
             }
 
             if (!conn) {
-                return json{{"status", "error"}, {"message", "No direct connection from dynamic_begin to dynamic_end for _name='" + name + "'"}};
+                return EncodedJson::from(json{{"status", "error"}, {"message", "No direct connection from dynamic_begin to dynamic_end for _name='" + name + "'"}});
             }
 
             // Disconnect the end node's csv input
@@ -1147,6 +1495,9 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
 
         // Execute the modified graph (same pattern as handleExecuteGraph)
         nodes::NodeExecutor executor(nodes::NodeRegistry::instance());
+        auto options = m_executionOptions;
+        options.cancellation = makeCancellation(slug);
+        executor.setOptions(options);
         auto results = executor.execute(graph);
 
         // Check for node errors
@@ -1158,24 +1509,19 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
                 errorMsg += errors[i];
             }
             LOG_ERROR(errorMsg);
-            return json{{"status", "error"}, {"message", errorMsg}};
+            return EncodedJson::from(json{{"status", "error"}, {"message", errorMsg}});
         }
 
         // Create session and store DataFrames
         auto& sessionMgr = SessionManager::instance();
         std::string sessionId = sessionMgr.createSession();
 
-        // Convert results to JSON and store CSV outputs
-        json resultsJson = json::object();
+        // Store CSV outputs in session
         json csvMetadata = json::object();
         int nodeCount = static_cast<int>(results.size());
 
         for (const auto& [nodeId, outputs] : results) {
-            json nodeOutputs = json::object();
-
             for (const auto& [portName, workload] : outputs) {
-                nodeOutputs[portName] = nodes::NodeGraphSerializer::workloadToJson(workload);
-
                 if (workload.getType() == nodes::NodeType::Csv) {
                     auto df = workload.getCsv();
                     if (df) {
@@ -1191,7 +1537,6 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
                     }
                 }
             }
-            resultsJson[nodeId] = nodeOutputs;
         }
 
         double duration = timer.stop();
@@ -1199,7 +1544,8 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
 
         // Persist execution to SQLite for cross-session access
         int64_t executionId = m_graphStorage->saveExecution(
-            slug, sessionId, std::nullopt, durationMs, nodeCount);
+            slug, sessionId, std::nullopt, durationMs, nodeCount,
+            nodeResourcesJson(executor, results).dump());
 
         // Persist all DataFrames to SQLite
         for (const auto& [nodeId, outputs] : results) {
@@ -1300,18 +1646,12 @@ json RequestHandler::handleExecuteDynamic(const std::string& slug, const json& r
         // Cleanup old executions (keep only 10 most recent)
         m_graphStorage->cleanupOldExecutions(slug, 10);
 
-        return json{
-            {"status", "ok"},
-            {"session_id", sessionId},
-            {"execution_id", executionId},
-            {"results", resultsJson},
-            {"csv_metadata", csvMetadata},
-            {"duration_ms", durationMs}
-        };
+        return encodeExecutionResults(sessionId, executionId, results, csvMetadata, durationMs,
+                                      nullptr);
 
     } catch (const std::exception& e) {
         LOG_ERROR("Dynamic execution failed: " + std::string(e.what()));
-        return json{{"status", "error"}, {"message", std::string("Dynamic execution failed: ") + e.what()}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", std::string("Dynamic execution failed: ") + e.what()}});
     }
 }
 
@@ -1636,10 +1976,11 @@ json RequestHandler::handleGetDynamicEquations(const std::string& slug) {
     };
 }
 
-json RequestHandler::handleSessionDataFrame(const std::string& sessionId,
-                                            const std::string& nodeId,
-                                            const std::string& portName,
-                                            const json& request) {
+EncodedJson RequestHandler::handleSessionDataFrame(const std::string& sessionId,
+                                                   const std::string& nodeId,
+                                                   const std::string& portName,
+                                                   const json& request,
+                                                   PageFormat format) {
     ScopedTimer queryTimer("handleSessionDataFrame");
 
     auto& sessionMgr = SessionManager::instance();
@@ -1660,11 +2001,11 @@ json RequestHandler::handleSessionDataFrame(const std::string& sessionId,
     }
 
     if (!df) {
-        return json{
+        return EncodedJson::from(json{
             {"status", "error"},
             {"message", "DataFrame not found for session=" + sessionId +
                         ", node=" + nodeId + ", port=" + portName}
-        };
+        });
     }
 
     auto result = df;
@@ -1680,16 +2021,16 @@ json RequestHandler::handleSessionDataFrame(const std::string& sessionId,
             try {
                 result = executeOperation(result, opType, params);
                 if (!result) {
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"message", "Operation '" + opType + "' returned null"}
-                    };
+                    });
                 }
             } catch (const std::exception& e) {
-                return json{
+                return EncodedJson::from(json{
                     {"status", "error"},
                     {"message", "Operation '" + opType + "' failed: " + e.what()}
-                };
+                });
             }
         }
     }
@@ -1704,35 +2045,30 @@ json RequestHandler::handleSessionDataFrame(const std::string& sessionId,
     size_t startRow = std::min(offset, totalRows);
     size_t endRow = std::min(offset + limit, totalRows);
 
-    json data = json::array();
-    for (size_t i = startRow; i < endRow; ++i) {
-        json row = json::array();
-        for (const auto& colName : columns) {
-            auto col = result->getColumn(colName);
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                row.push_back(intCol->at(i));
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                row.push_back(doubleCol->at(i));
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                row.push_back(stringCol->at(i));
-            }
-        }
-        data.push_back(row);
-    }
-
     double duration = queryTimer.stop();
 
-    return json{
-        {"status", "ok"},
-        {"stats", {
-            {"total_rows", totalRows},
-            {"offset", startRow},
-            {"returned_rows", data.size()},
-            {"duration_ms", static_cast<int>(duration)}
-        }},
-        {"columns", columns},
-        {"data", data}
-    };
+    if (format == PageFormat::Arrow) {
+        ArrowIpc::Metadata metadata = {
+            {"total_rows", std::to_string(totalRows)},
+            {"offset", std::to_string(startRow)},
+            {"returned_rows", std::to_string(endRow - startRow)},
+            {"duration_ms", std::to_string(static_cast<int>(duration))}
+        };
+        return {true, ArrowIpc::write(*result, columns, startRow, endRow, metadata), ArrowIpc::MIME_TYPE};
+    }
+
+    JsonWriter out;
+    out.beginObject();
+    out.key("status").value("ok");
+    out.key("stats").beginObject()
+        .key("total_rows").value(totalRows)
+        .key("offset").value(startRow)
+        .key("returned_rows").value(endRow - startRow)
+        .key("duration_ms").value(static_cast<int>(duration))
+        .endObject();
+    writePage(out, *result, columns, startRow, endRow);
+    out.endObject();
+    return {true, out.take()};
 }
 
 json RequestHandler::handleListExecutions(const std::string& slug) {
@@ -1806,7 +2142,9 @@ json RequestHandler::handleGetExecution(int64_t executionId) {
             {"node_count", execution->nodeCount},
             {"dataframe_count", execution->dataframeCount}
         }},
-        {"csv_metadata", csvMetadata}
+        {"csv_metadata", csvMetadata},
+        {"node_resources", execution->nodeResourcesJson.empty()
+            ? json::object() : json::parse(execution->nodeResourcesJson)}
     };
 }
 
@@ -1865,6 +2203,80 @@ json RequestHandler::handleRestoreExecution(int64_t executionId) {
     };
 }
 
+std::shared_ptr<CancellationToken> RequestHandler::makeCancellation(const std::string& slug) {
+    std::chrono::milliseconds timeout = m_executionTimeout;
+    if (m_graphStorage) {
+        auto metadata = m_graphStorage->getGraph(slug);
+        if (metadata && metadata->executionTimeoutMs > 0) {
+            timeout = std::chrono::milliseconds(metadata->executionTimeoutMs);
+        }
+    }
+
+    auto token = std::make_shared<CancellationToken>();
+    if (timeout.count() > 0) {
+        token->setDeadline(CancellationToken::Clock::now() + timeout);
+    }
+    return token;
+}
+
+void RequestHandler::registerExecution(const std::string& sessionId,
+                                       const std::shared_ptr<CancellationToken>& token) {
+    std::lock_guard<std::mutex> lock(m_runningExecutionsMutex);
+    m_runningExecutions[sessionId] = token;
+}
+
+void RequestHandler::unregisterExecution(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock(m_runningExecutionsMutex);
+    m_runningExecutions.erase(sessionId);
+}
+
+void RequestHandler::startExecutionWorker(std::function<void()> work) {
+    {
+        std::lock_guard<std::mutex> lock(m_runningExecutionsMutex);
+        ++m_executionWorkers;
+    }
+    std::thread([this, work = std::move(work)]() mutable {
+        try {
+            work();
+        } catch (const std::exception& e) {
+            LOG_ERROR(std::string("Execution worker failed: ") + e.what());
+        }
+        // Captures (session, graphe) libérées avant de signaler la fin
+        work = nullptr;
+        std::lock_guard<std::mutex> lock(m_runningExecutionsMutex);
+        --m_executionWorkers;
+        m_executionWorkersDone.notify_all();
+    }).detach();
+}
+
+void RequestHandler::stopExecutionWorkers() {
+    std::unique_lock<std::mutex> lock(m_runningExecutionsMutex);
+    for (const auto& [sessionId, execution] : m_runningExecutions) {
+        if (auto token = execution.lock()) {
+            token->cancel();
+        }
+    }
+    m_executionWorkersDone.wait(lock, [this]() { return m_executionWorkers == 0; });
+}
+
+json RequestHandler::handleCancelExecution(const std::string& sessionId) {
+    std::shared_ptr<CancellationToken> token;
+    {
+        std::lock_guard<std::mutex> lock(m_runningExecutionsMutex);
+        auto it = m_runningExecutions.find(sessionId);
+        if (it != m_runningExecutions.end()) {
+            token = it->second.lock();
+        }
+    }
+    if (!token) {
+        return json{{"status", "error"}, {"message", "No running execution for session: " + sessionId}};
+    }
+
+    token->cancel();
+    LOG_INFO("Cancelled execution of session " + sessionId);
+    return json{{"status", "ok"}, {"session_id", sessionId}};
+}
+
 json RequestHandler::handleListOutputs(const std::string& slug) {
     if (!m_graphStorage) {
         return json{{"status", "error"}, {"message", "Graph storage not initialized"}};
@@ -1901,27 +2313,28 @@ json RequestHandler::handleListOutputs(const std::string& slug) {
     };
 }
 
-json RequestHandler::handleGetOutput(const std::string& slug, const std::string& name, const json& request) {
+EncodedJson RequestHandler::handleGetOutput(const std::string& slug, const std::string& name, const json& request,
+                                            PageFormat format) {
     ScopedTimer queryTimer("handleGetOutput");
 
     if (!m_graphStorage) {
-        return json{{"status", "error"}, {"message", "Graph storage not initialized"}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Graph storage not initialized"}});
     }
 
     if (!m_graphStorage->graphExists(slug)) {
-        return json{{"status", "error"}, {"message", "Graph not found: " + slug}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Graph not found: " + slug}});
     }
 
     // Get metadata first
     auto info = m_graphStorage->getNamedOutputInfo(slug, name);
     if (!info) {
-        return json{{"status", "error"}, {"message", "Output not found: " + name}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Output not found: " + name}});
     }
 
     // Load the DataFrame
     auto df = m_graphStorage->loadNamedOutput(slug, name);
     if (!df) {
-        return json{{"status", "error"}, {"message", "Failed to load output: " + name}};
+        return EncodedJson::from(json{{"status", "error"}, {"message", "Failed to load output: " + name}});
     }
 
     auto result = df;
@@ -1937,16 +2350,16 @@ json RequestHandler::handleGetOutput(const std::string& slug, const std::string&
             try {
                 result = executeOperation(result, opType, params);
                 if (!result) {
-                    return json{
+                    return EncodedJson::from(json{
                         {"status", "error"},
                         {"message", "Operation '" + opType + "' returned null"}
-                    };
+                    });
                 }
             } catch (const std::exception& e) {
-                return json{
+                return EncodedJson::from(json{
                     {"status", "error"},
                     {"message", "Operation '" + opType + "' failed: " + e.what()}
-                };
+                });
             }
         }
     }
@@ -1961,41 +2374,40 @@ json RequestHandler::handleGetOutput(const std::string& slug, const std::string&
     size_t startRow = std::min(offset, totalRows);
     size_t endRow = std::min(offset + limit, totalRows);
 
-    json data = json::array();
-    for (size_t i = startRow; i < endRow; ++i) {
-        json row = json::array();
-        for (const auto& colName : columns) {
-            auto col = result->getColumn(colName);
-            if (auto intCol = std::dynamic_pointer_cast<IntColumn>(col)) {
-                row.push_back(intCol->at(i));
-            } else if (auto doubleCol = std::dynamic_pointer_cast<DoubleColumn>(col)) {
-                row.push_back(doubleCol->at(i));
-            } else if (auto stringCol = std::dynamic_pointer_cast<StringColumn>(col)) {
-                row.push_back(stringCol->at(i));
-            }
-        }
-        data.push_back(row);
-    }
-
     double duration = queryTimer.stop();
 
-    return json{
-        {"status", "ok"},
-        {"output", {
+    if (format == PageFormat::Arrow) {
+        ArrowIpc::Metadata metadata = {
             {"name", info->name},
             {"node_id", info->nodeId},
-            {"execution_id", info->executionId},
-            {"created_at", info->createdAt}
-        }},
-        {"stats", {
-            {"total_rows", totalRows},
-            {"offset", startRow},
-            {"returned_rows", data.size()},
-            {"duration_ms", static_cast<int>(duration)}
-        }},
-        {"columns", columns},
-        {"data", data}
-    };
+            {"execution_id", std::to_string(info->executionId)},
+            {"created_at", info->createdAt},
+            {"total_rows", std::to_string(totalRows)},
+            {"offset", std::to_string(startRow)},
+            {"returned_rows", std::to_string(endRow - startRow)},
+            {"duration_ms", std::to_string(static_cast<int>(duration))}
+        };
+        return {true, ArrowIpc::write(*result, columns, startRow, endRow, metadata), ArrowIpc::MIME_TYPE};
+    }
+
+    JsonWriter out;
+    out.beginObject();
+    out.key("status").value("ok");
+    out.key("output").beginObject()
+        .key("name").value(info->name)
+        .key("node_id").value(info->nodeId)
+        .key("execution_id").value(info->executionId)
+        .key("created_at").value(info->createdAt)
+        .endObject();
+    out.key("stats").beginObject()
+        .key("total_rows").value(totalRows)
+        .key("offset").value(startRow)
+        .key("returned_rows").value(endRow - startRow)
+        .key("duration_ms").value(static_cast<int>(duration))
+        .endObject();
+    writePage(out, *result, columns, startRow, endRow);
+    out.endObject();
+    return {true, out.take()};
 }
 
 // =============================================================================
@@ -2045,6 +2457,119 @@ json RequestHandler::handleDeleteParameter(const std::string& slug, const std::s
     }
 }
 
+// =============================================================================
+// Input Uploads (raw CSV / .adf / Arrow bodies for csv_source nodes)
+// =============================================================================
+
+json RequestHandler::handleUploadInput(const std::string& slug, const std::string& identifier,
+                                       const std::string& filePath, UploadFormat format, bool persist,
+                                       const std::string& userId) {
+    if (!m_graphStorage) {
+        return json{{"status", "error"}, {"message", "Graph storage not initialized"}};
+    }
+    if (!m_graphStorage->graphExists(slug)) {
+        return json{{"status", "error"}, {"message", "Graph not found: " + slug}};
+    }
+    try {
+        auto compiled = m_graphStorage->loadCompiled(slug);
+        if (!compiled->identifiers.count(identifier)) {
+            return json{{"status", "error"},
+                        {"message", "Input identifier '" + identifier + "' not found in graph"}};
+        }
+    } catch (const std::exception& e) {
+        return json{{"status", "error"}, {"message", std::string("Failed to load graph: ") + e.what()}};
+    }
+
+    ScopedTimer timer("uploadInput");
+
+    std::shared_ptr<DataFrame> df;
+    std::string uploadId;
+    try {
+        if (format == UploadFormat::Binary) {
+            // .adf commence par "ANODEDF", un flux Arrow par 0xFFFFFFFF
+            char magic[7] = {};
+            std::ifstream(filePath, std::ios::binary).read(magic, sizeof(magic));
+            format = std::string_view(magic, sizeof(magic)) == "ANODEDF" ? UploadFormat::Columnar
+                                                                         : UploadFormat::Arrow;
+        }
+        switch (format) {
+            case UploadFormat::Csv:      df = DataFrameIO::readCSV(filePath); break;
+            case UploadFormat::Columnar: df = DataFrameIO::readColumnar(filePath); break;
+            default:                     df = DataFrameIO::readArrow(filePath); break;
+        }
+    } catch (const std::exception& e) {
+        return json{{"status", "error"}, {"message", std::string("Invalid upload: ") + e.what()}};
+    }
+
+    if (persist) {
+        try {
+            m_graphStorage->setParameterOverrideFrame(slug, identifier, *df);
+        } catch (const std::exception& e) {
+            return json{{"status", "error"}, {"message", e.what()}};
+        }
+    } else {
+        size_t bytes = df->memoryUsage();
+        std::lock_guard<std::mutex> lock(m_pendingInputsMutex);
+        prunePendingInputs();
+        if (m_pendingInputBytes + bytes > PENDING_INPUT_MAX_BYTES) {
+            return json{{"status", "error"},
+                        {"message", "Too many pending uploads; execute or delete them first"}};
+        }
+        uploadId = makeUploadId();
+        m_pendingInputs[uploadId] = PendingInput{
+            slug, identifier, userId, df, bytes,
+            std::chrono::steady_clock::now() + PENDING_INPUT_TTL};
+        m_pendingInputBytes += bytes;
+    }
+
+    json columns = json::array();
+    for (const auto& name : df->getColumnNames()) {
+        columns.push_back({{"name", name}, {"type", columnTypeName(df->getColumn(name)->getType())}});
+    }
+    double duration = timer.stop();
+    LOG_INFO("Input uploaded for " + slug + "/" + identifier + ": " + std::to_string(df->rowCount()) +
+             " rows in " + std::to_string(static_cast<int>(duration)) + "ms");
+
+    json result{
+        {"status", "ok"},
+        {"identifier", identifier},
+        {"target", persist ? "parameter" : "execution"},
+        {"rows", df->rowCount()},
+        {"columns", columns},
+        {"duration_ms", duration}
+    };
+    if (!persist) {
+        result["upload_id"] = uploadId;
+        result["expires_in_s"] = std::chrono::seconds(PENDING_INPUT_TTL).count();
+    }
+    return result;
+}
+
+json RequestHandler::handleDeleteInput(const std::string& slug, const std::string& uploadId,
+                                       const std::string& userId) {
+    std::lock_guard<std::mutex> lock(m_pendingInputsMutex);
+    prunePendingInputs();
+    auto it = m_pendingInputs.find(uploadId);
+    if (it == m_pendingInputs.end() || it->second.slug != slug || it->second.userId != userId) {
+        return json{{"status", "error"}, {"message", "No pending input: " + uploadId}};
+    }
+    m_pendingInputBytes -= it->second.bytes;
+    m_pendingInputs.erase(it);
+    return json{{"status", "ok"}};
+}
+
+void RequestHandler::prunePendingInputs() {
+    auto now = std::chrono::steady_clock::now();
+    for (auto it = m_pendingInputs.begin(); it != m_pendingInputs.end();) {
+        if (it->second.expiresAt <= now) {
+            m_pendingInputBytes -= it->second.bytes;
+            it = m_pendingInputs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 // =============================================================================
 // Plugin Route Extension
 // =============================================================================
@@ -2268,8 +2793,7 @@ json RequestHandler::handleRunScenario(const std::string& slug, int64_t scenario
         // 2. Build CsvOverrides from scenario triggers
         nodes::CsvOverrides csvOverrides;
         for (const auto& trig : details.triggers) {
-            json dfJson = json::parse(trig.dataJson);
-            auto df = dataframe::DataFrameSerializer::fromJson(dfJson);
+            auto df = dataframe::JsonReader::parse(trig.dataJson);
             if (df) {
                 csvOverrides[trig.identifier] = df;
             }
@@ -2281,7 +2805,7 @@ json RequestHandler::handleRunScenario(const std::string& slug, int64_t scenario
             execRequest["inputs"] = inputsObj;
         }
 
-        json execResult = handleExecuteGraph(slug, execRequest, csvOverrides);
+        json execResult = json::parse(handleExecuteGraph(slug, execRequest, csvOverrides).body);
         if (execResult.value("status", "") != "ok") {
             m_graphStorage->updateScenarioRunStatus(scenarioId, "fail");
             return json{
@@ -2309,8 +2833,7 @@ json RequestHandler::handleRunScenario(const std::string& slug, int64_t scenario
             }
 
             // Parse expected DataFrame
-            json expectedDfJson = json::parse(expected.expectedJson);
-            auto expectedDf = dataframe::DataFrameSerializer::fromJson(expectedDfJson);
+            auto expectedDf = dataframe::JsonReader::parse(expected.expectedJson);
             if (!expectedDf) {
                 outputResult["match"] = false;
                 outputResult["error"] = "Failed to parse expected data";
@@ -2362,46 +2885,41 @@ json RequestHandler::handleRunScenario(const std::string& slug, int64_t scenario
                 auto expectedCol = expectedDf->getColumn(colName);
                 if (!actualCol || !expectedCol) continue;
 
-                for (size_t row = 0; row < maxRows && mismatchCount < maxMismatches; ++row) {
-                    bool match = false;
-
-                    auto actInt = std::dynamic_pointer_cast<IntColumn>(actualCol);
-                    auto expInt = std::dynamic_pointer_cast<IntColumn>(expectedCol);
-                    auto actDbl = std::dynamic_pointer_cast<DoubleColumn>(actualCol);
-                    auto expDbl = std::dynamic_pointer_cast<DoubleColumn>(expectedCol);
-                    auto actStr = std::dynamic_pointer_cast<StringColumn>(actualCol);
-                    auto expStr = std::dynamic_pointer_cast<StringColumn>(expectedCol);
-
-                    if (actInt && expInt) {
-                        match = (actInt->at(row) == expInt->at(row));
-                    } else if (actDbl && expDbl) {
-                        match = (std::abs(actDbl->at(row) - expDbl->at(row)) < 1e-9);
-                    } else if (actStr && expStr) {
-                        match = (actStr->at(row) == expStr->at(row));
-                    } else {
-                        // Type mismatch between columns
-                        match = false;
-                    }
-
-                    if (!match) {
-                        json mismatch = {
-                            {"type", "cell"},
-                            {"row", row},
-                            {"column", colName}
-                        };
-                        // Add values to mismatch
-                        if (expInt) mismatch["expected"] = expInt->at(row);
-                        else if (expDbl) mismatch["expected"] = expDbl->at(row);
-                        else if (expStr) mismatch["expected"] = expStr->at(row);
-
-                        if (actInt) mismatch["actual"] = actInt->at(row);
-                        else if (actDbl) mismatch["actual"] = actDbl->at(row);
-                        else if (actStr) mismatch["actual"] = actStr->at(row);
+                auto addMismatch = [&](size_t row) {
+                    mismatches.push_back({
+                        {"type", "cell"},
+                        {"row", row},
+                        {"column", colName},
+                        {"expected", visitColumn(*expectedCol, [row](const auto& typed) { return json(typed.at(row)); })},
+                        {"actual", visitColumn(*actualCol, [row](const auto& typed) { return json(typed.at(row)); })}
+                    });
+                    mismatchCount++;
+                };
 
-                        mismatches.push_back(mismatch);
-                        mismatchCount++;
+                if (actualCol->getType() != expectedCol->getType()) {
+                    // Type mismatch between columns: every compared cell differs
+                    for (size_t row = 0; row < maxRows && mismatchCount < maxMismatches; ++row) {
+                        addMismatch(row);
                     }
+                    continue;
                 }
+
+                // Same type: one typed comparison loop per column
+                visitColumn(*expectedCol, [&](const auto& expected) {
+                    using Col = ColumnT<decltype(expected)>;
+                    const auto& actual = static_cast<const Col&>(*actualCol);
+                    for (size_t row = 0; row < maxRows && mismatchCount < maxMismatches; ++row) {
+                        bool match;
+                        if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                            match = std::abs(actual.at(row) - expected.at(row)) < 1e-9;
+                        } else {
+                            match = actual.at(row) == expected.at(row);
+                        }
+                        if (!match) {
+                            addMismatch(row);
+                        }
+                    }
+                });
             }
 
             bool outputMatch = mismatches.empty();
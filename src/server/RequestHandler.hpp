@@ -1,11 +1,17 @@
 #pragma once
 
+#include "dataframe/Cancellation.hpp"
+#include "dataframe/CsvReader.hpp"
 #include "dataframe/DataFrame.hpp"
+#include "dataframe/DataFrameIndex.hpp"
 #include "storage/GraphStorage.hpp"
+#include "storage/SnapshotStore.hpp"
 #include <nlohmann/json.hpp>
+#include <condition_variable>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <chrono>
@@ -19,6 +25,33 @@ using json = nlohmann::json;
 /// Route handler result: {HTTP status code, JSON body}
 using RouteResult = std::pair<unsigned, json>;
 
+/// Pre-encoded JSON body: DataFrame pages are written by JsonWriter
+/// straight from the columns, without building a DOM first.
+/// Pages negotiated as Arrow carry an Arrow IPC stream instead.
+struct EncodedJson {
+    bool ok = false;      // "status" == "ok"
+    std::string body;
+    std::string contentType = "application/json";
+
+    static EncodedJson from(const json& j) {
+        return {j.value("status", "") == "ok", j.dump()};
+    }
+};
+
+/// DataFrame page encoding, negotiated from the Accept header
+enum class PageFormat {
+    Json,
+    Arrow   // application/vnd.apache.arrow.stream (see ArrowIpc)
+};
+
+/// Encoding of a DataFrame uploaded as a raw request body (see handleUploadInput)
+enum class UploadFormat {
+    Csv,       // text/csv
+    Columnar,  // application/vnd.anode.dataframe (see ColumnarFile)
+    Arrow,     // application/vnd.apache.arrow.stream (see ArrowIpc)
+    Binary     // application/octet-stream: .adf or Arrow, detected from the magic bytes
+};
+
 /// Per-request context built during validation, available to route handlers.
 struct RequestContext {
     std::string userId;   // Resolved from sessionid cookie, empty if unknown
@@ -37,6 +70,16 @@ using RequestValidator = std::function<
                                const std::map<std::string, std::string>& cookies,
                                RequestContext& ctx)>;
 
+/// Plugin cache persisted in the snapshot directory (see SnapshotStore).
+/// fingerprint() identifies the source version (e.g. max(updated_at) of the
+/// tables it mirrors): a snapshot is restored only if it still matches.
+struct SnapshotCache {
+    std::string name;
+    std::function<std::string()> fingerprint;
+    std::function<storage::SnapshotStore::Frames()> save;
+    std::function<void(const storage::SnapshotStore::Frames&)> restore;
+};
+
 /**
  * Gestionnaire de requêtes - traite la logique métier
  */
@@ -44,10 +87,51 @@ class RequestHandler {
 public:
     static RequestHandler& instance();
 
-    // Initialisation avec le dataset
-    void loadDataset(const std::string& csvPath);
+    // Initialisation avec le dataset (CSV, ou .adf : voir ColumnarFile)
+    // sortedBy: ordre du fichier source (vérifié puis déclaré, voir DataFrame::declareSortedBy)
+    // schema: types de colonnes imposés (les autres sont inférés)
+    void loadDataset(const std::string& csvPath, const SortOrder& sortedBy = {},
+                     const CsvReader::Schema& schema = {});
     bool isLoaded() const { return m_dataset != nullptr; }
 
+    // Index secondaires du dataset (opt-in) : index construits au chargement,
+    // les autres paresseusement à la première requête qui en a besoin.
+    // Recréés à chaque loadDataset.
+    void enableDatasetIndex(const DataFrameIndex::Spec& eager = {});
+
+    // Snapshots binaires du dataset et des caches plugins (--snapshot-dir) :
+    // loadDataset restaure le snapshot si le CSV source n'a pas changé
+    void enableSnapshots(const std::string& directory);
+    bool hasSnapshots() const { return m_snapshots != nullptr; }
+    json saveSnapshots();   // Entrées périmées uniquement, résumé JSON
+
+    // Plugin snapshot extension: restores the cache now if its snapshot is
+    // up to date (returns true, the plugin can skip its own load)
+    bool registerSnapshotCache(SnapshotCache cache);
+
+    // Options des NodeExecutor créés pour les exécutions de graphes
+    // (--executor-threads : exécution parallèle des branches indépendantes)
+    void setExecutionOptions(const nodes::ExecutionOptions& options) { m_executionOptions = options; }
+    const nodes::ExecutionOptions& executionOptions() const { return m_executionOptions; }
+
+    // Délai maximal des exécutions (--execution-timeout, 0 : aucun), remplacé
+    // par execution_timeout_ms du graphe s'il est défini
+    void setExecutionTimeout(std::chrono::milliseconds timeout) { m_executionTimeout = timeout; }
+
+    // Jeton d'annulation d'une exécution du graphe, échéance posée
+    std::shared_ptr<CancellationToken> makeCancellation(const std::string& slug);
+
+    // Exécutions en cours annulables par POST /api/session/:id/cancel
+    void registerExecution(const std::string& sessionId, const std::shared_ptr<CancellationToken>& token);
+    void unregisterExecution(const std::string& sessionId);
+
+    // Exécutions en flux (SSE) sur un thread dédié : le thread IO reste libre
+    // pour servir POST /api/session/:id/cancel pendant l'exécution.
+    // stopExecutionWorkers (arrêt du serveur) annule les exécutions en cours
+    // et attend la fin des workers.
+    void startExecutionWorker(std::function<void()> work);
+    void stopExecutionWorkers();
+
     // Initialisation du stockage de graphes
     void initGraphStorage(const std::string& dbPath);
     bool hasGraphStorage() const { return m_graphStorage != nullptr; }
@@ -56,7 +140,7 @@ public:
     // Handlers pour les endpoints dataset
     json handleHealth();
     json handleDatasetInfo();
-    json handleQuery(const json& request);
+    EncodedJson handleQuery(const json& request);
 
     // Handlers pour les endpoints nodes
     json handleListNodes();
@@ -68,27 +152,39 @@ public:
     json handleCreateGraph(const json& request);
     json handleUpdateGraph(const std::string& slug, const json& request);
     json handleDeleteGraph(const std::string& slug);
-    json handleExecuteGraph(const std::string& slug, const json& request,
-                            const nodes::CsvOverrides& csvOverrides = {},
-                            const std::string& userId = "");
-    json handleExecuteDynamic(const std::string& slug, const json& request);
+    EncodedJson handleExecuteGraph(const std::string& slug, const json& request,
+                                   const nodes::CsvOverrides& csvOverrides = {},
+                                   const std::string& userId = "");
+    EncodedJson handleExecuteDynamic(const std::string& slug, const json& request);
     json handleApplyDynamic(const std::string& slug, const json& request);
     json handleGetDynamicEquations(const std::string& slug);
 
     // Handler pour les endpoints session (DataFrame visualization)
-    json handleSessionDataFrame(const std::string& sessionId,
-                                const std::string& nodeId,
-                                const std::string& portName,
-                                const json& request);
+    EncodedJson handleSessionDataFrame(const std::string& sessionId,
+                                       const std::string& nodeId,
+                                       const std::string& portName,
+                                       const json& request,
+                                       PageFormat format = PageFormat::Json);
 
     // Handlers pour les endpoints execution (persistence)
     json handleListExecutions(const std::string& slug);
     json handleGetExecution(int64_t executionId);
     json handleRestoreExecution(int64_t executionId);
+    json handleCancelExecution(const std::string& sessionId);
 
     // Handlers pour les endpoints outputs (named outputs)
     json handleListOutputs(const std::string& slug);
-    json handleGetOutput(const std::string& slug, const std::string& name, const json& request);
+    EncodedJson handleGetOutput(const std::string& slug, const std::string& name, const json& request,
+                                PageFormat format = PageFormat::Json);
+
+    // Upload d'un DataFrame pour un csv_source (_identifier), reçu en streaming
+    // dans filePath : persisté comme parameter override (persist), sinon gardé
+    // sous un upload_id que l'exécution doit citer ("uploads")
+    json handleUploadInput(const std::string& slug, const std::string& identifier,
+                           const std::string& filePath, UploadFormat format, bool persist,
+                           const std::string& userId = "");
+    json handleDeleteInput(const std::string& slug, const std::string& uploadId,
+                           const std::string& userId = "");
 
     // Handlers pour les endpoints parameter overrides (viewer parameters)
     json handleGetParameters(const std::string& slug);
@@ -135,8 +231,46 @@ private:
     std::string m_datasetPath;
     size_t m_originalRows = 0;
 
+    // Index secondaires sur m_dataset (nullptr si désactivés)
+    void rebuildDatasetIndex();
+    bool m_datasetIndexEnabled = false;
+    DataFrameIndex::Spec m_datasetIndexSpec;
+    std::unique_ptr<DataFrameIndex> m_datasetIndex;
+
     // Stockage de graphes
     std::unique_ptr<storage::GraphStorage> m_graphStorage;
+    nodes::ExecutionOptions m_executionOptions;
+    std::chrono::milliseconds m_executionTimeout{0};
+
+    // Exécutions en cours : sessionId -> jeton d'annulation
+    std::map<std::string, std::weak_ptr<CancellationToken>> m_runningExecutions;
+    std::mutex m_runningExecutionsMutex;
+    size_t m_executionWorkers = 0;                 // Protégé par m_runningExecutionsMutex
+    std::condition_variable m_executionWorkersDone;
+
+    // DataFrames uploadés en attente d'une exécution qui les cite (upload_id -> upload),
+    // expirés après PENDING_INPUT_TTL, bornés à PENDING_INPUT_MAX_BYTES au total
+    struct PendingInput {
+        std::string slug;
+        std::string identifier;
+        std::string userId;
+        std::shared_ptr<DataFrame> frame;
+        size_t bytes = 0;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+    static constexpr std::chrono::minutes PENDING_INPUT_TTL{15};
+    static constexpr size_t PENDING_INPUT_MAX_BYTES = size_t(2) << 30;  // 2 GB
+    void prunePendingInputs();  // m_pendingInputsMutex tenu
+    std::map<std::string, PendingInput> m_pendingInputs;
+    size_t m_pendingInputBytes = 0;
+    std::mutex m_pendingInputsMutex;
+
+    // Snapshots (nullptr si désactivés) ; empreinte du dataset chargé,
+    // vide s'il ne provient pas d'un CSV
+    std::unique_ptr<storage::SnapshotStore> m_snapshots;
+    std::string m_datasetFingerprint;
+    std::vector<SnapshotCache> m_snapshotCaches;
+    std::shared_ptr<DataFrame> restoreDatasetSnapshot();
 
     // Plugin route handlers
     std::vector<RouteHandler> m_pluginRouteHandlers;
@@ -0,0 +1,128 @@
+#include "storage/CompiledGraphCache.hpp"
+#include "nodes/NodeGraphSerializer.hpp"
+#include "nodes/NodeRegistry.hpp"
+
+namespace storage {
+
+CompiledGraphPtr CompiledGraph::compile(const GraphVersion& version) {
+    auto compiled = std::make_shared<CompiledGraph>();
+    compiled->slug = version.graphSlug;
+    compiled->versionId = version.id;
+    compiled->graph = nodes::NodeGraphSerializer::fromString(version.graphJson);
+    compiled->plan = nodes::ExecutionPlan::compile(compiled->graph, nodes::NodeRegistry::instance());
+
+    for (const auto& planNode : compiled->plan->nodes()) {
+        if (planNode.identifier.empty()) continue;
+        auto [it, inserted] = compiled->identifiers.try_emplace(
+            planNode.identifier, planNode.id, planNode.definitionName);
+        if (!inserted && compiled->duplicateIdentifierError.empty()) {
+            compiled->duplicateIdentifierError = "Duplicate identifier '" + planNode.identifier +
+                "' in nodes " + it->second.first + " and " + planNode.id;
+        }
+    }
+    return compiled;
+}
+
+void CompiledGraphCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+size_t CompiledGraphCache::capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+size_t CompiledGraphCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+CompiledGraphPtr CompiledGraphCache::get(int64_t versionId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(versionId);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return *it->second;
+}
+
+std::optional<int64_t> CompiledGraphCache::latestVersion(const std::string& slug) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_latest.find(slug);
+    if (it == m_latest.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void CompiledGraphCache::put(CompiledGraphPtr compiled, bool latest) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_capacity == 0) {
+        return;
+    }
+    if (latest) {
+        m_latest[compiled->slug] = compiled->versionId;
+    }
+
+    auto it = m_entries.find(compiled->versionId);
+    if (it != m_entries.end()) {
+        m_lru.erase(it->second);
+    }
+    m_lru.push_front(compiled);
+    m_entries[compiled->versionId] = m_lru.begin();
+    evict();
+}
+
+void CompiledGraphCache::invalidateLatest(const std::string& slug) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_latest.erase(slug);
+}
+
+void CompiledGraphCache::invalidateVersion(int64_t versionId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(versionId);
+    if (it != m_entries.end()) {
+        // The slug's latest version may now be an older one
+        m_latest.erase((*it->second)->slug);
+        m_lru.erase(it->second);
+        m_entries.erase(it);
+    }
+    for (auto latest = m_latest.begin(); latest != m_latest.end();) {
+        latest = latest->second == versionId ? m_latest.erase(latest) : std::next(latest);
+    }
+}
+
+void CompiledGraphCache::invalidateGraph(const std::string& slug) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_latest.erase(slug);
+    for (auto it = m_lru.begin(); it != m_lru.end();) {
+        if ((*it)->slug == slug) {
+            m_entries.erase((*it)->versionId);
+            it = m_lru.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void CompiledGraphCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lru.clear();
+    m_entries.clear();
+    m_latest.clear();
+}
+
+void CompiledGraphCache::evict() {
+    while (m_entries.size() > m_capacity) {
+        m_entries.erase(m_lru.back()->versionId);
+        m_lru.pop_back();
+    }
+    if (m_capacity == 0) {
+        m_latest.clear();
+    }
+}
+
+} // namespace storage
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "storage/GraphMetadata.hpp"
+#include "nodes/NodeExecutor.hpp"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace storage {
+
+/**
+ * A graph version parsed and compiled once, shared by every execution
+ * of that version. Immutable: executions apply their input overrides
+ * through a nodes::PropertyOverlay instead of modifying the graph.
+ */
+struct CompiledGraph {
+    std::string slug;
+    int64_t versionId = 0;
+    nodes::NodeGraph graph;
+    nodes::ExecutionPlanPtr plan;
+
+    /// _identifier -> (nodeId, definition name)
+    std::unordered_map<std::string, std::pair<std::string, std::string>> identifiers;
+
+    /// Set if two nodes share an _identifier (the first one is kept above)
+    std::string duplicateIdentifierError;
+
+    /**
+     * Parse a stored version and compile its plan
+     * @throws std::runtime_error on invalid JSON or a cycle in the graph
+     */
+    static std::shared_ptr<const CompiledGraph> compile(const GraphVersion& version);
+};
+
+using CompiledGraphPtr = std::shared_ptr<const CompiledGraph>;
+
+/**
+ * LRU cache of compiled graph versions
+ *
+ * Entries are keyed by version id (versions are immutable, so an entry
+ * never goes stale); the latest version id of each slug is remembered
+ * separately and must be invalidated when a version is saved.
+ * Thread-safe.
+ */
+class CompiledGraphCache {
+public:
+    explicit CompiledGraphCache(size_t capacity = 64) : m_capacity(capacity) {}
+
+    /**
+     * Maximum number of versions kept (0 disables the cache)
+     */
+    void setCapacity(size_t capacity);
+    size_t capacity() const;
+    size_t size() const;
+
+    /**
+     * Cached version, marked as most recently used (nullptr if absent)
+     */
+    CompiledGraphPtr get(int64_t versionId);
+
+    /**
+     * Latest version id of a slug, if known
+     */
+    std::optional<int64_t> latestVersion(const std::string& slug) const;
+
+    /**
+     * Insert a version; latest: it is the slug's latest version
+     */
+    void put(CompiledGraphPtr compiled, bool latest);
+
+    void invalidateLatest(const std::string& slug);
+    void invalidateVersion(int64_t versionId);
+    void invalidateGraph(const std::string& slug);
+    void clear();
+
+private:
+    void evict();
+
+    size_t m_capacity;
+    std::list<CompiledGraphPtr> m_lru;  // Most recently used first
+    std::unordered_map<int64_t, std::list<CompiledGraphPtr>::iterator> m_entries;
+    std::unordered_map<std::string, int64_t> m_latest;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace storage
@@ -18,6 +18,7 @@ struct GraphMetadata {
     std::vector<std::string> tags;       // Optional tags for categorization
     std::string createdAt;               // ISO 8601 timestamp
     std::string updatedAt;               // ISO 8601 timestamp
+    int64_t executionTimeoutMs = 0;      // Execution deadline, 0 for the server default
 };
 
 /**
@@ -51,6 +52,7 @@ struct ExecutionMetadata {
     int durationMs;                      // Execution duration in milliseconds
     int nodeCount;                       // Number of nodes in the graph
     int dataframeCount;                  // Number of DataFrames stored
+    std::string nodeResourcesJson;       // JSON nodeId -> resources (see nodes::NodeResources), getExecution only
 };
 
 /**
@@ -1,12 +1,16 @@
 #include "storage/GraphStorage.hpp"
 #include "nodes/NodeGraphSerializer.hpp"
+#include "dataframe/ArrowIpc.hpp"
 #include "dataframe/DataFrameSerializer.hpp"
+#include "dataframe/JsonReader.hpp"
+#include "dataframe/JsonWriter.hpp"
 #include <sqlite3.h>
 #include <nlohmann/json.hpp>
 #include <stdexcept>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <string_view>
 
 namespace storage {
 
@@ -91,6 +95,10 @@ public:
         sqlite3_bind_null(m_stmt, index);
     }
 
+    void bindBlob(int index, const std::string& value) {
+        sqlite3_bind_blob64(m_stmt, index, value.data(), value.size(), SQLITE_STATIC);
+    }
+
     bool step() {
         int result = sqlite3_step(m_stmt);
         if (result == SQLITE_ROW) return true;
@@ -104,6 +112,20 @@ public:
         return text ? text : "";
     }
 
+    // No copy; valid until the next step() or reset()
+    std::string_view getTextView(int col) {
+        const char* text = reinterpret_cast<const char*>(sqlite3_column_text(m_stmt, col));
+        if (!text) return {};
+        return {text, static_cast<size_t>(sqlite3_column_bytes(m_stmt, col))};
+    }
+
+    // No copy; valid until the next step() or reset()
+    std::string_view getBlobView(int col) {
+        const char* data = static_cast<const char*>(sqlite3_column_blob(m_stmt, col));
+        if (!data) return {};
+        return {data, static_cast<size_t>(sqlite3_column_bytes(m_stmt, col))};
+    }
+
     int64_t getInt64(int col) {
         return sqlite3_column_int64(m_stmt, col);
     }
@@ -166,10 +188,18 @@ public:
                 author TEXT,
                 tags TEXT,
                 created_at TEXT NOT NULL,
-                updated_at TEXT NOT NULL
+                updated_at TEXT NOT NULL,
+                execution_timeout_ms INTEGER DEFAULT 0
             )
         )");
 
+        // Add execution_timeout_ms column if it doesn't exist (migration for existing DBs)
+        try {
+            exec("ALTER TABLE graphs ADD COLUMN execution_timeout_ms INTEGER DEFAULT 0");
+        } catch (...) {
+            // Ignore error if column already exists
+        }
+
         exec(R"(
             CREATE TABLE IF NOT EXISTS graph_versions (
                 id INTEGER PRIMARY KEY AUTOINCREMENT,
@@ -194,6 +224,7 @@ public:
                 created_at TEXT NOT NULL,
                 duration_ms INTEGER,
                 node_count INTEGER DEFAULT 0,
+                node_resources_json TEXT,
                 FOREIGN KEY (graph_slug) REFERENCES graphs(slug) ON DELETE CASCADE,
                 FOREIGN KEY (version_id) REFERENCES graph_versions(id) ON DELETE SET NULL
             )
@@ -217,6 +248,13 @@ public:
             )
         )");
 
+        // Add node_resources_json column if it doesn't exist (migration for existing DBs)
+        try {
+            exec("ALTER TABLE graph_executions ADD COLUMN node_resources_json TEXT");
+        } catch (...) {
+            // Ignore error if column already exists
+        }
+
         // Add output_name column if it doesn't exist (migration for existing DBs)
         try {
             exec("ALTER TABLE execution_dataframes ADD COLUMN output_name TEXT");
@@ -304,6 +342,13 @@ public:
                 UNIQUE(graph_slug, identifier)
             )
         )");
+
+        // Add value_blob column if it doesn't exist (DataFrame overrides, Arrow IPC)
+        try {
+            exec("ALTER TABLE parameter_overrides ADD COLUMN value_blob BLOB");
+        } catch (...) {
+            // Ignore error if column already exists
+        }
         exec("CREATE INDEX IF NOT EXISTS idx_param_overrides_slug ON parameter_overrides(graph_slug)");
 
         // Graph links (auto-detected event navigation)
@@ -324,8 +369,8 @@ public:
 
     void createGraph(const GraphMetadata& metadata) {
         Statement stmt(m_db,
-            "INSERT INTO graphs (slug, name, description, author, tags, created_at, updated_at) "
-            "VALUES (?, ?, ?, ?, ?, ?, ?)");
+            "INSERT INTO graphs (slug, name, description, author, tags, created_at, updated_at, "
+            "execution_timeout_ms) VALUES (?, ?, ?, ?, ?, ?, ?, ?)");
 
         std::string now = currentTimestamp();
 
@@ -336,21 +381,23 @@ public:
         stmt.bindText(5, tagsToJson(metadata.tags));
         stmt.bindText(6, now);
         stmt.bindText(7, now);
+        stmt.bindInt64(8, metadata.executionTimeoutMs);
 
         stmt.step();
     }
 
     void updateGraph(const GraphMetadata& metadata) {
         Statement stmt(m_db,
-            "UPDATE graphs SET name = ?, description = ?, author = ?, tags = ?, updated_at = ? "
-            "WHERE slug = ?");
+            "UPDATE graphs SET name = ?, description = ?, author = ?, tags = ?, updated_at = ?, "
+            "execution_timeout_ms = ? WHERE slug = ?");
 
         stmt.bindText(1, metadata.name);
         stmt.bindText(2, metadata.description);
         stmt.bindText(3, metadata.author);
         stmt.bindText(4, tagsToJson(metadata.tags));
         stmt.bindText(5, currentTimestamp());
-        stmt.bindText(6, metadata.slug);
+        stmt.bindInt64(6, metadata.executionTimeoutMs);
+        stmt.bindText(7, metadata.slug);
 
         stmt.step();
 
@@ -367,8 +414,8 @@ public:
 
     std::optional<GraphMetadata> getGraph(const std::string& slug) {
         Statement stmt(m_db,
-            "SELECT slug, name, description, author, tags, created_at, updated_at "
-            "FROM graphs WHERE slug = ?");
+            "SELECT slug, name, description, author, tags, created_at, updated_at, "
+            "execution_timeout_ms FROM graphs WHERE slug = ?");
 
         stmt.bindText(1, slug);
 
@@ -383,14 +430,15 @@ public:
             .author = stmt.getText(3),
             .tags = jsonToTags(stmt.getText(4)),
             .createdAt = stmt.getText(5),
-            .updatedAt = stmt.getText(6)
+            .updatedAt = stmt.getText(6),
+            .executionTimeoutMs = stmt.isNull(7) ? 0 : stmt.getInt64(7)
         };
     }
 
     std::vector<GraphMetadata> listGraphs() {
         Statement stmt(m_db,
-            "SELECT slug, name, description, author, tags, created_at, updated_at "
-            "FROM graphs ORDER BY updated_at DESC");
+            "SELECT slug, name, description, author, tags, created_at, updated_at, "
+            "execution_timeout_ms FROM graphs ORDER BY updated_at DESC");
 
         std::vector<GraphMetadata> result;
         while (stmt.step()) {
@@ -401,7 +449,8 @@ public:
                 .author = stmt.getText(3),
                 .tags = jsonToTags(stmt.getText(4)),
                 .createdAt = stmt.getText(5),
-                .updatedAt = stmt.getText(6)
+                .updatedAt = stmt.getText(6),
+                .executionTimeoutMs = stmt.isNull(7) ? 0 : stmt.getInt64(7)
             });
         }
         return result;
@@ -472,7 +521,7 @@ public:
         Statement stmt(m_db,
             "SELECT id, graph_slug, version_name, graph_json, created_at "
             "FROM graph_versions WHERE graph_slug = ? "
-            "ORDER BY created_at DESC LIMIT 1");
+            "ORDER BY created_at DESC, id DESC LIMIT 1");
 
         stmt.bindText(1, slug);
 
@@ -493,7 +542,7 @@ public:
         Statement stmt(m_db,
             "SELECT id, graph_slug, version_name, graph_json, created_at "
             "FROM graph_versions WHERE graph_slug = ? "
-            "ORDER BY created_at DESC");
+            "ORDER BY created_at DESC, id DESC");
 
         stmt.bindText(1, slug);
 
@@ -540,10 +589,11 @@ public:
                           const std::string& sessionId,
                           std::optional<int64_t> versionId,
                           int durationMs,
-                          int nodeCount) {
+                          int nodeCount,
+                          const std::string& nodeResourcesJson) {
         Statement stmt(m_db,
-            "INSERT INTO graph_executions (graph_slug, version_id, session_id, created_at, duration_ms, node_count) "
-            "VALUES (?, ?, ?, ?, ?, ?)");
+            "INSERT INTO graph_executions (graph_slug, version_id, session_id, created_at, duration_ms, node_count, "
+            "node_resources_json) VALUES (?, ?, ?, ?, ?, ?, ?)");
 
         stmt.bindText(1, slug);
         if (versionId) {
@@ -555,6 +605,11 @@ public:
         stmt.bindText(4, currentTimestamp());
         stmt.bindInt64(5, durationMs);
         stmt.bindInt64(6, nodeCount);
+        if (nodeResourcesJson.empty()) {
+            stmt.bindNull(7);
+        } else {
+            stmt.bindText(7, nodeResourcesJson);
+        }
 
         stmt.step();
         return sqlite3_last_insert_rowid(m_db);
@@ -569,13 +624,13 @@ public:
                                 const std::string& metadataJson = "") {
         if (!df) return;
 
-        // Serialize DataFrame with schema
+        // Serialize DataFrame with schema; data rows are encoded straight
+        // from the typed columns (no intermediate DOM)
         auto columnGetter = [&df](const std::string& name) { return df->getColumn(name); };
-        json serialized = dataframe::DataFrameSerializer::toJsonWithSchema(
-            df->rowCount(),
-            df->getColumnNames(),
-            columnGetter
-        );
+        auto columnNames = df->getColumnNames();
+        json schema = dataframe::DataFrameSerializer::schemaToJson(columnNames, columnGetter);
+        dataframe::JsonWriter data;
+        data.rows(0, df->rowCount(), columnNames, columnGetter);
 
         Statement stmt(m_db,
             "INSERT OR REPLACE INTO execution_dataframes "
@@ -586,9 +641,9 @@ public:
         stmt.bindText(2, nodeId);
         stmt.bindText(3, portName);
         stmt.bindInt64(4, static_cast<int64_t>(df->rowCount()));
-        stmt.bindText(5, serialized["columns"].dump());
-        stmt.bindText(6, serialized["schema"].dump());
-        stmt.bindText(7, serialized["data"].dump());
+        stmt.bindText(5, json(columnNames).dump());
+        stmt.bindText(6, schema.dump());
+        stmt.bindText(7, data.str());
         if (outputName.empty()) {
             stmt.bindNull(8);
         } else {
@@ -623,13 +678,8 @@ public:
             return nullptr;
         }
 
-        // Reconstruct JSON and deserialize
-        json j;
-        j["columns"] = json::parse(stmt.getText(0));
-        j["schema"] = json::parse(stmt.getText(1));
-        j["data"] = json::parse(stmt.getText(2));
-
-        return dataframe::DataFrameSerializer::fromJson(j);
+        // Data rows are parsed straight into typed columns (no DOM)
+        return dataframe::JsonReader::parse(stmt.getTextView(0), stmt.getTextView(1), stmt.getTextView(2));
     }
 
     std::map<std::string, std::map<std::string, dataframe::DataFramePtr>>
@@ -646,12 +696,8 @@ public:
             std::string nodeId = stmt.getText(0);
             std::string portName = stmt.getText(1);
 
-            json j;
-            j["columns"] = json::parse(stmt.getText(2));
-            j["schema"] = json::parse(stmt.getText(3));
-            j["data"] = json::parse(stmt.getText(4));
-
-            result[nodeId][portName] = dataframe::DataFrameSerializer::fromJson(j);
+            result[nodeId][portName] =
+                dataframe::JsonReader::parse(stmt.getTextView(2), stmt.getTextView(3), stmt.getTextView(4));
         }
 
         return result;
@@ -677,7 +723,8 @@ public:
                 .createdAt = stmt.getText(4),
                 .durationMs = static_cast<int>(stmt.getInt64(5)),
                 .nodeCount = static_cast<int>(stmt.getInt64(6)),
-                .dataframeCount = static_cast<int>(stmt.getInt64(7))
+                .dataframeCount = static_cast<int>(stmt.getInt64(7)),
+                .nodeResourcesJson = ""  // Only loaded by getExecution
             });
         }
         return result;
@@ -704,14 +751,16 @@ public:
             .createdAt = stmt.getText(4),
             .durationMs = static_cast<int>(stmt.getInt64(5)),
             .nodeCount = static_cast<int>(stmt.getInt64(6)),
-            .dataframeCount = static_cast<int>(stmt.getInt64(7))
+            .dataframeCount = static_cast<int>(stmt.getInt64(7)),
+            .nodeResourcesJson = ""  // Only loaded by getExecution
         };
     }
 
     std::optional<ExecutionMetadata> getExecution(int64_t executionId) {
         Statement stmt(m_db,
             "SELECT e.id, e.graph_slug, e.version_id, e.session_id, e.created_at, e.duration_ms, e.node_count, "
-            "       (SELECT COUNT(*) FROM execution_dataframes WHERE execution_id = e.id) as df_count "
+            "       (SELECT COUNT(*) FROM execution_dataframes WHERE execution_id = e.id) as df_count, "
+            "       e.node_resources_json "
             "FROM graph_executions e "
             "WHERE e.id = ?");
 
@@ -729,7 +778,8 @@ public:
             .createdAt = stmt.getText(4),
             .durationMs = static_cast<int>(stmt.getInt64(5)),
             .nodeCount = static_cast<int>(stmt.getInt64(6)),
-            .dataframeCount = static_cast<int>(stmt.getInt64(7))
+            .dataframeCount = static_cast<int>(stmt.getInt64(7)),
+            .nodeResourcesJson = stmt.isNull(8) ? "" : stmt.getText(8)
         };
     }
 
@@ -862,13 +912,8 @@ public:
             return nullptr;
         }
 
-        // Reconstruct JSON and deserialize
-        json j;
-        j["columns"] = json::parse(stmt.getText(0));
-        j["schema"] = json::parse(stmt.getText(1));
-        j["data"] = json::parse(stmt.getText(2));
-
-        return dataframe::DataFrameSerializer::fromJson(j);
+        // Data rows are parsed straight into typed columns (no DOM)
+        return dataframe::JsonReader::parse(stmt.getTextView(0), stmt.getTextView(1), stmt.getTextView(2));
     }
 
     // Get metadata for a named output
@@ -1137,6 +1182,39 @@ public:
         stmt.step();
     }
 
+    void setParameterOverrideFrame(const std::string& slug, const std::string& identifier,
+                                   const dataframe::DataFrame& df) {
+        json columns = json::array();
+        for (const auto& name : df.getColumnNames()) {
+            columns.push_back(name);
+        }
+        json header = {{"type", "csv"}, {"encoding", "arrow"}, {"rows", df.rowCount()}, {"columns", columns}};
+        std::string blob = dataframe::ArrowIpc::write(df);
+
+        Statement stmt(m_db,
+            "INSERT OR REPLACE INTO parameter_overrides (graph_slug, identifier, value_json, value_blob, updated_at) "
+            "VALUES (?, ?, ?, ?, ?)");
+        stmt.bindText(1, slug);
+        stmt.bindText(2, identifier);
+        stmt.bindText(3, header.dump());
+        stmt.bindBlob(4, blob);
+        stmt.bindText(5, currentTimestamp());
+        stmt.step();
+    }
+
+    std::map<std::string, dataframe::DataFramePtr> getParameterOverrideFrames(const std::string& slug) {
+        Statement stmt(m_db,
+            "SELECT identifier, value_blob FROM parameter_overrides "
+            "WHERE graph_slug = ? AND value_blob IS NOT NULL");
+        stmt.bindText(1, slug);
+
+        std::map<std::string, dataframe::DataFramePtr> result;
+        while (stmt.step()) {
+            result[stmt.getText(0)] = dataframe::ArrowIpc::read(stmt.getBlobView(1));
+        }
+        return result;
+    }
+
     void deleteParameterOverride(const std::string& slug, const std::string& identifier) {
         Statement stmt(m_db,
             "DELETE FROM parameter_overrides WHERE graph_slug = ? AND identifier = ?");
@@ -1203,7 +1281,8 @@ private:
 // =============================================================================
 
 GraphStorage::GraphStorage(const std::string& dbPath)
-    : m_impl(std::make_unique<Impl>(dbPath)) {}
+    : m_impl(std::make_unique<Impl>(dbPath)),
+      m_compiledCache(std::make_unique<CompiledGraphCache>()) {}
 
 GraphStorage::~GraphStorage() = default;
 
@@ -1220,6 +1299,7 @@ void GraphStorage::updateGraph(const GraphMetadata& metadata) {
 
 void GraphStorage::deleteGraph(const std::string& slug) {
     m_impl->deleteGraph(slug);
+    m_compiledCache->invalidateGraph(slug);
 }
 
 std::optional<GraphMetadata> GraphStorage::getGraph(const std::string& slug) {
@@ -1237,7 +1317,9 @@ bool GraphStorage::graphExists(const std::string& slug) {
 int64_t GraphStorage::saveVersion(const std::string& slug,
                                    const nodes::NodeGraph& graph,
                                    const std::optional<std::string>& versionName) {
-    return m_impl->saveVersion(slug, graph, versionName);
+    int64_t versionId = m_impl->saveVersion(slug, graph, versionName);
+    m_compiledCache->invalidateLatest(slug);
+    return versionId;
 }
 
 std::optional<GraphVersion> GraphStorage::getVersion(int64_t versionId) {
@@ -1254,6 +1336,7 @@ std::vector<GraphVersion> GraphStorage::listVersions(const std::string& slug) {
 
 void GraphStorage::deleteVersion(int64_t versionId) {
     m_impl->deleteVersion(versionId);
+    m_compiledCache->invalidateVersion(versionId);
 }
 
 nodes::NodeGraph GraphStorage::loadGraph(const std::string& slug) {
@@ -1264,6 +1347,31 @@ nodes::NodeGraph GraphStorage::loadVersion(int64_t versionId) {
     return m_impl->loadVersion(versionId);
 }
 
+CompiledGraphPtr GraphStorage::loadCompiled(const std::string& slug, std::optional<int64_t> versionId) {
+    bool latest = !versionId.has_value();
+    if (latest) {
+        versionId = m_compiledCache->latestVersion(slug);
+    }
+    if (versionId) {
+        if (auto cached = m_compiledCache->get(*versionId)) {
+            return cached;
+        }
+    }
+
+    auto version = versionId ? m_impl->getVersion(*versionId) : m_impl->getLatestVersion(slug);
+    if (!version) {
+        throw std::runtime_error(versionId ? "Version not found: " + std::to_string(*versionId)
+                                           : "No version found for graph: " + slug);
+    }
+    auto compiled = CompiledGraph::compile(*version);
+    m_compiledCache->put(compiled, latest);
+    return compiled;
+}
+
+void GraphStorage::setCompiledCacheCapacity(size_t capacity) {
+    m_compiledCache->setCapacity(capacity);
+}
+
 const std::string& GraphStorage::getDbPath() const {
     return m_impl->getDbPath();
 }
@@ -1274,8 +1382,9 @@ int64_t GraphStorage::saveExecution(const std::string& slug,
                                      const std::string& sessionId,
                                      std::optional<int64_t> versionId,
                                      int durationMs,
-                                     int nodeCount) {
-    return m_impl->saveExecution(slug, sessionId, versionId, durationMs, nodeCount);
+                                     int nodeCount,
+                                     const std::string& nodeResourcesJson) {
+    return m_impl->saveExecution(slug, sessionId, versionId, durationMs, nodeCount, nodeResourcesJson);
 }
 
 void GraphStorage::saveExecutionDataFrame(int64_t executionId,
@@ -1398,6 +1507,15 @@ void GraphStorage::setParameterOverride(const std::string& slug, const std::stri
     m_impl->setParameterOverride(slug, identifier, valueJson);
 }
 
+void GraphStorage::setParameterOverrideFrame(const std::string& slug, const std::string& identifier,
+                                             const dataframe::DataFrame& df) {
+    m_impl->setParameterOverrideFrame(slug, identifier, df);
+}
+
+std::map<std::string, dataframe::DataFramePtr> GraphStorage::getParameterOverrideFrames(const std::string& slug) {
+    return m_impl->getParameterOverrideFrames(slug);
+}
+
 void GraphStorage::deleteParameterOverride(const std::string& slug, const std::string& identifier) {
     m_impl->deleteParameterOverride(slug, identifier);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage/GraphMetadata.hpp"
+#include "storage/CompiledGraphCache.hpp"
 #include "nodes/NodeExecutor.hpp"
 #include "dataframe/DataFrame.hpp"
 #include <string>
@@ -118,6 +119,21 @@ public:
      */
     nodes::NodeGraph loadVersion(int64_t versionId);
 
+    /**
+     * Parsed graph, execution plan and identifier index of a version
+     * (latest if versionId is nullopt), served from an in-process LRU
+     * cache. Entries are shared and immutable: copy the graph to modify it.
+     * saveVersion, deleteVersion and deleteGraph invalidate the cache.
+     * Throws if the graph or version doesn't exist, or if the graph has a cycle
+     */
+    CompiledGraphPtr loadCompiled(const std::string& slug,
+                                  std::optional<int64_t> versionId = std::nullopt);
+
+    /**
+     * Number of compiled versions kept in memory (default 64, 0 disables)
+     */
+    void setCompiledCacheCapacity(size_t capacity);
+
     /**
      * Get the database file path
      */
@@ -133,7 +149,8 @@ public:
                           const std::string& sessionId,
                           std::optional<int64_t> versionId,
                           int durationMs,
-                          int nodeCount = 0);
+                          int nodeCount = 0,
+                          const std::string& nodeResourcesJson = "");
 
     /**
      * Save a DataFrame result from an execution
@@ -235,6 +252,19 @@ public:
      */
     void setParameterOverride(const std::string& slug, const std::string& identifier, const std::string& valueJson);
 
+    /**
+     * Set a DataFrame parameter override (csv_source input), stored as an
+     * Arrow IPC blob; value_json only describes it (type, rows, columns)
+     */
+    void setParameterOverrideFrame(const std::string& slug, const std::string& identifier,
+                                   const dataframe::DataFrame& df);
+
+    /**
+     * Get the DataFrame parameter overrides of a graph
+     * Returns map of identifier -> DataFrame
+     */
+    std::map<std::string, dataframe::DataFramePtr> getParameterOverrideFrames(const std::string& slug);
+
     /**
      * Delete a single parameter override
      */
@@ -264,6 +294,7 @@ public:
 private:
     class Impl;
     std::unique_ptr<Impl> m_impl;
+    std::unique_ptr<CompiledGraphCache> m_compiledCache;
 };
 
 } // namespace storage
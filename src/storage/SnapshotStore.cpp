@@ -0,0 +1,285 @@
+#include "storage/SnapshotStore.hpp"
+#include "dataframe/ColumnarFile.hpp"
+#include <nlohmann/json.hpp>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace storage {
+
+namespace {
+
+constexpr int MANIFEST_VERSION = 1;
+constexpr const char* MANIFEST = "manifest.json";
+
+json readManifest(const std::string& directory) {
+    std::ifstream file(fs::path(directory) / MANIFEST);
+    if (!file) {
+        return json{{"version", MANIFEST_VERSION}, {"next_generation", 1}, {"entries", json::object()}};
+    }
+    json manifest;
+    try {
+        manifest = json::parse(file);
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Invalid snapshot manifest in " + directory + ": " + e.what());
+    }
+    if (manifest.value("version", 0) != MANIFEST_VERSION) {
+        throw std::runtime_error("Unsupported snapshot manifest version in " + directory);
+    }
+    return manifest;
+}
+
+void writeManifest(const std::string& directory, const json& manifest) {
+    fs::path path = fs::path(directory) / MANIFEST;
+    fs::path tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        file << manifest.dump(2);
+        if (!file.flush()) {
+            throw std::runtime_error("Cannot write snapshot manifest: " + tmpPath.string());
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::error_code ec;
+        fs::remove(tmpPath, ec);
+        throw std::runtime_error("Cannot replace snapshot manifest: " + path.string());
+    }
+}
+
+// Entry names become file name prefixes
+std::string filePrefix(const std::string& entry) {
+    std::string prefix;
+    for (char c : entry) {
+        bool safe = std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+        prefix += safe ? c : '_';
+    }
+    return prefix.empty() ? "entry" : prefix;
+}
+
+std::string currentTimestamp() {
+    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm tm{};
+    gmtime_r(&now, &tm);
+    std::ostringstream ss;
+    ss << std::put_time(&tm, "%Y-%m-%dT%H:%M:%SZ");
+    return ss.str();
+}
+
+// Frames of a manifest entry (empty object if none)
+json framesOf(const json& entry) {
+    return entry.value("frames", json::object());
+}
+
+// Sections of a manifest entry (empty object if none)
+json sectionsOf(const json& entry) {
+    return entry.value("sections", json::object());
+}
+
+// Files of a manifest entry: frames then sections
+std::vector<std::string> filesOf(const json& entry) {
+    std::vector<std::string> files;
+    json frames = framesOf(entry);
+    for (const auto& [name, frame] : frames.items()) {
+        files.push_back(frame.value("file", ""));
+    }
+    json sections = sectionsOf(entry);
+    for (const auto& [name, section] : sections.items()) {
+        files.push_back(section.value("file", ""));
+    }
+    return files;
+}
+
+void removeFiles(const std::string& directory, const json& entry) {
+    for (const auto& file : filesOf(entry)) {
+        std::error_code ec;
+        fs::remove(fs::path(directory) / file, ec);
+    }
+}
+
+} // namespace
+
+SnapshotStore::SnapshotStore(const std::string& directory) : m_directory(directory) {
+    fs::create_directories(m_directory);
+
+    // Files left behind by an interrupted save are not in the manifest
+    json manifest = readManifest(m_directory);
+    std::set<std::string> referenced;
+    for (const auto& [name, entry] : manifest["entries"].items()) {
+        for (const auto& file : filesOf(entry)) {
+            referenced.insert(file);
+        }
+    }
+    for (const auto& file : fs::directory_iterator(m_directory)) {
+        std::string fileName = file.path().filename().string();
+        bool snapshotFile = fileName.ends_with(".adf") || fileName.ends_with(".bin");
+        bool orphan = (snapshotFile && !referenced.contains(fileName)) || fileName.ends_with(".tmp");
+        if (file.is_regular_file() && orphan) {
+            std::error_code ec;
+            fs::remove(file.path(), ec);
+        }
+    }
+}
+
+void SnapshotStore::save(const std::string& entry, const std::string& fingerprint, const Frames& frames,
+                         const Sections& sections) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json manifest = readManifest(m_directory);
+    uint64_t generation = manifest.value("next_generation", uint64_t{1});
+    std::string prefix = filePrefix(entry) + "." + std::to_string(generation) + ".";
+
+    json savedFrames = json::object();
+    json savedSections = json::object();
+    size_t index = 0;
+    try {
+        for (const auto& [name, df] : frames) {
+            if (!df) {
+                throw std::invalid_argument("Snapshot frame '" + name + "' is null");
+            }
+            std::string fileName = prefix + std::to_string(index++) + ".adf";
+            dataframe::ColumnarFile::write(*df, (fs::path(m_directory) / fileName).string(), {});
+            savedFrames[name] = {{"file", fileName}, {"rows", df->rowCount()}};
+        }
+        for (const auto& [name, writer] : sections) {
+            std::string fileName = prefix + filePrefix(name) + ".bin";
+            fs::path path = fs::path(m_directory) / fileName;
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            savedSections[name] = {{"file", fileName}};
+            writer(file);
+            if (!file.flush()) {
+                throw std::runtime_error("Cannot write snapshot section: " + path.string());
+            }
+        }
+    } catch (...) {
+        removeFiles(m_directory, json{{"frames", savedFrames}, {"sections", savedSections}});
+        throw;
+    }
+
+    json previous = manifest["entries"].value(entry, json::object());
+    manifest["next_generation"] = generation + 1;
+    manifest["entries"][entry] = {
+        {"fingerprint", fingerprint},
+        {"generation", generation},
+        {"created_at", currentTimestamp()},
+        {"frames", savedFrames},
+        {"sections", savedSections}
+    };
+    writeManifest(m_directory, manifest);
+
+    removeFiles(m_directory, previous);
+}
+
+std::optional<SnapshotStore::Frames> SnapshotStore::load(const std::string& entry,
+                                                         const std::string& fingerprint) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json manifest = readManifest(m_directory);
+    if (!manifest["entries"].contains(entry)) {
+        return std::nullopt;
+    }
+    const json& saved = manifest["entries"][entry];
+    if (saved.value("fingerprint", "") != fingerprint) {
+        return std::nullopt;
+    }
+
+    Frames frames;
+    json savedFrames = framesOf(saved);
+    for (const auto& [name, frame] : savedFrames.items()) {
+        std::string path = (fs::path(m_directory) / frame.value("file", "")).string();
+        frames[name] = dataframe::ColumnarFile::read(path, {});
+    }
+    return frames;
+}
+
+bool SnapshotStore::loadSection(const std::string& entry, const std::string& fingerprint,
+                                const std::string& section,
+                                const std::function<void(std::istream&)>& reader) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json manifest = readManifest(m_directory);
+    if (!manifest["entries"].contains(entry)) {
+        return false;
+    }
+    const json& saved = manifest["entries"][entry];
+    json sections = sectionsOf(saved);
+    if (saved.value("fingerprint", "") != fingerprint || !sections.contains(section)) {
+        return false;
+    }
+
+    fs::path path = fs::path(m_directory) / sections[section].value("file", "");
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot read snapshot section: " + path.string());
+    }
+    reader(file);
+    return true;
+}
+
+std::optional<std::string> SnapshotStore::fingerprint(const std::string& entry) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json manifest = readManifest(m_directory);
+    if (!manifest["entries"].contains(entry)) {
+        return std::nullopt;
+    }
+    return manifest["entries"][entry].value("fingerprint", "");
+}
+
+void SnapshotStore::remove(const std::string& entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json manifest = readManifest(m_directory);
+    if (!manifest["entries"].contains(entry)) {
+        return;
+    }
+    json previous = manifest["entries"][entry];
+    manifest["entries"].erase(entry);
+    writeManifest(m_directory, manifest);
+    removeFiles(m_directory, previous);
+}
+
+std::vector<SnapshotStore::EntryInfo> SnapshotStore::list() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<EntryInfo> entries;
+    json manifest = readManifest(m_directory);
+    for (const auto& [name, saved] : manifest["entries"].items()) {
+        EntryInfo info;
+        info.name = name;
+        info.fingerprint = saved.value("fingerprint", "");
+        info.createdAt = saved.value("created_at", "");
+        info.generation = saved.value("generation", uint64_t{0});
+        json frames = framesOf(saved);
+        for (const auto& [frameName, frame] : frames.items()) {
+            info.frameCount++;
+            info.rowCount += frame.value("rows", size_t{0});
+        }
+        entries.push_back(std::move(info));
+    }
+    return entries;
+}
+
+std::string SnapshotStore::fileFingerprint(const std::string& path) {
+    std::error_code ec;
+    fs::path canonical = fs::canonical(path, ec);
+    if (ec) {
+        throw std::runtime_error("Cannot fingerprint " + path + ": " + ec.message());
+    }
+    auto size = fs::file_size(canonical);
+    auto mtime = fs::last_write_time(canonical).time_since_epoch();
+    return canonical.string() + ":" + std::to_string(size) + ":" +
+           std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(mtime).count());
+}
+
+} // namespace storage
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "dataframe/DataFrame.hpp"
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace storage {
+
+/**
+ * Binary snapshots of in-memory DataFrames for fast server restarts
+ *
+ * A snapshot directory holds one .adf file per frame (see
+ * dataframe::ColumnarFile, copied into memory on load) and a
+ * manifest.json listing the entries:
+ *
+ *   { "version": 1,
+ *     "entries": { "dataset": { "fingerprint": "...", "generation": 3,
+ *                               "created_at": "...",
+ *                               "frames": { "main": { "file": "dataset.3.0.adf",
+ *                                                     "rows": 1200 } },
+ *                               "sections": { "index": { "file": "dataset.3.index.bin" } } } } }
+ *
+ * Sections are opaque binary files saved with an entry (e.g. the dataset
+ * indexes): they share its fingerprint and generation, and their writers
+ * and readers own the format and its version.
+ *
+ * An entry is only restored when its fingerprint matches the fingerprint
+ * the caller computes from the current source (file size and mtime, a
+ * database version, ...), so a stale snapshot is never served.
+ *
+ * Saving writes the new generation's files, swaps the manifest atomically
+ * (temporary file + rename), then removes the previous generation: a crash
+ * in the middle of a save leaves the previous snapshot intact.
+ *
+ * Usage:
+ *   SnapshotStore store("./snapshots");
+ *   store.save("dataset", fingerprint, {{"main", df}});
+ *   if (auto frames = store.load("dataset", fingerprint)) df = frames->at("main");
+ */
+class SnapshotStore {
+public:
+    using Frames = std::map<std::string, dataframe::DataFramePtr>;
+    using Sections = std::map<std::string, std::function<void(std::ostream&)>>;
+
+    struct EntryInfo {
+        std::string name;
+        std::string fingerprint;
+        std::string createdAt;
+        uint64_t generation = 0;
+        size_t frameCount = 0;
+        size_t rowCount = 0;
+    };
+
+    /**
+     * Open a snapshot directory, creating it if missing
+     */
+    explicit SnapshotStore(const std::string& directory);
+
+    const std::string& directory() const { return m_directory; }
+
+    /**
+     * Persist frames under an entry, replacing its previous generation
+     * @throws std::runtime_error if a file cannot be written
+     */
+    void save(const std::string& entry, const std::string& fingerprint, const Frames& frames,
+              const Sections& sections = {});
+
+    /**
+     * Restore an entry
+     * @return nullopt if the entry is missing or its fingerprint differs
+     * @throws std::runtime_error if a frame file is missing or corrupted
+     */
+    std::optional<Frames> load(const std::string& entry, const std::string& fingerprint) const;
+
+    /**
+     * Read a section saved with an entry
+     * @return false if the entry is missing, its fingerprint differs or it has no such section
+     * @throws std::runtime_error if the section file is missing; reader exceptions propagate
+     */
+    bool loadSection(const std::string& entry, const std::string& fingerprint, const std::string& section,
+                     const std::function<void(std::istream&)>& reader) const;
+
+    /**
+     * Fingerprint stored for an entry (nullopt if no snapshot)
+     */
+    std::optional<std::string> fingerprint(const std::string& entry) const;
+
+    /**
+     * Delete an entry and its files
+     */
+    void remove(const std::string& entry);
+
+    std::vector<EntryInfo> list() const;
+
+    /**
+     * Fingerprint of a source file: canonical path, size and mtime
+     * @throws std::runtime_error if the file does not exist
+     */
+    static std::string fileFingerprint(const std::string& path);
+
+private:
+    std::string m_directory;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace storage
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/ArrowIpc.hpp"
+#include <cstdint>
+#include <string>
+
+using namespace dataframe;
+
+namespace {
+
+// pyarrow.ipc.new_stream : n int64 [7, null, 2^40], s large_string ["a", null, "bc"]
+const uint8_t PYARROW_STREAM[] = {
+    0xff, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x0c, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xd8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x14, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x08, 0x00, 0x06, 0x00,
+    0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x16, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x6c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00
+};
+
+std::string cell(const DataFrame& df, const std::string& column, size_t row) {
+    auto col = std::dynamic_pointer_cast<StringColumn>(df.getColumn(column));
+    return col ? col->at(row) : "<not a string column>";
+}
+
+} // namespace
+
+// =============================================================================
+// Round-trip Tests
+// =============================================================================
+
+TEST_CASE("ArrowIpc round-trips typed columns", "[ArrowIpc]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addDoubleColumn("amount");
+    df.addStringColumn("city");
+    for (int i = 0; i < 1000; ++i) {
+        df.addRow({std::to_string(i - 500), std::to_string(i * 0.5), "city_" + std::to_string(i % 7)});
+    }
+
+    auto loaded = ArrowIpc::read(ArrowIpc::write(df));
+
+    REQUIRE(loaded->getColumnNames() == df.getColumnNames());
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->data() ==
+            std::dynamic_pointer_cast<IntColumn>(df.getColumn("id"))->data());
+    REQUIRE(std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("amount"))->data() ==
+            std::dynamic_pointer_cast<DoubleColumn>(df.getColumn("amount"))->data());
+    REQUIRE(cell(*loaded, "city", 999) == "city_5");
+    REQUIRE(loaded->getStringPool()->size() == 7);
+}
+
+TEST_CASE("ArrowIpc writes a page with a compacted dictionary", "[ArrowIpc]") {
+    DataFrame df;
+    df.addStringColumn("name");
+    df.addIntColumn("id");
+    for (int i = 0; i < 1000; ++i) {
+        df.addRow({"name_" + std::to_string(i), std::to_string(i)});
+    }
+
+    // Pool plus grand que la page : seules les strings de la page sont écrites
+    auto page = ArrowIpc::write(df, {"id", "name"}, 990, 2000, {{"total_rows", "1000"}});
+    auto loaded = ArrowIpc::read(page);
+
+    REQUIRE(loaded->getColumnNames() == std::vector<std::string>{"id", "name"});
+    REQUIRE(loaded->rowCount() == 10);
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->at(0) == 990);
+    REQUIRE(cell(*loaded, "name", 9) == "name_999");
+    REQUIRE(loaded->getStringPool()->size() == 10);
+    REQUIRE(page.size() < 2000);
+}
+
+// =============================================================================
+// Interoperability Tests
+// =============================================================================
+
+TEST_CASE("ArrowIpc reads a pyarrow stream with nulls and wide integers", "[ArrowIpc]") {
+    auto loaded = ArrowIpc::read(std::string_view(reinterpret_cast<const char*>(PYARROW_STREAM),
+                                                  sizeof(PYARROW_STREAM)));
+
+    REQUIRE(loaded->rowCount() == 3);
+    // 2^40 ne tient pas sur 32 bits : int64 → DOUBLE
+    REQUIRE(loaded->getColumn("n")->getType() == ColumnTypeOpt::DOUBLE);
+    REQUIRE(std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("n"))->data() ==
+            std::vector<double>{7.0, 0.0, 1099511627776.0});
+    REQUIRE(cell(*loaded, "s", 0) == "a");
+    REQUIRE(cell(*loaded, "s", 1) == "");
+    REQUIRE(cell(*loaded, "s", 2) == "bc");
+}
+
+TEST_CASE("ArrowIpc rejects truncated and invalid streams", "[ArrowIpc]") {
+    std::string stream(reinterpret_cast<const char*>(PYARROW_STREAM), sizeof(PYARROW_STREAM));
+
+    REQUIRE_THROWS_AS(ArrowIpc::read(stream.substr(0, 200)), std::runtime_error);
+    REQUIRE_THROWS_AS(ArrowIpc::read("not an arrow stream"), std::runtime_error);
+    REQUIRE_THROWS_AS(ArrowIpc::read(""), std::runtime_error);
+}
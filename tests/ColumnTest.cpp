@@ -557,3 +557,41 @@ TEST_CASE("StringColumn filterByIndices", "[StringColumn]") {
     REQUIRE(stringFiltered->at(0) == "B");
     REQUIRE(stringFiltered->at(1) == "D");
 }
+
+// =============================================================================
+// visitColumn Tests
+// =============================================================================
+
+TEST_CASE("visitColumn dispatches on the concrete column type", "[visitColumn]") {
+    auto pool = std::make_shared<StringPool>();
+    std::vector<IColumnPtr> columns = {
+        std::make_shared<IntColumn>("i"),
+        std::make_shared<DoubleColumn>("d"),
+        std::make_shared<StringColumn>("s", pool)
+    };
+
+    std::vector<std::string> seen;
+    for (const auto& col : columns) {
+        visitColumn(*col, [&](auto& typed) {
+            using Col = ColumnT<decltype(typed)>;
+            if constexpr (std::is_same_v<Col, IntColumn>) {
+                typed.push_back(42);
+                seen.push_back("int");
+            } else if constexpr (std::is_same_v<Col, DoubleColumn>) {
+                typed.push_back(1.5);
+                seen.push_back("double");
+            } else {
+                typed.push_back("x");
+                seen.push_back("string");
+            }
+        });
+    }
+
+    REQUIRE(seen == std::vector<std::string>{"int", "double", "string"});
+
+    // Const overload with a return value
+    const IColumn& constCol = *columns[0];
+    auto size = visitColumn(constCol, [](const auto& typed) { return typed.size(); });
+    REQUIRE(size == 1);
+    REQUIRE(static_cast<const IntColumn&>(constCol).at(0) == 42);
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/ColumnarFile.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace dataframe;
+
+namespace {
+
+// Unique per process and per call: ctest may run test cases as parallel processes
+std::string tempPath() {
+    static std::atomic<int> counter{0};
+    return "/tmp/test_columnar_" + std::to_string(::getpid()) + "_" + std::to_string(counter++) + ".adf";
+}
+
+} // namespace
+
+// =============================================================================
+// Round-trip Tests
+// =============================================================================
+
+TEST_CASE("ColumnarFile round-trips columns, strings and sort order", "[ColumnarFile]") {
+    DataFrame df;
+    df.addStringColumn("region");
+    df.addIntColumn("id");
+    df.addDoubleColumn("amount");
+    for (int i = 0; i < 10000; ++i) {
+        df.addRow({"region_" + std::to_string(i / 1000), std::to_string(i), std::to_string(i * 0.25)});
+    }
+    REQUIRE(df.declareSortedBy({{"region", true}, {"id", true}}));
+
+    std::string path = tempPath();
+    ColumnarFile::WriteOptions options;
+    options.chunkRows = 4096;
+    ColumnarFile::write(df, path, options);
+    auto loaded = ColumnarFile::read(path, {});
+
+    REQUIRE(loaded->getColumnNames() == df.getColumnNames());
+    REQUIRE(loaded->rowCount() == 10000);
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->data() ==
+            std::dynamic_pointer_cast<IntColumn>(df.getColumn("id"))->data());
+    REQUIRE(std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("amount"))->data() ==
+            std::dynamic_pointer_cast<DoubleColumn>(df.getColumn("amount"))->data());
+    REQUIRE(std::dynamic_pointer_cast<StringColumn>(loaded->getColumn("region"))->at(9999) == "region_9");
+    REQUIRE(loaded->getStringPool()->size() == 10);
+    REQUIRE(loaded->getSortedBy() == df.getSortedBy());
+
+    auto info = ColumnarFile::inspect(path);
+    REQUIRE(info.rowCount == 10000);
+    REQUIRE(info.columns[1].chunks.size() == 3);
+    REQUIRE(info.columns[1].chunks[2].min == 8192);
+    REQUIRE(info.columns[1].chunks[2].max == 9999);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ColumnarFile writes only referenced strings", "[ColumnarFile]") {
+    DataFrame df;
+    df.addStringColumn("name");
+    for (int i = 0; i < 100; ++i) {
+        df.addRow({"name_" + std::to_string(i)});
+    }
+    // filter() partage le pool du DataFrame source
+    auto filtered = df.filter(json::array({{{"column", "name"}, {"operator", "=="}, {"value", "name_42"}}}));
+    REQUIRE(filtered->rowCount() == 1);
+
+    std::string path = tempPath();
+    ColumnarFile::write(*filtered, path, {});
+    REQUIRE(ColumnarFile::inspect(path).stringCount == 1);
+    auto loaded = ColumnarFile::read(path, {});
+    REQUIRE(std::dynamic_pointer_cast<StringColumn>(loaded->getColumn("name"))->at(0) == "name_42");
+
+    std::filesystem::remove(path);
+}
+
+// =============================================================================
+// Validation Tests
+// =============================================================================
+
+TEST_CASE("ColumnarFile rejects corrupted and truncated files", "[ColumnarFile]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    for (int i = 0; i < 1000; ++i) {
+        df.addRow({std::to_string(i)});
+    }
+    std::string path = tempPath();
+    ColumnarFile::write(df, path, {});
+    auto size = std::filesystem::file_size(path);
+
+    SECTION("Checksum mismatch") {
+        {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(static_cast<std::streamoff>(size - 4));
+            file.write("\x7f", 1);
+        }
+        REQUIRE_THROWS_AS(ColumnarFile::read(path, {}), std::runtime_error);
+        ColumnarFile::ReadOptions unchecked;
+        unchecked.verifyChecksums = false;
+        REQUIRE(ColumnarFile::read(path, unchecked)->rowCount() == 1000);
+    }
+
+    SECTION("Truncated file") {
+        std::filesystem::resize_file(path, size - 100);
+        REQUIRE_THROWS_AS(ColumnarFile::read(path, {}), std::runtime_error);
+    }
+
+    SECTION("Not a columnar file") {
+        std::ofstream(path) << "id\n1\n2\n";
+        REQUIRE_THROWS_AS(ColumnarFile::read(path, {}), std::runtime_error);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ColumnarFile concurrent writers of one path do not collide", "[ColumnarFile]") {
+    std::string path = tempPath();
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([&path, w]() {
+            DataFrame df;
+            df.addIntColumn("id");
+            for (int i = 0; i < 5000; ++i) {
+                df.addRow({std::to_string(w)});
+            }
+            for (int round = 0; round < 5; ++round) {
+                ColumnarFile::write(df, path, {});
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    // Last rename wins with a complete file; no temporary file left behind
+    auto loaded = ColumnarFile::read(path, {});
+    REQUIRE(loaded->rowCount() == 5000);
+    auto directory = std::filesystem::path(path).parent_path();
+    auto prefix = std::filesystem::path(path).filename().string() + ".";
+    for (const auto& file : std::filesystem::directory_iterator(directory)) {
+        REQUIRE_FALSE(file.path().filename().string().starts_with(prefix));
+    }
+    std::filesystem::remove(path);
+}
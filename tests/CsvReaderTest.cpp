@@ -0,0 +1,262 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/CsvReader.hpp"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <atomic>
+#include <unistd.h>
+
+using namespace dataframe;
+
+// Unique per process: ctest may run test cases as parallel processes
+static std::string uniqueSuffix() {
+    static std::atomic<int> counter{0};
+    return std::to_string(::getpid()) + "_" + std::to_string(counter++);
+}
+
+// Same frame, column by column and cell by cell
+static void requireSameFrame(const DataFrame& expected, const DataFrame& actual) {
+    REQUIRE(actual.rowCount() == expected.rowCount());
+    REQUIRE(actual.getColumnNames() == expected.getColumnNames());
+
+    for (const auto& name : expected.getColumnNames()) {
+        auto expectedCol = expected.getColumn(name);
+        auto actualCol = actual.getColumn(name);
+        REQUIRE(actualCol->getType() == expectedCol->getType());
+
+        size_t mismatches = visitColumn(*expectedCol, [&](const auto& typed) {
+            const auto& other = static_cast<const ColumnT<decltype(typed)>&>(*actualCol);
+            size_t count = 0;
+            for (size_t i = 0; i < typed.size(); ++i) {
+                count += !(other.at(i) == typed.at(i));
+            }
+            return count;
+        });
+        REQUIRE(mismatches == 0);
+    }
+}
+
+static std::string writeTempCSV(const std::string& content) {
+    std::string path = "/tmp/test_csv_reader_" + uniqueSuffix() + ".csv";
+    std::ofstream file(path);
+    file << content;
+    return path;
+}
+
+// =============================================================================
+// Parsing Tests
+// =============================================================================
+
+TEST_CASE("CsvReader parses typed columns from memory", "[CsvReader]") {
+    auto df = CsvReader::parse("id,price,name\n1,10.5,Alice\n+2,-3,Bob\n", {});
+
+    REQUIRE(df->rowCount() == 2);
+    auto ids = std::dynamic_pointer_cast<IntColumn>(df->getColumn("id"));
+    auto prices = std::dynamic_pointer_cast<DoubleColumn>(df->getColumn("price"));
+    REQUIRE(ids->at(1) == 2);
+    REQUIRE(prices->at(0) == 10.5);
+    REQUIRE(prices->at(1) == -3.0);
+}
+
+TEST_CASE("CsvReader invalid and missing values fall back to defaults", "[CsvReader]") {
+    CsvReader::Options options;
+    options.schema = {{"id", ColumnTypeOpt::INT}, {"score", ColumnTypeOpt::DOUBLE}};
+    auto df = CsvReader::parse("id,score,name\n1,1.5,Alice\nabc,x\n99999999999,2.5,Carol\n", options);
+
+    REQUIRE(df->rowCount() == 3);
+    auto ids = std::dynamic_pointer_cast<IntColumn>(df->getColumn("id"));
+    auto scores = std::dynamic_pointer_cast<DoubleColumn>(df->getColumn("score"));
+    auto names = std::dynamic_pointer_cast<StringColumn>(df->getColumn("name"));
+
+    REQUIRE(ids->at(1) == 0);       // not a number
+    REQUIRE(ids->at(2) == 0);       // out of range
+    REQUIRE(scores->at(1) == 0.0);
+    REQUIRE(names->at(1) == "");    // missing field
+}
+
+// =============================================================================
+// Schema Inference Tests
+// =============================================================================
+
+TEST_CASE("CsvReader promotes types over the sampled rows", "[CsvReader]") {
+    auto df = CsvReader::parse(
+        "id,amount,big,code,empty\n"
+        "1,10,5,A1,\n"
+        "2,3.5,99999999999,42,\n"
+        "3,,7,B2,\n", {});
+
+    REQUIRE(df->getColumn("id")->getType() == ColumnTypeOpt::INT);
+    REQUIRE(df->getColumn("amount")->getType() == ColumnTypeOpt::DOUBLE);
+    REQUIRE(df->getColumn("big")->getType() == ColumnTypeOpt::DOUBLE);
+    REQUIRE(df->getColumn("code")->getType() == ColumnTypeOpt::STRING);
+    REQUIRE(df->getColumn("empty")->getType() == ColumnTypeOpt::STRING);
+
+    auto amounts = std::dynamic_pointer_cast<DoubleColumn>(df->getColumn("amount"));
+    auto big = std::dynamic_pointer_cast<DoubleColumn>(df->getColumn("big"));
+    REQUIRE(amounts->at(0) == 10.0);
+    REQUIRE(amounts->at(1) == 3.5);
+    REQUIRE(amounts->at(2) == 0.0);
+    REQUIRE(big->at(1) == 99999999999.0);
+}
+
+TEST_CASE("CsvReader re-parses when a value outside the sample needs a wider type", "[CsvReader]") {
+    CsvReader::Options options;
+    options.sampleRows = 1;  // Only the first record is sampled
+    auto df = CsvReader::parse("id,value\n1,10\n2,20\n3,3.5\n4,n/a\n", options);
+
+    REQUIRE(df->getColumn("id")->getType() == ColumnTypeOpt::INT);
+    REQUIRE(df->getColumn("value")->getType() == ColumnTypeOpt::STRING);
+    auto values = std::dynamic_pointer_cast<StringColumn>(df->getColumn("value"));
+    REQUIRE(values->at(2) == "3.5");
+    REQUIRE(values->at(3) == "n/a");
+}
+
+TEST_CASE("CsvReader schema override disables inference", "[CsvReader]") {
+    CsvReader::Options options;
+    options.schema = CsvReader::parseSchema("zip:string, amount : DOUBLE");
+    auto df = CsvReader::parse("zip,amount\n01234,1\n75001,2\n", options);
+
+    auto zips = std::dynamic_pointer_cast<StringColumn>(df->getColumn("zip"));
+    auto amounts = std::dynamic_pointer_cast<DoubleColumn>(df->getColumn("amount"));
+    REQUIRE(zips->at(0) == "01234");
+    REQUIRE(amounts->at(1) == 2.0);
+
+    options.schema = {{"missing", ColumnTypeOpt::INT}};
+    REQUIRE_THROWS_AS(CsvReader::parse("zip\n1\n", options), std::runtime_error);
+    REQUIRE_THROWS_AS(CsvReader::parseSchema("zip:uuid"), std::runtime_error);
+    REQUIRE_THROWS_AS(CsvReader::parseSchema("zip"), std::runtime_error);
+}
+
+TEST_CASE("CsvReader keeps quoted newlines inside the field", "[CsvReader]") {
+    auto df = CsvReader::parse("id,note\n1,\"first line\nsecond line\"\n2,\"a \"\"b\"\", c\"\n", {});
+
+    REQUIRE(df->rowCount() == 2);
+    auto notes = std::dynamic_pointer_cast<StringColumn>(df->getColumn("note"));
+    REQUIRE(notes->at(0) == "first line\nsecond line");
+    REQUIRE(notes->at(1) == "a \"b\", c");
+}
+
+TEST_CASE("CsvReader keeps an empty first field in TSV rows", "[CsvReader]") {
+    CsvReader::Options options;
+    options.delimiter = '\t';
+    auto df = CsvReader::parse("code\tid\tname\n\t1\tAlice\nA7\t2\tBob\n\n\t3\tCarol\n", options);
+
+    REQUIRE(df->rowCount() == 3);
+    auto codes = std::dynamic_pointer_cast<StringColumn>(df->getColumn("code"));
+    auto ids = std::dynamic_pointer_cast<IntColumn>(df->getColumn("id"));
+    auto names = std::dynamic_pointer_cast<StringColumn>(df->getColumn("name"));
+    REQUIRE(codes->at(0) == "");
+    REQUIRE(ids->at(0) == 1);
+    REQUIRE(names->at(0) == "Alice");
+    REQUIRE(codes->at(2) == "");
+    REQUIRE(ids->at(2) == 3);
+    REQUIRE(names->at(2) == "Carol");
+}
+
+TEST_CASE("CsvReader detectType", "[CsvReader]") {
+    REQUIRE(CsvReader::detectType("42") == ColumnTypeOpt::INT);
+    REQUIRE(CsvReader::detectType(" -7 ") == ColumnTypeOpt::INT);
+    REQUIRE(CsvReader::detectType("3.14") == ColumnTypeOpt::DOUBLE);
+    REQUIRE(CsvReader::detectType("3,14") == ColumnTypeOpt::DOUBLE);
+    REQUIRE(CsvReader::detectType("2e3") == ColumnTypeOpt::DOUBLE);
+    REQUIRE(CsvReader::detectType("99999999999") == ColumnTypeOpt::DOUBLE);
+    REQUIRE(CsvReader::detectType("nan") == ColumnTypeOpt::STRING);
+    REQUIRE(CsvReader::detectType("1.2.3") == ColumnTypeOpt::STRING);
+    REQUIRE(CsvReader::detectType("-") == ColumnTypeOpt::STRING);
+    REQUIRE(CsvReader::detectType("") == ColumnTypeOpt::STRING);
+}
+
+// =============================================================================
+// Parallel Chunking Tests
+// =============================================================================
+
+TEST_CASE("CsvReader parallel chunks match single-threaded parse", "[CsvReader]") {
+    // ~3 MB so that several chunks are parsed; quoted fields with delimiters,
+    // newlines and escaped quotes straddle the chunk boundaries
+    std::string csv = "id,amount,label,region\n";
+    for (int i = 0; i < 60000; ++i) {
+        csv += std::to_string(i) + "," + std::to_string(i * 0.25) + ",";
+        if (i % 7 == 0) {
+            csv += "\"multi\nline, \"\"quoted\"\" " + std::to_string(i % 50) + "\"";
+        } else {
+            csv += "label_" + std::to_string(i % 1000);
+        }
+        csv += i % 3 == 0 ? ",North\n" : ",South\r\n";
+        if (i % 1000 == 0) csv += "\n";  // blank line
+    }
+
+    CsvReader::Options sequential;
+    sequential.threads = 1;
+    CsvReader::Options parallel;
+    parallel.threads = 4;
+
+    auto expected = CsvReader::parse(csv, sequential);
+    auto actual = CsvReader::parse(csv, parallel);
+
+    REQUIRE(expected->rowCount() == 60000);
+    requireSameFrame(*expected, *actual);
+    REQUIRE(actual->getStringPool()->size() == expected->getStringPool()->size());
+
+    auto labels = std::dynamic_pointer_cast<StringColumn>(actual->getColumn("label"));
+    REQUIRE(labels->at(7) == "multi\nline, \"quoted\" 7");
+}
+
+// =============================================================================
+// Batch Reader Tests
+// =============================================================================
+
+TEST_CASE("CsvBatchReader yields fixed-size batches sharing one pool", "[CsvReader]") {
+    std::string csv = "id,amount,region\n";
+    for (int i = 0; i < 2500; ++i) {
+        csv += std::to_string(i) + "," + std::to_string(i * 0.5) + "," +
+               (i % 2 ? "North" : "\"South, east\"") + "\n";
+    }
+    auto path = writeTempCSV(csv);
+
+    CsvBatchReader::Options options;
+    options.batchRows = 1000;
+    CsvBatchReader reader(path, options);
+    REQUIRE(reader.getColumnNames() == std::vector<std::string>{"id", "amount", "region"});
+    REQUIRE(reader.getColumnTypes() ==
+            std::vector<ColumnTypeOpt>{ColumnTypeOpt::INT, ColumnTypeOpt::DOUBLE, ColumnTypeOpt::STRING});
+
+    std::vector<size_t> sizes;
+    auto all = reader.emptyFrame();
+    while (auto batch = reader.next()) {
+        REQUIRE(batch->getStringPool() == reader.getStringPool());
+        sizes.push_back(batch->rowCount());
+        if (sizes.size() == 3) {
+            auto ids = std::dynamic_pointer_cast<IntColumn>(batch->getColumn("id"));
+            auto regions = std::dynamic_pointer_cast<StringColumn>(batch->getColumn("region"));
+            REQUIRE(ids->at(0) == 2000);
+            REQUIRE(regions->at(0) == "South, east");
+        }
+    }
+    REQUIRE(sizes == std::vector<size_t>{1000, 1000, 500});
+    REQUIRE(reader.rowsRead() == 2500);
+    REQUIRE(reader.getStringPool()->size() == 2);
+    REQUIRE(reader.next() == nullptr);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CsvBatchReader rejects values outside the inferred type", "[CsvReader]") {
+    auto path = writeTempCSV("id,value\n1,10\n2,20\n3,oops\n");
+
+    CsvBatchReader::Options options;
+    options.batchRows = 2;
+    options.sampleRows = 1;
+    CsvBatchReader reader(path, options);
+    REQUIRE(reader.next()->rowCount() == 2);
+    REQUIRE_THROWS_AS(reader.next(), std::runtime_error);
+
+    options.schema = {{"value", ColumnTypeOpt::INT}};
+    CsvBatchReader forced(path, options);
+    forced.next();
+    auto values = std::dynamic_pointer_cast<IntColumn>(forced.next()->getColumn("value"));
+    REQUIRE(values->at(0) == 0);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/CsvReader.hpp"
+#include "dataframe/CsvWriter.hpp"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <atomic>
+#include <unistd.h>
+
+using namespace dataframe;
+
+// Unique per process: ctest may run test cases as parallel processes
+static std::string uniqueSuffix() {
+    static std::atomic<int> counter{0};
+    return std::to_string(::getpid()) + "_" + std::to_string(counter++);
+}
+
+// =============================================================================
+// Formatting Tests
+// =============================================================================
+
+TEST_CASE("CsvWriter formats numbers with to_chars", "[CsvWriter]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addDoubleColumn("value");
+    df.addRow({"-7", "0.1"});
+    df.addRow({"42", "3"});
+    df.addRow({"0", "123456.789012345"});
+
+    auto csv = CsvWriter::toString(df, {});
+    REQUIRE(csv == "id,value\n-7,0.1\n42,3.0\n0,123456.789012345\n");
+}
+
+TEST_CASE("CsvWriter quotes fields per RFC 4180", "[CsvWriter]") {
+    DataFrame df;
+    df.addStringColumn("name, full");
+    df.addStringColumn("note");
+    df.addRow({"plain", "say \"hi\""});
+    df.addRow({"a,b", "two\nlines"});
+
+    auto csv = CsvWriter::toString(df, {});
+    REQUIRE(csv ==
+        "\"name, full\",note\n"
+        "plain,\"say \"\"hi\"\"\"\n"
+        "\"a,b\",\"two\nlines\"\n");
+
+    CsvWriter::Options semicolon;
+    semicolon.delimiter = ';';
+    semicolon.includeHeader = false;
+    REQUIRE(CsvWriter::toString(df, semicolon) ==
+        "plain;\"say \"\"hi\"\"\"\n"
+        "a,b;\"two\nlines\"\n");
+}
+
+// =============================================================================
+// Parallel Encoding Tests
+// =============================================================================
+
+TEST_CASE("CsvWriter parallel blocks round-trip through CsvReader", "[CsvWriter]") {
+    // Several blocks, shortest round-trip doubles, quoted strings
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addDoubleColumn("ratio");
+    df.addStringColumn("label");
+    for (int i = 0; i < 50000; ++i) {
+        std::ostringstream ratio;
+        ratio.precision(17);
+        ratio << i / 7.0;
+        df.addRow({std::to_string(i), ratio.str(),
+                   i % 5 == 0 ? "with, \"quotes\"" : "label_" + std::to_string(i % 100)});
+    }
+
+    CsvWriter::Options sequential;
+    sequential.threads = 1;
+    CsvWriter::Options parallel;
+    parallel.threads = 4;
+    auto expected = CsvWriter::toString(df, sequential);
+    REQUIRE(CsvWriter::toString(df, parallel) == expected);
+
+    std::string path = "/tmp/test_csv_writer_" + uniqueSuffix() + ".csv";
+    CsvWriter::write(df, path, parallel);
+    std::ifstream file(path, std::ios::binary);
+    std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    REQUIRE(written == expected);
+
+    auto loaded = CsvReader::parse(expected, {});
+    REQUIRE(loaded->rowCount() == df.rowCount());
+    auto ratios = std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("ratio"));
+    auto original = std::dynamic_pointer_cast<DoubleColumn>(df.getColumn("ratio"));
+    REQUIRE(ratios->data() == original->data());
+    auto labels = std::dynamic_pointer_cast<StringColumn>(loaded->getColumn("label"));
+    REQUIRE(labels->at(0) == "with, \"quotes\"");
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CsvWriter throws when the file cannot be created", "[CsvWriter]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    REQUIRE_THROWS(CsvWriter::write(df, "/nonexistent/dir/out.csv", {}));
+}
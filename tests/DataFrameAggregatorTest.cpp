@@ -563,3 +563,81 @@ TEST_CASE("GroupBy nonexistent column throws", "[DataFrameAggregator][error]") {
 
     REQUIRE_THROWS(df.groupBy(groupByJson));
 }
+
+// =============================================================================
+// Sorted Input (streaming) Tests
+// =============================================================================
+
+TEST_CASE("GroupBy on sorted input matches hash path", "[DataFrameAggregator][sortedness]") {
+    auto df = createAggTestDataFrame();
+    json groupByJson = {
+        {"groupBy", {"dept"}},
+        {"aggregations", json::array({
+            {{"column", "name"}, {"function", "count"}, {"alias", "n"}},
+            {{"column", "salary"}, {"function", "sum"}, {"alias", "total"}},
+            {{"column", "bonus"}, {"function", "avg"}, {"alias", "avg_bonus"}},
+            {{"column", "salary"}, {"function", "min"}, {"alias", "min_salary"}},
+            {{"column", "salary"}, {"function", "max"}, {"alias", "max_salary"}}
+        })}
+    };
+
+    auto sorted = df.orderBy(json::array({{{"column", "dept"}, {"order", "asc"}}}));
+    auto hashed = df.groupBy(groupByJson)->orderBy(
+        json::array({{{"column", "dept"}, {"order", "asc"}}}));
+    auto streamed = sorted->groupBy(groupByJson);
+
+    REQUIRE(streamed->isSortedBy({{"dept", true}}));
+    REQUIRE(streamed->rowCount() == hashed->rowCount());
+    REQUIRE(streamed->getColumnNames() == hashed->getColumnNames());
+
+    for (const auto& name : hashed->getColumnNames()) {
+        auto expected = hashed->getColumn(name);
+        auto actual = streamed->getColumn(name);
+        REQUIRE(actual->getType() == expected->getType());
+        for (size_t i = 0; i < hashed->rowCount(); ++i) {
+            if (auto d = std::dynamic_pointer_cast<DoubleColumn>(expected)) {
+                auto a = std::dynamic_pointer_cast<DoubleColumn>(actual);
+                REQUIRE_THAT(a->at(i), Catch::Matchers::WithinRel(d->at(i)));
+            } else if (auto n = std::dynamic_pointer_cast<IntColumn>(expected)) {
+                REQUIRE(std::dynamic_pointer_cast<IntColumn>(actual)->at(i) == n->at(i));
+            } else {
+                auto s = std::dynamic_pointer_cast<StringColumn>(expected);
+                REQUIRE(std::dynamic_pointer_cast<StringColumn>(actual)->at(i) == s->at(i));
+            }
+        }
+    }
+}
+
+TEST_CASE("GroupBy count on sorted input ignores the source column", "[DataFrameAggregator][sortedness]") {
+    auto df = createAggTestDataFrame();
+    json groupByJson = {
+        {"groupBy", {"dept"}},
+        {"aggregations", json::array({
+            {{"column", "*"}, {"function", "count"}, {"alias", "n"}}
+        })}
+    };
+
+    auto sorted = df.orderBy(json::array({{{"column", "dept"}, {"order", "asc"}}}));
+    auto result = sorted->groupBy(groupByJson);
+
+    REQUIRE(result->rowCount() == 2);
+    auto deptCol = std::dynamic_pointer_cast<StringColumn>(result->getColumn("dept"));
+    auto countCol = std::dynamic_pointer_cast<IntColumn>(result->getColumn("n"));
+    REQUIRE(deptCol->at(0) == "Engineering");
+    REQUIRE(countCol->at(0) == 3);
+    REQUIRE(deptCol->at(1) == "Sales");
+    REQUIRE(countCol->at(1) == 2);
+}
+
+TEST_CASE("GroupBy result shares source string pool", "[DataFrameAggregator]") {
+    auto df = createAggTestDataFrame();
+    json groupByJson = {
+        {"groupBy", {"dept"}},
+        {"aggregations", json::array({
+            {{"column", "name"}, {"function", "count"}, {"alias", "n"}}
+        })}
+    };
+
+    auto result = df.groupBy(groupByJson);
+    REQUIRE(result->getStringPool() == df.getStringPool());
+}
@@ -316,6 +316,70 @@ TEST_CASE("Filter contains at end", "[DataFrameFilter]") {
     REQUIRE(filtered->rowCount() == 1);
 }
 
+TEST_CASE("Filter startsWith and endsWith", "[DataFrameFilter]") {
+    DataFrame df;
+    df.addStringColumn("email");
+    df.addRow({"alice@corp.com"});
+    df.addRow({"bob@home.org"});
+    df.addRow({"alex@corp.com"});
+
+    json startsJson = json::array({{{"column", "email"}, {"operator", "startsWith"}, {"value", "al"}}});
+    json endsJson = json::array({{{"column", "email"}, {"operator", "endsWith"}, {"value", ".org"}}});
+
+    REQUIRE(df.filter(startsJson)->rowCount() == 2);
+    REQUIRE(df.filter(endsJson)->rowCount() == 1);
+}
+
+TEST_CASE("Filter regex and case-insensitive contains", "[DataFrameFilter]") {
+    DataFrame df;
+    df.addStringColumn("city");
+    df.addIntColumn("id");
+    df.addRow({"Salt Lake City", "1"});
+    df.addRow({"Lakewood", "2"});
+    df.addRow({"Denver", "3"});
+
+    json regexJson = json::array({{{"column", "city"}, {"operator", "regex"}, {"value", "^[A-Z][a-z]+$"}}});
+    json icontainsJson = json::array({{{"column", "city"}, {"operator", "icontains"}, {"value", "LAKE"}}});
+    json onIntJson = json::array({{{"column", "id"}, {"operator", "startsWith"}, {"value", "1"}}});
+
+    REQUIRE(df.filter(regexJson)->rowCount() == 2);
+    REQUIRE(df.filter(icontainsJson)->rowCount() == 2);
+    REQUIRE(df.filter(onIntJson)->rowCount() == 0);
+}
+
+// =============================================================================
+// In Operator Tests
+// =============================================================================
+
+TEST_CASE("Filter in StringColumn", "[DataFrameFilter]") {
+    auto df = createTestDataFrame();
+
+    json filterJson = json::array({
+        {{"column", "name"}, {"operator", "in"}, {"value", {"David", "Alice"}}}
+    });
+
+    auto filtered = df.filter(filterJson);
+
+    REQUIRE(filtered->rowCount() == 3);
+
+    auto idCol = std::dynamic_pointer_cast<IntColumn>(filtered->getColumn("id"));
+    REQUIRE(idCol->at(0) == 1);
+    REQUIRE(idCol->at(1) == 4);
+    REQUIRE(idCol->at(2) == 5);
+}
+
+TEST_CASE("Filter in IntColumn with duplicate values", "[DataFrameFilter]") {
+    auto df = createTestDataFrame();
+
+    json filterJson = json::array({
+        {{"column", "id"}, {"operator", "in"}, {"value", {2, 2, 9}}}
+    });
+
+    auto filtered = df.filter(filterJson);
+
+    REQUIRE(filtered->rowCount() == 1);
+}
+
 // =============================================================================
 // Multiple Conditions (AND) Tests
 // =============================================================================
@@ -3,12 +3,20 @@
 #include "dataframe/DataFrameIO.hpp"
 #include <fstream>
 #include <filesystem>
+#include <atomic>
+#include <unistd.h>
 
 using namespace dataframe;
 
+// Unique per process: ctest may run test cases as parallel processes
+static std::string uniqueSuffix() {
+    static std::atomic<int> counter{0};
+    return std::to_string(::getpid()) + "_" + std::to_string(counter++);
+}
+
 // Helper to create temporary CSV file
 static std::string createTempCSV(const std::string& content) {
-    std::string path = "/tmp/test_dataframe_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_dataframe_" + uniqueSuffix() + ".csv";
     std::ofstream file(path);
     file << content;
     file.close();
@@ -203,7 +211,7 @@ TEST_CASE("CSV writeCSV basic", "[DataFrameIO]") {
     df.addRow({"1", "Alice"});
     df.addRow({"2", "Bob"});
 
-    std::string path = "/tmp/test_write_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_write_" + uniqueSuffix() + ".csv";
 
     DataFrameIO::writeCSV(df, path);
 
@@ -232,7 +240,7 @@ TEST_CASE("CSV writeCSV with header", "[DataFrameIO]") {
 
     df.addRow({"1", "2"});
 
-    std::string path = "/tmp/test_write_header_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_write_header_" + uniqueSuffix() + ".csv";
 
     DataFrameIO::writeCSV(df, path, ',', true);
 
@@ -253,7 +261,7 @@ TEST_CASE("CSV writeCSV without header", "[DataFrameIO]") {
 
     df.addRow({"1", "2"});
 
-    std::string path = "/tmp/test_write_noheader_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_write_noheader_" + uniqueSuffix() + ".csv";
 
     DataFrameIO::writeCSV(df, path, ',', false);
 
@@ -275,7 +283,7 @@ TEST_CASE("CSV writeCSV custom delimiter", "[DataFrameIO]") {
 
     df.addRow({"1", "2"});
 
-    std::string path = "/tmp/test_write_delim_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_write_delim_" + uniqueSuffix() + ".csv";
 
     DataFrameIO::writeCSV(df, path, ';', true);
 
@@ -305,7 +313,7 @@ TEST_CASE("CSV roundtrip read-write-read", "[DataFrameIO]") {
     original.addRow({"3", "30.0", "Charlie"});
 
     // Write to CSV
-    std::string path = "/tmp/test_roundtrip_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_roundtrip_" + uniqueSuffix() + ".csv";
     DataFrameIO::writeCSV(original, path);
 
     // Read back
@@ -342,7 +350,7 @@ TEST_CASE("CSV roundtrip preserves types", "[DataFrameIO]") {
 
     original.addRow({"42", "3.14159", "hello"});
 
-    std::string path = "/tmp/test_roundtrip_types_" + std::to_string(std::rand()) + ".csv";
+    std::string path = "/tmp/test_roundtrip_types_" + uniqueSuffix() + ".csv";
     DataFrameIO::writeCSV(original, path);
 
     auto loaded = DataFrameIO::readCSV(path);
@@ -0,0 +1,234 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/DataFrame.hpp"
+#include "dataframe/DataFrameIndex.hpp"
+#include <sstream>
+#include <thread>
+
+using namespace dataframe;
+
+// Helper to create test DataFrame for index tests
+static std::shared_ptr<DataFrame> createIndexTestDataFrame() {
+    auto df = std::make_shared<DataFrame>();
+
+    df->addIntColumn("id");
+    df->addStringColumn("region");
+    df->addDoubleColumn("amount");
+
+    df->addRow({"1", "North", "10.5"});
+    df->addRow({"2", "South", "20.0"});
+    df->addRow({"3", "North", "5.0"});
+    df->addRow({"4", "East", "20.0"});
+    df->addRow({"5", "South", "15.0"});
+    df->addRow({"6", "North", "30.0"});
+
+    return df;
+}
+
+// Compare index result with the plain scan result, column by column
+static void requireSameFrame(const DataFrame& expected, const DataFrame& actual) {
+    REQUIRE(actual.rowCount() == expected.rowCount());
+    REQUIRE(actual.getColumnNames() == expected.getColumnNames());
+    REQUIRE(actual.getSortedBy() == expected.getSortedBy());
+
+    auto expectedIds = std::dynamic_pointer_cast<IntColumn>(expected.getColumn("id"));
+    auto actualIds = std::dynamic_pointer_cast<IntColumn>(actual.getColumn("id"));
+    for (size_t i = 0; i < expected.rowCount(); ++i) {
+        REQUIRE(actualIds->at(i) == expectedIds->at(i));
+    }
+}
+
+// =============================================================================
+// Lookup Tests
+// =============================================================================
+
+TEST_CASE("Hash index equality lookup", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    auto rows = index.lookup("region", "==", {"North"});
+    REQUIRE(rows.has_value());
+    REQUIRE(*rows == std::vector<size_t>{0, 2, 5});
+    REQUIRE(index.has("region", DataFrameIndex::Kind::Hash));
+
+    auto ids = index.lookup("id", "in", {"6", "2", "2"});
+    REQUIRE(ids.has_value());
+    REQUIRE(*ids == std::vector<size_t>{1, 5});
+}
+
+TEST_CASE("Hash index lookup of unknown string does not grow pool", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+    size_t poolSize = df->getStringPool()->size();
+
+    auto rows = index.lookup("region", "==", {"West"});
+    REQUIRE(rows.has_value());
+    REQUIRE(rows->empty());
+    REQUIRE(df->getStringPool()->size() == poolSize);
+}
+
+TEST_CASE("Sorted index range lookup", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    REQUIRE(*index.lookup("amount", ">=", {"20"}) == std::vector<size_t>{1, 3, 5});
+    REQUIRE(*index.lookup("amount", "<", {"15"}) == std::vector<size_t>{0, 2});
+    REQUIRE(*index.lookup("amount", "==", {"20"}) == std::vector<size_t>{1, 3});
+    REQUIRE(*index.lookup("region", ">", {"North"}) == std::vector<size_t>{1, 4});
+    REQUIRE(index.has("amount", DataFrameIndex::Kind::Sorted));
+}
+
+TEST_CASE("Non indexable predicates fall back", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    REQUIRE_FALSE(index.lookup("region", "contains", {"th"}).has_value());
+    REQUIRE_FALSE(index.lookup("region", "!=", {"North"}).has_value());
+    REQUIRE_FALSE(index.lookup("missing", "==", {"1"}).has_value());
+
+    DataFrameIndex manual(df, false);
+    REQUIRE_FALSE(manual.lookup("region", "==", {"North"}).has_value());
+    manual.build("region", DataFrameIndex::Kind::Hash);
+    REQUIRE(manual.lookup("region", "==", {"North"}).has_value());
+}
+
+TEST_CASE("Hash index on double column throws", "[DataFrameIndex][error]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    REQUIRE_THROWS(index.build("amount", DataFrameIndex::Kind::Hash));
+    REQUIRE_THROWS(index.build("missing", DataFrameIndex::Kind::Sorted));
+}
+
+// =============================================================================
+// Indexed Operations Tests
+// =============================================================================
+
+TEST_CASE("Indexed filter matches scan", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    json filterJson = json::array({
+        {{"column", "region"}, {"operator", "=="}, {"value", "North"}},
+        {{"column", "amount"}, {"operator", ">"}, {"value", 6}},
+        {{"column", "id"}, {"operator", "!="}, {"value", 6}}
+    });
+
+    auto scanned = df->filter(filterJson);
+    auto indexed = index.filter(filterJson);
+
+    REQUIRE(indexed->rowCount() == 1);
+    requireSameFrame(*scanned, *indexed);
+}
+
+TEST_CASE("Indexed orderBy matches stable sort", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    for (const char* order : {"asc", "desc"}) {
+        for (const char* column : {"amount", "region"}) {
+            json orderJson = json::array({{{"column", column}, {"order", order}}});
+            auto sorted = index.orderBy(orderJson);
+            REQUIRE(sorted);
+            requireSameFrame(*df->orderBy(orderJson), *sorted);
+        }
+    }
+
+    json multiKey = json::array({
+        {{"column", "region"}, {"order", "asc"}},
+        {{"column", "amount"}, {"order", "desc"}}
+    });
+    REQUIRE(index.orderBy(multiKey) == nullptr);
+}
+
+TEST_CASE("Trigram index enables pool search", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+
+    index.build("region", DataFrameIndex::Kind::Trigram);
+    REQUIRE(index.has("region", DataFrameIndex::Kind::Trigram));
+    REQUIRE(df->getStringPool()->trigramIndexEnabled());
+    REQUIRE(index.stats()["indexes"][0]["kind"] == "trigram");
+
+    auto filtered = index.filter(json::array({
+        {{"column", "region"}, {"operator", "icontains"}, {"value", "ORT"}}
+    }));
+    REQUIRE(filtered->rowCount() == 3);
+
+    REQUIRE_THROWS(index.build("id", DataFrameIndex::Kind::Trigram));
+}
+
+TEST_CASE("Concurrent lookups build each index once", "[DataFrameIndex]") {
+    auto df = std::make_shared<DataFrame>();
+    df->addIntColumn("id");
+    df->addStringColumn("region");
+    for (int i = 0; i < 20000; ++i) {
+        df->addRow({std::to_string(i), "region_" + std::to_string(i % 7)});
+    }
+    DataFrameIndex index(df);
+
+    std::vector<std::thread> threads;
+    std::vector<size_t> counts(8);
+    for (size_t t = 0; t < counts.size(); ++t) {
+        threads.emplace_back([&index, &counts, t]() {
+            auto regions = index.lookup("region", "==", {"region_3"});
+            auto ids = index.lookup("id", ">=", {"19990"});
+            counts[t] = regions->size() + ids->size();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t count : counts) {
+        REQUIRE(count == 2857 + 10);
+    }
+    REQUIRE(index.stats()["indexes"].size() == 2);
+}
+
+TEST_CASE("Saved indexes reload by string value", "[DataFrameIndex]") {
+    auto df = createIndexTestDataFrame();
+    DataFrameIndex index(df);
+    index.build("region", DataFrameIndex::Kind::Hash);
+    index.build("amount", DataFrameIndex::Kind::Sorted);
+    std::stringstream saved;
+    index.save(saved);
+
+    // Same rows, other StringIds: hash keys are matched by value
+    auto copy = std::make_shared<DataFrame>();
+    copy->getStringPool()->intern("Unused");
+    copy->addIntColumn("id");
+    copy->addStringColumn("region");
+    copy->addDoubleColumn("amount");
+    for (size_t i = 0; i < df->rowCount(); ++i) {
+        copy->addRow({std::to_string(i + 1),
+                      std::dynamic_pointer_cast<StringColumn>(df->getColumn("region"))->at(i),
+                      std::to_string(std::dynamic_pointer_cast<DoubleColumn>(df->getColumn("amount"))->at(i))});
+    }
+    DataFrameIndex restored(copy, false);
+    restored.load(saved);
+    REQUIRE(*restored.lookup("region", "==", {"North"}) == std::vector<size_t>{0, 2, 5});
+    REQUIRE(*restored.lookup("amount", ">", {"19"}) == std::vector<size_t>{1, 3, 5});
+
+    // Another frame: rejected, nothing adopted
+    auto other = createIndexTestDataFrame();
+    other->addRow({"7", "West", "1.0"});
+    DataFrameIndex rejected(other, false);
+    saved.clear();
+    saved.seekg(0);
+    REQUIRE_THROWS_AS(rejected.load(saved), std::runtime_error);
+    REQUIRE_FALSE(rejected.has("region", DataFrameIndex::Kind::Hash));
+
+    std::stringstream garbage("not an index");
+    REQUIRE_THROWS_AS(restored.load(garbage), std::runtime_error);
+}
+
+TEST_CASE("parseSpec reads index kinds", "[DataFrameIndex]") {
+    auto spec = DataFrameIndex::parseSpec("region:hash, amount:sorted ,id, email:trigram");
+    REQUIRE(spec.size() == 4);
+    REQUIRE(spec[0] == std::make_pair(std::string("region"), DataFrameIndex::Kind::Hash));
+    REQUIRE(spec[1] == std::make_pair(std::string("amount"), DataFrameIndex::Kind::Sorted));
+    REQUIRE(spec[2] == std::make_pair(std::string("id"), DataFrameIndex::Kind::Hash));
+    REQUIRE(spec[3] == std::make_pair(std::string("email"), DataFrameIndex::Kind::Trigram));
+
+    REQUIRE_THROWS(DataFrameIndex::parseSpec("region:btree"));
+}
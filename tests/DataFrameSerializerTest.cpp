@@ -262,3 +262,25 @@ TEST_CASE("Serializer toJson large numbers", "[DataFrameSerializer]") {
     // Double precision check
     REQUIRE(result["data"][0][1] > 1e300);
 }
+
+TEST_CASE("Serializer rowsToJson returns a row range", "[DataFrameSerializer]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addStringColumn("region");
+
+    df.addRow({"1", "North"});
+    df.addRow({"2", "South"});
+    df.addRow({"3", "North"});
+    df.addRow({"4", "East"});
+
+    auto getColumn = [&df](const std::string& name) { return df.getColumn(name); };
+
+    json page = DataFrameSerializer::rowsToJson(1, 3, df.getColumnNames(), getColumn);
+    REQUIRE(page == json::parse(R"([[2, "South"], [3, "North"]])"));
+
+    // Small page over a larger dictionary takes the direct conversion path
+    json single = DataFrameSerializer::rowsToJson(3, 4, df.getColumnNames(), getColumn);
+    REQUIRE(single == json::parse(R"([[4, "East"]])"));
+
+    REQUIRE(DataFrameSerializer::rowsToJson(3, 3, df.getColumnNames(), getColumn).empty());
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "dataframe/DataFrame.hpp"
 #include "dataframe/DataFrameSorter.hpp"
+#include "dataframe/Cancellation.hpp"
 
 using namespace dataframe;
 
@@ -377,3 +378,119 @@ TEST_CASE("Sort nonexistent column throws", "[DataFrameSorter][error]") {
 
     REQUIRE_THROWS(df.orderBy(orderJson));
 }
+
+// =============================================================================
+// Sortedness Metadata Tests
+// =============================================================================
+
+TEST_CASE("orderBy records sort order", "[DataFrameSorter][sortedness]") {
+    DataFrame df;
+    df.addStringColumn("region");
+    df.addIntColumn("amount");
+    df.addRow({"B", "2"});
+    df.addRow({"A", "3"});
+    df.addRow({"A", "1"});
+
+    REQUIRE(df.getSortedBy().empty());
+
+    json orderJson = json::array({
+        {{"column", "region"}, {"order", "asc"}},
+        {{"column", "amount"}, {"order", "desc"}}
+    });
+    auto sorted = df.orderBy(orderJson);
+
+    SortOrder expected = {{"region", true}, {"amount", false}};
+    REQUIRE(sorted->getSortedBy() == expected);
+    REQUIRE(sorted->isSortedBy({{"region", true}}));
+    REQUIRE_FALSE(sorted->isSortedBy({{"amount", false}}));
+}
+
+TEST_CASE("orderBy on already sorted prefix keeps row order", "[DataFrameSorter][sortedness]") {
+    DataFrame df;
+    df.addIntColumn("key");
+    df.addIntColumn("seq");
+    df.addRow({"1", "2"});
+    df.addRow({"1", "1"});
+    df.addRow({"2", "0"});
+
+    REQUIRE(df.declareSortedBy({{"key", true}}));
+
+    auto sorted = df.orderBy(json::array({{{"column", "key"}, {"order", "asc"}}}));
+
+    auto seq = std::dynamic_pointer_cast<IntColumn>(sorted->getColumn("seq"));
+    REQUIRE(seq->at(0) == 2);
+    REQUIRE(seq->at(1) == 1);
+    REQUIRE(seq->at(2) == 0);
+    REQUIRE(sorted->isSortedBy({{"key", true}}));
+}
+
+TEST_CASE("Secondary sort keeps previous order as tie-breaker", "[DataFrameSorter][sortedness]") {
+    DataFrame df;
+    df.addIntColumn("a");
+    df.addIntColumn("b");
+    df.addRow({"1", "1"});
+    df.addRow({"2", "1"});
+    df.addRow({"1", "2"});
+
+    auto byA = df.orderBy(json::array({{{"column", "a"}, {"order", "asc"}}}));
+    auto byB = byA->orderBy(json::array({{{"column", "b"}, {"order", "asc"}}}));
+
+    SortOrder expected = {{"b", true}, {"a", true}};
+    REQUIRE(byB->getSortedBy() == expected);
+}
+
+TEST_CASE("declareSortedBy rejects unsorted data", "[DataFrameSorter][sortedness]") {
+    DataFrame df;
+    df.addIntColumn("value");
+    df.addRow({"3"});
+    df.addRow({"1"});
+
+    REQUIRE_FALSE(df.declareSortedBy({{"value", true}}));
+    REQUIRE(df.getSortedBy().empty());
+    REQUIRE(df.declareSortedBy({{"value", false}}));
+    REQUIRE_FALSE(df.declareSortedBy({{"missing", true}}));
+}
+
+TEST_CASE("Sortedness survives filter and select, not mutation", "[DataFrameSorter][sortedness]") {
+    DataFrame df;
+    df.addIntColumn("a");
+    df.addIntColumn("b");
+    df.addRow({"1", "5"});
+    df.addRow({"2", "4"});
+    df.addRow({"3", "3"});
+    REQUIRE(df.declareSortedBy({{"a", true}, {"b", true}}));
+
+    auto filtered = df.filter(json::array({
+        {{"column", "b"}, {"operator", ">="}, {"value", 4}}
+    }));
+    REQUIRE(filtered->isSortedBy({{"a", true}}));
+
+    auto selected = df.select({"b"});
+    REQUIRE(selected->getSortedBy().empty());
+
+    df.addRow({"0", "0"});
+    REQUIRE(df.getSortedBy().empty());
+}
+
+TEST_CASE("parseSortSpec parses direction suffixes", "[DataFrameSorter][sortedness]") {
+    auto order = DataFrameSorter::parseSortSpec("region, amount DESC ,id asc");
+    SortOrder expected = {{"region", true}, {"amount", false}, {"id", true}};
+    REQUIRE(order == expected);
+    REQUIRE(DataFrameSorter::parseSortSpec("").empty());
+}
+
+TEST_CASE("Sort stops when the execution is cancelled", "[DataFrameSorter][cancellation]") {
+    DataFrame df;
+    df.addIntColumn("value");
+    df.addRow({"30"});
+    df.addRow({"10"});
+
+    json orderJson = json::array({{{"column", "value"}, {"order", "asc"}}});
+
+    CancellationToken token;
+    CancellationScope scope(&token);
+    REQUIRE(df.orderBy(orderJson)->rowCount() == 2);
+
+    token.cancel();
+    REQUIRE_THROWS_AS(df.orderBy(orderJson), OperationCancelled);
+}
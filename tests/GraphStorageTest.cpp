@@ -5,15 +5,23 @@
 #include "nodes/nodes/common/ScalarNodes.hpp"
 #include <filesystem>
 #include <cstdio>
+#include <atomic>
+#include <unistd.h>
 
 using namespace storage;
 using namespace nodes;
 
+// Unique per process: ctest may run test cases as parallel processes
+static std::string uniqueSuffix() {
+    static std::atomic<int> counter{0};
+    return std::to_string(::getpid()) + "_" + std::to_string(counter++);
+}
+
 // Helper to create a temporary database file
 class TempDatabase {
 public:
     TempDatabase() : m_path("/tmp/test_graph_storage_" +
-                            std::to_string(std::rand()) + ".db") {}
+                            uniqueSuffix() + ".db") {}
 
     ~TempDatabase() {
         std::filesystem::remove(m_path);
@@ -388,6 +396,60 @@ TEST_CASE("Load non-existent version throws", "[GraphStorage][Roundtrip]") {
     REQUIRE_THROWS(db.loadVersion(99999));
 }
 
+TEST_CASE("Compiled graphs are cached per version", "[GraphStorage][CompiledCache]") {
+    StorageTestFixture fixture;
+    TempDatabase tempDb;
+    GraphStorage db(tempDb.path());
+
+    db.createGraph({.slug = "cached", .name = "Cached"});
+    NodeGraph v1Graph;
+    auto node = v1Graph.addNode("int_value");
+    v1Graph.setProperty(node, "_identifier", Workload("count", NodeType::String));
+    int64_t v1Id = db.saveVersion("cached", v1Graph, "v1");
+
+    auto first = db.loadCompiled("cached");
+    REQUIRE(first->versionId == v1Id);
+    REQUIRE(first->plan->size() == 1);
+    REQUIRE(first->plan->nodes()[0].definition != nullptr);
+    REQUIRE(first->identifiers.at("count").first == node);
+    REQUIRE(db.loadCompiled("cached") == first);
+    REQUIRE(db.loadCompiled("cached", v1Id) == first);
+
+    // A new version becomes the latest, v1 stays cached
+    NodeGraph v2Graph;
+    v2Graph.addNode("int_value");
+    v2Graph.addNode("int_value");
+    int64_t v2Id = db.saveVersion("cached", v2Graph, "v2");
+    auto latest = db.loadCompiled("cached");
+    REQUIRE(latest->versionId == v2Id);
+    REQUIRE(latest->plan->size() == 2);
+    REQUIRE(db.loadCompiled("cached", v1Id) == first);
+
+    db.deleteGraph("cached");
+    REQUIRE_THROWS(db.loadCompiled("cached"));
+    REQUIRE_THROWS(db.loadCompiled("cached", v1Id));
+}
+
+TEST_CASE("Compiled graph cache evicts least recently used versions", "[GraphStorage][CompiledCache]") {
+    TempDatabase tempDb;
+    GraphStorage db(tempDb.path());
+    db.setCompiledCacheCapacity(1);
+
+    db.createGraph({.slug = "a", .name = "A"});
+    db.createGraph({.slug = "b", .name = "B"});
+    NodeGraph graph;
+    graph.addNode("int_value");
+    db.saveVersion("a", graph);
+    db.saveVersion("b", graph);
+
+    auto a = db.loadCompiled("a");
+    REQUIRE(db.loadCompiled("a") == a);
+    db.loadCompiled("b");
+    auto reloaded = db.loadCompiled("a");
+    REQUIRE(reloaded != a);
+    REQUIRE(reloaded->versionId == a->versionId);
+}
+
 // =============================================================================
 // Edge Cases
 // =============================================================================
@@ -538,6 +600,38 @@ TEST_CASE("Delete graph cascades to parameter overrides", "[GraphStorage][Parame
     REQUIRE(overrides.empty());
 }
 
+TEST_CASE("DataFrame parameter overrides are stored as binary", "[GraphStorage][ParameterOverrides]") {
+    TempDatabase tempDb;
+    GraphStorage db(tempDb.path());
+
+    db.createGraph({.slug = "param-test", .name = "Param Test"});
+    db.setParameterOverride("param-test", "threshold", R"({"type":"int","value":42})");
+
+    dataframe::DataFrame df;
+    df.addStringColumn("region");
+    df.addDoubleColumn("amount");
+    df.addRow({"North", "1.5"});
+    df.addRow({"South", "2.5"});
+    db.setParameterOverrideFrame("param-test", "sales", df);
+
+    auto frames = db.getParameterOverrideFrames("param-test");
+    REQUIRE(frames.size() == 1);
+    REQUIRE(frames["sales"]->rowCount() == 2);
+    REQUIRE(frames["sales"]->getColumnNames() == df.getColumnNames());
+
+    // Listed with its description, without a "value" member
+    auto overrides = db.getParameterOverrides("param-test");
+    REQUIRE(overrides.size() == 2);
+    auto header = nlohmann::json::parse(overrides["sales"]);
+    REQUIRE(header["type"] == "csv");
+    REQUIRE(header["rows"] == 2);
+    REQUIRE_FALSE(header.contains("value"));
+
+    // A JSON override replaces the binary one
+    db.setParameterOverride("param-test", "sales", R"({"type":"int","value":1})");
+    REQUIRE(db.getParameterOverrideFrames("param-test").empty());
+}
+
 TEST_CASE("Get parameter overrides for non-existent graph returns empty", "[GraphStorage][ParameterOverrides]") {
     TempDatabase tempDb;
     GraphStorage db(tempDb.path());
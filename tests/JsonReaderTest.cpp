@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/DataFrameSerializer.hpp"
+#include "dataframe/JsonReader.hpp"
+#include "dataframe/JsonWriter.hpp"
+#include <string>
+
+using namespace dataframe;
+
+namespace {
+
+std::string cell(const DataFrame& df, const std::string& column, size_t row) {
+    auto col = std::dynamic_pointer_cast<StringColumn>(df.getColumn(column));
+    return col ? col->at(row) : "<not a string column>";
+}
+
+} // namespace
+
+// =============================================================================
+// Round-trip Tests
+// =============================================================================
+
+TEST_CASE("JsonReader round-trips toJsonWithSchema", "[JsonReader]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addDoubleColumn("price");
+    df.addStringColumn("name");
+    df.addRow({"1", "3", "plain"});
+    df.addRow({"-2", "0.1", "say \"hi\"\n"});
+    auto getter = [&df](const std::string& name) { return df.getColumn(name); };
+
+    // dump() trie les clés : "schema" arrive après "data"
+    auto text = DataFrameSerializer::toJsonWithSchema(df.rowCount(), df.getColumnNames(), getter).dump();
+    auto loaded = JsonReader::parse(text);
+
+    REQUIRE(loaded->getColumnNames() == df.getColumnNames());
+    REQUIRE(loaded->getColumn("id")->getType() == ColumnTypeOpt::INT);
+    REQUIRE(loaded->getColumn("price")->getType() == ColumnTypeOpt::DOUBLE);
+    REQUIRE(std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("price"))->data() ==
+            std::vector<double>{3.0, 0.1});
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->data() == std::vector<int>{1, -2});
+    REQUIRE(cell(*loaded, "name", 1) == "say \"hi\"\n");
+}
+
+TEST_CASE("JsonReader reads the stored columns, schema and data fields", "[JsonReader]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addStringColumn("city");
+    for (int i = 0; i < 5000; ++i) {
+        df.addRow({std::to_string(i), "city_" + std::to_string(i % 7)});
+    }
+    auto columns = df.getColumnNames();
+    auto getter = [&df](const std::string& name) { return df.getColumn(name); };
+    JsonWriter data;
+    data.rows(0, df.rowCount(), columns, getter);
+
+    auto loaded = JsonReader::parse(json(columns).dump(),
+                                    DataFrameSerializer::schemaToJson(columns, getter).dump(),
+                                    data.str());
+    REQUIRE(loaded->rowCount() == 5000);
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->at(4999) == 4999);
+    REQUIRE(cell(*loaded, "city", 4999) == "city_1");
+    REQUIRE(loaded->getStringPool()->size() == 7);
+}
+
+// =============================================================================
+// Typing Tests
+// =============================================================================
+
+TEST_CASE("JsonReader applies a schema read before data", "[JsonReader]") {
+    auto loaded = JsonReader::parse(R"({
+        "columns": ["a", "b", "c"],
+        "schema": [{"name": "a", "type": "INT"}, {"name": "b", "type": "DOUBLE"}, {"name": "c", "type": "STRING"}],
+        "data": [["7", 2, 1], ["x", "2.5", null], [3.9, true, 1.5]]
+    })");
+
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("a"))->data() == std::vector<int>{7, 0, 3});
+    REQUIRE(std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("b"))->data() ==
+            std::vector<double>{2.0, 2.5, 0.0});
+    REQUIRE(cell(*loaded, "c", 0) == "1");
+    REQUIRE(cell(*loaded, "c", 1) == "");
+    REQUIRE(cell(*loaded, "c", 2) == std::to_string(1.5));
+}
+
+TEST_CASE("JsonReader infers and promotes types without a schema", "[JsonReader]") {
+    auto loaded = JsonReader::parse(R"({
+        "data": [[1, 1, "x", {"k": [1, 2]}], [2, 2.5, "y"], [3, "z"]],
+        "columns": ["ints", "mixed", "text", "nested"]
+    })");
+
+    REQUIRE(loaded->rowCount() == 3);
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("ints"))->data() == std::vector<int>{1, 2, 3});
+    // int → double → string
+    REQUIRE(loaded->getColumn("mixed")->getType() == ColumnTypeOpt::STRING);
+    REQUIRE(cell(*loaded, "mixed", 2) == "z");
+    // Lignes courtes complétées
+    REQUIRE(cell(*loaded, "text", 2) == "");
+    REQUIRE(cell(*loaded, "nested", 0) == R"({"k":[1,2]})");
+    REQUIRE(cell(*loaded, "nested", 1) == "");
+}
+
+TEST_CASE("JsonReader promotes integers beyond INT range to DOUBLE", "[JsonReader]") {
+    auto loaded = JsonReader::parse(R"({
+        "columns": ["id", "big"],
+        "data": [[1, 7], [2, 3000000000], [3, 18446744073709551615]]
+    })");
+
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->data() == std::vector<int>{1, 2, 3});
+    auto big = std::dynamic_pointer_cast<DoubleColumn>(loaded->getColumn("big"));
+    REQUIRE(big);
+    REQUIRE(big->at(0) == 7.0);
+    REQUIRE(big->at(1) == 3000000000.0);
+    REQUIRE(big->at(2) == 18446744073709551615.0);
+
+    // A schema that imposes INT rejects the value instead of truncating it
+    REQUIRE_THROWS_AS(JsonReader::parse(R"({
+        "schema": [{"name": "id", "type": "INT"}],
+        "columns": ["id"],
+        "data": [[2147483648]]
+    })"), std::runtime_error);
+}
+
+// =============================================================================
+// Member and Error Tests
+// =============================================================================
+
+TEST_CASE("JsonReader reads a DataFrame nested under a member", "[JsonReader]") {
+    auto loaded = JsonReader::parse(
+        R"({"type": "csv", "value": {"columns": ["id"], "data": [[1], [2]]}, "extra": [[9]]})", "value");
+    REQUIRE(loaded->rowCount() == 2);
+    REQUIRE(std::dynamic_pointer_cast<IntColumn>(loaded->getColumn("id"))->at(1) == 2);
+}
+
+TEST_CASE("JsonReader rejects invalid documents", "[JsonReader]") {
+    REQUIRE_THROWS_AS(JsonReader::parse(R"({"columns": ["a"], "data": [[1])"), std::runtime_error);
+    REQUIRE_THROWS_AS(JsonReader::parse(R"({"columns": ["a"]})"), std::runtime_error);
+    REQUIRE_THROWS_AS(JsonReader::parse(R"({"type": "csv"})", "value"), std::runtime_error);
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/DataFrame.hpp"
+#include "dataframe/DataFrameSerializer.hpp"
+#include "dataframe/JsonWriter.hpp"
+#include <limits>
+#include <string>
+
+using namespace dataframe;
+
+// =============================================================================
+// Primitive Tests
+// =============================================================================
+
+TEST_CASE("JsonWriter escapes strings like nlohmann", "[JsonWriter]") {
+    std::string control;
+    for (char c = 1; c < 0x20; ++c) control.push_back(c);
+    std::string samples[] = {
+        "plain",
+        "",
+        "say \"hi\"",
+        "back\\slash",
+        "two\nlines\tand\rmore",
+        control,
+        "caf\xC3\xA9 \xE2\x82\xAC",                              // UTF-8 recopié
+        "a long string with a \"quote\" after the first SSE block\n",
+    };
+
+    for (const auto& sample : samples) {
+        std::string out;
+        JsonWriter::appendString(out, sample);
+        REQUIRE(out == json(sample).dump());
+    }
+}
+
+TEST_CASE("JsonWriter formats numbers with to_chars", "[JsonWriter]") {
+    JsonWriter out;
+    out.beginArray()
+        .value(0).value(-42).value(int64_t{1} << 40)
+        .value(0.1).value(3.0).value(-1e-300)
+        .value(std::numeric_limits<double>::quiet_NaN())
+        .value(std::numeric_limits<double>::infinity())
+        .value(true).null()
+        .endArray();
+
+    REQUIRE(out.str() == "[0,-42,1099511627776,0.1,3.0,-1e-300,null,null,true,null]");
+
+    auto parsed = json::parse(out.str());
+    REQUIRE(parsed[3].get<double>() == 0.1);
+    REQUIRE(parsed[4].is_number_float());
+}
+
+TEST_CASE("JsonWriter nests objects and arrays", "[JsonWriter]") {
+    JsonWriter out;
+    out.beginObject();
+    out.key("status").value("ok");
+    out.key("stats").beginObject().key("rows").value(2).key("empty").beginArray().endArray().endObject();
+    out.key("meta").value(json{{"a", 1}});
+    out.key("raw").raw("[1,2]");
+    out.endObject();
+
+    REQUIRE(json::parse(out.str()) ==
+            json{{"status", "ok"}, {"stats", {{"rows", 2}, {"empty", json::array()}}},
+                 {"meta", {{"a", 1}}}, {"raw", {1, 2}}});
+}
+
+// =============================================================================
+// DataFrame Tests
+// =============================================================================
+
+TEST_CASE("JsonWriter encodes DataFrame pages like rowsToJson", "[JsonWriter]") {
+    DataFrame df;
+    df.addIntColumn("id");
+    df.addDoubleColumn("value");
+    df.addStringColumn("label");
+    for (int i = 0; i < 1000; ++i) {
+        df.addRow({std::to_string(i), std::to_string(i / 8.0),
+                   i % 3 == 0 ? "with \"quotes\"" : "label_" + std::to_string(i % 10)});
+    }
+    auto columns = df.getColumnNames();
+    auto getter = [&df](const std::string& name) { return df.getColumn(name); };
+
+    SECTION("Row layout") {
+        JsonWriter out;
+        out.rows(100, 350, columns, getter);
+        REQUIRE(json::parse(out.str()) == DataFrameSerializer::rowsToJson(100, 350, columns, getter));
+    }
+
+    SECTION("Columnar layout") {
+        JsonWriter out;
+        out.columns(10, 13, columns, getter);
+        REQUIRE(json::parse(out.str()) ==
+                json{{"id", {10, 11, 12}},
+                     {"value", {1.25, 1.375, 1.5}},
+                     {"label", {"label_0", "label_1", "with \"quotes\""}}});
+    }
+
+    SECTION("Document with schema") {
+        JsonWriter out;
+        DataFrameSerializer::writeWithSchema(out, df.rowCount(), columns, getter);
+        REQUIRE(json::parse(out.str()) == DataFrameSerializer::toJsonWithSchema(df.rowCount(), columns, getter));
+    }
+
+    SECTION("Empty page") {
+        JsonWriter out;
+        out.beginObject().key("data").rows(1000, 1000, columns, getter).endObject();
+        REQUIRE(out.str() == "{\"data\":[]}");
+    }
+}
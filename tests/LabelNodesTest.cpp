@@ -5,6 +5,8 @@
 #include "nodes/LabelRegistry.hpp"
 #include "nodes/nodes/common/ScalarNodes.hpp"
 #include "nodes/nodes/common/LabelNodes.hpp"
+#include <algorithm>
+#include <thread>
 
 using namespace nodes;
 
@@ -46,9 +48,10 @@ TEST_CASE("label_define_int stores value in registry", "[Labels]") {
 
     REQUIRE(exec.hasErrors() == false);
 
-    // Check that label was stored
-    REQUIRE(LabelRegistry::instance().hasLabel("my_label"));
-    REQUIRE(LabelRegistry::instance().getLabel("my_label").getInt() == 42);
+    // Check that label was stored in the execution's scope
+    REQUIRE(exec.labels().hasLabel("my_label"));
+    REQUIRE(exec.labels().getLabel("my_label").getInt() == 42);
+    REQUIRE_FALSE(LabelRegistry::instance().hasLabel("my_label"));
 
     // Check pass-through output
     REQUIRE(results[defineNode]["value"].getInt() == 42);
@@ -168,7 +171,7 @@ TEST_CASE("labels are cleared between executions", "[Labels]") {
         exec.execute(graph);
 
         // Label should exist after first execution
-        REQUIRE(LabelRegistry::instance().hasLabel("temp_label"));
+        REQUIRE(exec.labels().hasLabel("temp_label"));
     }
 
     // Second execution: try to use the label (should fail because cleared)
@@ -184,3 +187,35 @@ TEST_CASE("labels are cleared between executions", "[Labels]") {
         REQUIRE(exec.hasErrors() == true);
     }
 }
+
+TEST_CASE("concurrent executions have separate label scopes", "[Labels]") {
+    LabelNodesFixture fixture;
+
+    // int_value(v) -> label_define_int("shared"); label_ref_int("shared")
+    auto run = [](int64_t value, std::vector<int64_t>& seen) {
+        NodeGraph graph;
+        auto intNode = graph.addNode("int_value");
+        graph.setProperty(intNode, "_value", Workload(value, NodeType::Int));
+        auto defineNode = graph.addNode("label_define_int");
+        graph.setProperty(defineNode, "_label", Workload("shared", NodeType::String));
+        graph.connect(intNode, "value", defineNode, "value");
+        auto refNode = graph.addNode("label_ref_int");
+        graph.setProperty(refNode, "_label", Workload("shared", NodeType::String));
+
+        auto plan = ExecutionPlan::compile(graph, NodeRegistry::instance());
+        NodeExecutor exec(NodeRegistry::instance());
+        for (int i = 0; i < 200; ++i) {
+            auto results = exec.execute(plan);
+            seen.push_back(results[refNode]["value"].getInt());
+        }
+    };
+
+    std::vector<int64_t> seenA, seenB;
+    std::thread a(run, 1, std::ref(seenA));
+    std::thread b(run, 2, std::ref(seenB));
+    a.join();
+    b.join();
+
+    REQUIRE(std::count(seenA.begin(), seenA.end(), 1) == 200);
+    REQUIRE(std::count(seenB.begin(), seenB.end(), 2) == 200);
+}
@@ -220,6 +220,55 @@ TEST_CASE("NodeContext getStringAtRow with field", "[NodeContext][Broadcasting]"
     REQUIRE(ctx.getStringAtRow("val", 1) == "Bob");
 }
 
+TEST_CASE("NodeContext typed column views", "[NodeContext][Broadcasting]") {
+    NodeContext ctx;
+
+    auto df = std::make_shared<DataFrame>();
+    df->addIntColumn("count");
+    df->addDoubleColumn("price");
+    df->addStringColumn("label");
+    df->addRow({"10", "1.5", "7"});
+    df->addRow({"20", "2.5", "8.5"});
+    df->addRow({"30", "3.5", "7"});
+    ctx.setActiveCsv(df);
+
+    SECTION("Scalars broadcast as constant views") {
+        ctx.setInput("val", Workload(int64_t(4), NodeType::Int));
+        auto view = ctx.numericView("val");
+        REQUIRE(view.isConstant());
+        REQUIRE(view[0] == 4.0);
+        REQUIRE(view[2] == 4.0);
+        REQUIRE(ctx.stringView("val")[1] == "4");
+    }
+
+    SECTION("Numeric columns are read in place") {
+        ctx.setInput("count", Workload("count", NodeType::Field));
+        ctx.setInput("price", Workload("price", NodeType::Field));
+        auto counts = ctx.numericView("count");
+        auto prices = ctx.numericView<int64_t>("price");
+        REQUIRE_FALSE(counts.isConstant());
+        REQUIRE(counts[1] == 20.0);
+        REQUIRE(prices[1] == 2);
+        REQUIRE(ctx.stringView("count")[2] == "30");
+    }
+
+    SECTION("String columns are parsed or read from the pool") {
+        ctx.setInput("label", Workload("label", NodeType::Field));
+        auto numbers = ctx.numericView("label");
+        REQUIRE(numbers[0] == 7.0);
+        REQUIRE(numbers[1] == 8.5);
+        REQUIRE(numbers[2] == 7.0);
+        REQUIRE(ctx.numericView<int64_t>("label")[1] == 8);
+        REQUIRE(ctx.stringView("label")[1] == "8.5");
+    }
+
+    SECTION("Missing columns are reported once") {
+        ctx.setInput("val", Workload("missing", NodeType::Field));
+        REQUIRE_THROWS_WITH(ctx.numericView("val"),
+                            "Column 'missing' not found. Available: 'count', 'price', 'label'");
+    }
+}
+
 // =============================================================================
 // NodeDefinition Tests
 // =============================================================================
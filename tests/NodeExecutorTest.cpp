@@ -3,6 +3,11 @@
 #include "nodes/NodeRegistry.hpp"
 #include "nodes/NodeExecutor.hpp"
 #include "dataframe/DataFrame.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 using namespace nodes;
 using namespace dataframe;
@@ -565,3 +570,871 @@ TEST_CASE("NodeExecutor with field and scalar broadcasting", "[NodeExecutor][CSV
     REQUIRE(resultCol->at(1) == 25.0);
     REQUIRE(resultCol->at(2) == 35.0);
 }
+
+// =============================================================================
+// NodeExecutor Parallel Execution
+// =============================================================================
+
+TEST_CASE("NodeExecutor parallel runs independent branches concurrently", "[NodeExecutor][Parallel]") {
+    NodeRegistry reg;
+
+    NodeBuilder("slow_source", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([](NodeContext& ctx) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            auto prop = ctx.getInputWorkload("_value");
+            ctx.setOutput("value", prop.getInt());
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("add", "test")
+        .input("a", Type::Int)
+        .input("b", Type::Int)
+        .output("result", Type::Int)
+        .onCompile([](NodeContext& ctx) {
+            ctx.setOutput("result", ctx.getInputWorkload("a").getInt() + ctx.getInputWorkload("b").getInt());
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto n1 = graph.addNode("slow_source");
+    auto n2 = graph.addNode("slow_source");
+    auto nAdd = graph.addNode("add");
+    graph.setProperty(n1, "_value", Workload(int64_t(3), Type::Int));
+    graph.setProperty(n2, "_value", Workload(int64_t(4), Type::Int));
+    graph.connect(n1, "value", nAdd, "a");
+    graph.connect(n2, "value", nAdd, "b");
+
+    NodeExecutor exec(reg);
+    ExecutionOptions options;
+    options.threads = 4;
+    exec.setOptions(options);
+
+    // Callbacks run on the calling thread: Started then Completed for each node
+    auto callerThread = std::this_thread::get_id();
+    std::vector<ExecutionEvent> events;
+    bool sameThread = true;
+    exec.setExecutionCallback([&](const ExecutionEvent& evt) {
+        sameThread = sameThread && std::this_thread::get_id() == callerThread;
+        events.push_back(evt);
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    auto results = exec.execute(graph);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(results[nAdd]["result"].getInt() == 7);
+    REQUIRE(elapsed < std::chrono::milliseconds(380));
+    REQUIRE(sameThread);
+    REQUIRE(events.size() == 6);
+    for (const auto& nodeId : {n1, n2, nAdd}) {
+        auto started = std::find_if(events.begin(), events.end(), [&](const ExecutionEvent& e) {
+            return e.nodeId == nodeId && e.status == ExecutionStatus::Started;
+        });
+        auto completed = std::find_if(events.begin(), events.end(), [&](const ExecutionEvent& e) {
+            return e.nodeId == nodeId && e.status == ExecutionStatus::Completed;
+        });
+        REQUIRE(started != events.end());
+        REQUIRE(completed != events.end());
+        REQUIRE(started < completed);
+    }
+    REQUIRE(events.back().nodeId == nAdd);
+}
+
+TEST_CASE("NodeExecutor parallel respects label define -> ref edges", "[NodeExecutor][Parallel]") {
+    NodeRegistry reg;
+    std::atomic<int64_t> label{0};
+
+    NodeBuilder("label_define_test", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([&label](NodeContext& ctx) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            label = 42;
+            ctx.setOutput("value", int64_t(42));
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("label_ref_test", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([&label](NodeContext& ctx) {
+            ctx.setOutput("value", label.load());
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto nRef = graph.addNode("label_ref_test");
+    auto nDefine = graph.addNode("label_define_test");
+    graph.setProperty(nDefine, "_label", Workload("total", Type::String));
+    graph.setProperty(nRef, "_label", Workload("total", Type::String));
+
+    NodeExecutor exec(reg);
+    ExecutionOptions options;
+    options.threads = 4;
+    exec.setOptions(options);
+    auto results = exec.execute(graph);
+
+    REQUIRE(results[nRef]["value"].getInt() == 42);
+}
+
+TEST_CASE("NodeExecutor parallel serializes nodes sharing a StringPool", "[NodeExecutor][Parallel][CSV]") {
+    NodeRegistry reg;
+    std::atomic<int> active{0};
+    std::atomic<int> maxActive{0};
+
+    NodeBuilder("csv_source", "test")
+        .output("csv", Type::Csv)
+        .entryPoint()
+        .onCompile([](NodeContext& ctx) {
+            auto df = std::make_shared<DataFrame>();
+            df->addStringColumn("name");
+            df->addRow({"a"});
+            ctx.setOutput("csv", df);
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("intern", "test")
+        .input("csv", Type::Csv)
+        .output("count", Type::Int)
+        .onCompile([&](NodeContext& ctx) {
+            int now = ++active;
+            maxActive = std::max(maxActive.load(), now);
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            --active;
+            ctx.setOutput("count", static_cast<int64_t>(ctx.getInputWorkload("csv").getCsv()->rowCount()));
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto source = graph.addNode("csv_source");
+    std::vector<std::string> consumers;
+    for (int i = 0; i < 3; ++i) {
+        consumers.push_back(graph.addNode("intern"));
+        graph.connect(source, "csv", consumers.back(), "csv");
+    }
+
+    NodeExecutor exec(reg);
+    ExecutionOptions options;
+    options.threads = 4;
+    exec.setOptions(options);
+    auto results = exec.execute(graph);
+
+    REQUIRE(maxActive == 1);
+    for (const auto& consumer : consumers) {
+        REQUIRE(results[consumer]["count"].getInt() == 1);
+    }
+}
+
+TEST_CASE("NodeExecutor parallel rethrows node exceptions", "[NodeExecutor][Parallel]") {
+    NodeRegistry reg;
+
+    NodeBuilder("throwing", "test")
+        .output("x", Type::Int)
+        .entryPoint()
+        .onCompile([](NodeContext&) {
+            throw std::runtime_error("boom");
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    graph.addNode("throwing");
+    graph.addNode("throwing");
+
+    NodeExecutor exec(reg);
+    ExecutionOptions options;
+    options.threads = 2;
+    exec.setOptions(options);
+    REQUIRE_THROWS_WITH(exec.execute(graph), "boom");
+}
+
+// =============================================================================
+// ExecutionPlan
+// =============================================================================
+
+TEST_CASE("ExecutionPlan resolves slots and input bindings", "[ExecutionPlan]") {
+    NodeRegistry reg;
+
+    NodeBuilder("const", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([](NodeContext& ctx) {
+            ctx.setOutput("value", ctx.getInputWorkload("_value").getInt());
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("add", "test")
+        .input("a", Type::Int)
+        .input("b", Type::Int)
+        .output("result", Type::Int)
+        .onCompile([](NodeContext& ctx) {
+            ctx.setOutput("result", ctx.getInputWorkload("a").getInt() + ctx.getInputWorkload("b").getInt());
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto nAdd = graph.addNode("add");
+    auto n1 = graph.addNode("const");
+    auto n2 = graph.addNode("const");
+    auto nFields = graph.addNode("scalar/string_as_fields");
+    graph.setProperty(n1, "_value", Workload(int64_t(3), Type::Int));
+    graph.setProperty(n2, "_value", Workload(int64_t(4), Type::Int));
+    graph.connect(n1, "value", nAdd, "a");
+    graph.connect(n2, "value", nAdd, "b");
+    graph.connect(nFields, "value", n1, "field");
+
+    auto plan = ExecutionPlan::compile(graph, reg);
+    REQUIRE(plan->size() == 4);
+
+    size_t addSlot = plan->slotOf(nAdd);
+    const auto& addNode = plan->nodes()[addSlot];
+    REQUIRE(addNode.definition != nullptr);
+    REQUIRE(addNode.dependencyCount == 2);
+    REQUIRE(addNode.inputs.size() == 2);
+    REQUIRE(addNode.inputs[0].source == plan->slotOf(n1));
+    REQUIRE(addNode.inputs[0].targetPort == "a");
+    REQUIRE(addNode.inputs[1].source == plan->slotOf(n2));
+    REQUIRE(plan->slotOf(n1) < addSlot);
+    REQUIRE(plan->slotOf(n2) < addSlot);
+    REQUIRE(plan->slotOf("missing") == ExecutionPlan::npos);
+
+    const auto& n1Node = plan->nodes()[plan->slotOf(n1)];
+    REQUIRE(n1Node.inputs.size() == 1);
+    REQUIRE(n1Node.inputs[0].expandFields);
+    REQUIRE(plan->nodes()[plan->slotOf(nFields)].definition == nullptr);
+}
+
+TEST_CASE("ExecutionPlan is reusable across executions", "[ExecutionPlan]") {
+    NodeRegistry reg;
+
+    NodeBuilder("source", "test")
+        .output("csv", Type::Csv)
+        .entryPoint()
+        .onCompile([](NodeContext& ctx) {
+            auto df = std::make_shared<DataFrame>();
+            df->addIntColumn("id");
+            df->addRow({"1"});
+            ctx.setOutput("csv", df);
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("count", "test")
+        .input("csv", Type::Csv)
+        .output("count", Type::Int)
+        .onCompile([](NodeContext& ctx) {
+            ctx.setOutput("count", static_cast<int64_t>(ctx.getActiveCsv()->rowCount()));
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto nSource = graph.addNode("source");
+    auto nCount = graph.addNode("count");
+    graph.setProperty(nSource, "_identifier", Workload("sales", Type::String));
+    graph.connect(nSource, "csv", nCount, "csv");
+
+    auto plan = ExecutionPlan::compile(graph, reg);
+    graph.removeNode(nCount);  // The plan holds its own copy
+
+    auto injected = std::make_shared<DataFrame>();
+    injected->addIntColumn("id");
+    injected->addRow({"1"});
+    injected->addRow({"2"});
+    injected->addRow({"3"});
+
+    NodeExecutor exec(reg);
+    REQUIRE(exec.execute(plan)[nCount]["count"].getInt() == 1);
+    REQUIRE(exec.execute(plan, {{"sales", injected}})[nCount]["count"].getInt() == 3);
+    REQUIRE(exec.getResult(nCount) != nullptr);
+    REQUIRE(exec.execute(plan)[nCount]["count"].getInt() == 1);
+}
+
+TEST_CASE("ExecutionPlan runs concurrently on a shared input frame", "[ExecutionPlan]") {
+    NodeRegistry reg;
+
+    // Shared by every execution, like a plan's Csv property or a memoized source
+    auto shared = std::make_shared<DataFrame>();
+    shared->addIntColumn("id");
+    for (int i = 0; i < 2000; ++i) {
+        shared->addRow({std::to_string(i)});
+    }
+
+    NodeBuilder("source", "test")
+        .output("csv", Type::Csv)
+        .entryPoint()
+        .onCompile([shared](NodeContext& ctx) {
+            ctx.setOutput("csv", shared);
+        })
+        .buildAndRegister(reg);
+
+    // Interns run-specific strings into the input frame's pool, as string nodes do
+    std::atomic<int> runs{0};
+    NodeBuilder("label", "test")
+        .input("csv", Type::Csv)
+        .output("csv", Type::Csv)
+        .onCompile([&runs](NodeContext& ctx) {
+            auto csv = ctx.getActiveCsv();
+            std::string prefix = "run" + std::to_string(runs++) + "_";
+            auto labels = std::make_shared<StringColumn>("label", csv->getStringPool());
+            for (size_t i = 0; i < csv->rowCount(); ++i) {
+                labels->push_back(prefix + std::to_string(i));
+            }
+            auto result = std::make_shared<DataFrame>();
+            result->setStringPool(csv->getStringPool());
+            result->addColumn(labels);
+            ctx.setOutput("csv", result);
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto nSource = graph.addNode("source");
+    auto nLabel = graph.addNode("label");
+    graph.connect(nSource, "csv", nLabel, "csv");
+    auto plan = ExecutionPlan::compile(graph, reg);
+
+    constexpr int THREADS = 4;
+    constexpr int ROUNDS = 5;
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&]() {
+            for (int round = 0; round < ROUNDS; ++round) {
+                NodeExecutor exec(reg);
+                auto results = exec.execute(plan);
+                auto labels = std::dynamic_pointer_cast<StringColumn>(
+                    results[nLabel]["csv"].getCsv()->getColumn("label"));
+                std::string prefix = labels->at(0).substr(0, labels->at(0).find('_') + 1);
+                for (size_t i = 0; i < labels->size(); ++i) {
+                    mismatches += labels->at(i) != prefix + std::to_string(i);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(mismatches == 0);
+    REQUIRE(shared->getStringPool()->size() == static_cast<size_t>(THREADS * ROUNDS * 2000));
+}
+
+// =============================================================================
+// NodeExecutor Retention
+// =============================================================================
+
+TEST_CASE("NodeExecutor production retention drops consumed intermediates", "[NodeExecutor][Retention]") {
+    NodeRegistry reg;
+    std::vector<std::weak_ptr<DataFrame>> created;
+
+    NodeBuilder("source", "test")
+        .output("csv", Type::Csv)
+        .entryPoint()
+        .onCompile([&created](NodeContext& ctx) {
+            auto df = std::make_shared<DataFrame>();
+            df->addIntColumn("id");
+            df->addRow({"1"});
+            created.push_back(df);
+            ctx.setOutput("csv", df);
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("copy", "test")
+        .input("csv", Type::Csv)
+        .output("csv", Type::Csv)
+        .output("rows", Type::Int)
+        .onCompile([&created](NodeContext& ctx) {
+            auto df = std::make_shared<DataFrame>(*ctx.getActiveCsv());
+            created.push_back(df);
+            ctx.setOutput("csv", df);
+            ctx.setOutput("rows", static_cast<int64_t>(df->rowCount()));
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("output", "test")
+        .input("csv", Type::Csv)
+        .output("csv", Type::Csv)
+        .output("output_name", Type::String)
+        .onCompile([](NodeContext& ctx) {
+            ctx.setOutput("csv", ctx.getActiveCsv());
+            ctx.setOutput("output_name", Workload("result", Type::String));
+        })
+        .buildAndRegister(reg);
+
+    // source -> copy1 -> copy2 -> output
+    NodeGraph graph;
+    auto nSource = graph.addNode("source");
+    auto nCopy1 = graph.addNode("copy");
+    auto nCopy2 = graph.addNode("copy");
+    auto nOutput = graph.addNode("output");
+    graph.connect(nSource, "csv", nCopy1, "csv");
+    graph.connect(nCopy1, "csv", nCopy2, "csv");
+    graph.connect(nCopy2, "csv", nOutput, "csv");
+    auto plan = ExecutionPlan::compile(graph, reg);
+
+    NodeExecutor exec(reg);
+
+    SECTION("debug keeps every frame") {
+        auto results = exec.execute(plan);
+        REQUIRE(results[nSource].count("csv") == 1);
+        REQUIRE(results[nCopy1].count("csv") == 1);
+        REQUIRE(results[nOutput].count("csv") == 1);
+    }
+
+    SECTION("production keeps outputs and scalars only") {
+        ExecutionOptions options;
+        options.retention = Retention::Outputs;
+        exec.setOptions(options);
+        auto results = exec.execute(plan);
+
+        REQUIRE(results[nSource].count("csv") == 0);
+        REQUIRE(results[nCopy1].count("csv") == 0);
+        REQUIRE(results[nCopy1]["rows"].getInt() == 1);
+        REQUIRE(results[nOutput]["csv"].getCsv()->rowCount() == 1);
+        REQUIRE(exec.getResult(nCopy1) != nullptr);
+
+        // Intermediate frames are freed, the output's frame (copy2) is alive
+        REQUIRE(created.size() == 3);
+        REQUIRE(created[0].expired());
+        REQUIRE(created[1].expired());
+        REQUIRE_FALSE(created[2].expired());
+    }
+
+    SECTION("inspected nodes are kept") {
+        ExecutionOptions options;
+        options.retention = Retention::Outputs;
+        options.keep = {nCopy1};
+        options.threads = 2;
+        exec.setOptions(options);
+        auto results = exec.execute(plan);
+
+        REQUIRE(results[nSource].count("csv") == 0);
+        REQUIRE(results[nCopy1].count("csv") == 1);
+    }
+}
+
+TEST_CASE("NodeExecutor runs only the cone of the targets", "[NodeExecutor][Targets]") {
+    NodeRegistry reg;
+    std::vector<std::string> ran;
+
+    NodeBuilder("value", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([&ran](NodeContext& ctx) {
+            ran.push_back("value");
+            ctx.setOutput("value", ctx.getInputWorkload("_value").getInt());
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("output", "test")
+        .input("value", Type::Int)
+        .output("value", Type::Int)
+        .output("output_name", Type::String)
+        .onCompile([&ran](NodeContext& ctx) {
+            ran.push_back("output");
+            ctx.setOutput("value", ctx.getInputWorkload("value"));
+            ctx.setOutput("output_name", ctx.getInputWorkload("_chart_name"));
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("label_define_int", "test")
+        .input("value", Type::Int)
+        .output("value", Type::Int)
+        .onCompile([&ran](NodeContext& ctx) {
+            ran.push_back("define");
+            ctx.setOutput("value", ctx.getInputWorkload("value"));
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("label_ref_int", "test")
+        .output("value", Type::Int)
+        .onCompile([&ran](NodeContext& ctx) {
+            ran.push_back("ref");
+            ctx.setOutput("value", int64_t(0));
+        })
+        .buildAndRegister(reg);
+
+    // a -> outA ("sales"), b -> define ~> ref -> outB
+    NodeGraph graph;
+    auto nA = graph.addNode("value");
+    auto nOutA = graph.addNode("output");
+    auto nB = graph.addNode("value");
+    auto nDefine = graph.addNode("label_define_int");
+    auto nRef = graph.addNode("label_ref_int");
+    auto nOutB = graph.addNode("output");
+    graph.setProperty(nA, "_value", Workload(int64_t(1)));
+    graph.setProperty(nB, "_value", Workload(int64_t(2)));
+    graph.setProperty(nOutA, "_chart_name", Workload("sales", Type::String));
+    graph.setProperty(nDefine, "_label", Workload("L", Type::String));
+    graph.setProperty(nRef, "_label", Workload("L", Type::String));
+    graph.connect(nA, "value", nOutA, "value");
+    graph.connect(nB, "value", nDefine, "value");
+    graph.connect(nRef, "value", nOutB, "value");
+    auto plan = ExecutionPlan::compile(graph, reg);
+
+    NodeExecutor exec(reg);
+    ExecutionOptions options;
+
+    SECTION("by output name") {
+        options.targets = {"sales"};
+        exec.setOptions(options);
+        auto results = exec.execute(plan);
+
+        REQUIRE(results.size() == 2);
+        REQUIRE(results[nOutA]["value"].getInt() == 1);
+        REQUIRE(exec.getResult(nB) == nullptr);
+        REQUIRE(ran.size() == 2);
+    }
+
+    SECTION("by node id, label definitions included") {
+        options.targets = {nOutB};
+        options.threads = 2;
+        exec.setOptions(options);
+        auto results = exec.execute(plan);
+
+        REQUIRE(results.size() == 4);
+        REQUIRE(results.count(nDefine) == 1);
+        REQUIRE(results.count(nA) == 0);
+        REQUIRE(std::find(ran.begin(), ran.end(), "define") <
+                std::find(ran.begin(), ran.end(), "ref"));
+    }
+
+    SECTION("unknown targets are rejected") {
+        options.targets = {"missing"};
+        exec.setOptions(options);
+        REQUIRE_THROWS_AS(exec.execute(plan), std::invalid_argument);
+    }
+}
+
+TEST_CASE("NodeExecutor memoizes results across executions", "[NodeExecutor][ResultCache]") {
+    NodeRegistry reg;
+    std::unordered_map<std::string, int> runs;
+
+    NodeBuilder("value", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .memoize()
+        .onCompile([&runs](NodeContext& ctx) {
+            runs["value"]++;
+            ctx.setOutput("value", ctx.getInputWorkload("_value").getInt());
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("clock", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .volatileResults()
+        .onCompile([&runs](NodeContext& ctx) {
+            runs["clock"]++;
+            ctx.setOutput("value", static_cast<int64_t>(runs["clock"] / 2));
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("add", "test")
+        .input("a", Type::Int)
+        .input("b", Type::Int)
+        .output("result", Type::Int)
+        .memoize()
+        .onCompile([&runs](NodeContext& ctx) {
+            runs["add"]++;
+            ctx.setOutput("result", ctx.getInputWorkload("a").getInt() + ctx.getInputWorkload("b").getInt());
+        })
+        .buildAndRegister(reg);
+
+    // (a + b) + clock
+    NodeGraph graph;
+    auto nA = graph.addNode("value");
+    auto nB = graph.addNode("value");
+    auto nClock = graph.addNode("clock");
+    auto nSum = graph.addNode("add");
+    auto nTotal = graph.addNode("add");
+    graph.setProperty(nA, "_value", Workload(int64_t(1)));
+    graph.setProperty(nB, "_value", Workload(int64_t(2)));
+    graph.connect(nA, "value", nSum, "a");
+    graph.connect(nB, "value", nSum, "b");
+    graph.connect(nSum, "result", nTotal, "a");
+    graph.connect(nClock, "value", nTotal, "b");
+    auto plan = ExecutionPlan::compile(graph, reg);
+
+    ExecutionOptions options;
+    options.cache = std::make_shared<ResultCache>(16);
+    NodeExecutor exec(reg);
+    exec.setOptions(options);
+
+    // clock returns 0, then 1, 1, 2...
+    auto first = exec.execute(plan);
+    REQUIRE(first[nTotal]["result"].getInt() == 3);
+    REQUIRE(runs == std::unordered_map<std::string, int>{{"value", 2}, {"clock", 1}, {"add", 2}});
+
+    SECTION("volatile nodes always run, unchanged values are reused downstream") {
+        exec.execute(plan);  // clock: 1, total recomputed
+        auto third = exec.execute(plan);  // clock: 1 again, total reused
+        REQUIRE(third[nTotal]["result"].getInt() == 4);
+        REQUIRE(runs["clock"] == 3);
+        REQUIRE(runs["value"] == 2);
+        REQUIRE(runs["add"] == 3);
+    }
+
+    SECTION("only nodes downstream of a changed property run") {
+        PropertyOverlay overlay;
+        overlay.set(plan->slotOf(nB), "_value", Workload(int64_t(5)));
+        std::vector<ExecutionEvent> events;
+        exec.setExecutionCallback([&](const ExecutionEvent& evt) { events.push_back(evt); });
+        auto results = exec.execute(plan, {}, "", overlay);
+
+        REQUIRE(results[nSum]["result"].getInt() == 6);
+        REQUIRE(runs["value"] == 3);  // b only
+        REQUIRE(runs["add"] == 4);    // sum and total
+
+        auto completedA = std::find_if(events.begin(), events.end(), [&](const ExecutionEvent& evt) {
+            return evt.nodeId == nA && evt.status == ExecutionStatus::Completed;
+        });
+        REQUIRE(completedA != events.end());
+        REQUIRE(completedA->cached);
+        REQUIRE(completedA->toJson()["cached"] == true);
+    }
+
+    SECTION("results depend on the user") {
+        exec.execute(plan, {}, "alice");
+        REQUIRE(runs["value"] == 4);
+    }
+
+    SECTION("nodes that do not declare memoize always run") {
+        NodeBuilder("plugin", "test")
+            .output("value", Type::Int)
+            .entryPoint()
+            .onCompile([&runs](NodeContext& ctx) {
+                runs["plugin"]++;
+                ctx.setOutput("value", int64_t(1));
+            })
+            .buildAndRegister(reg);
+        NodeGraph pluginGraph;
+        pluginGraph.addNode("plugin");
+        auto pluginPlan = ExecutionPlan::compile(pluginGraph, reg);
+        exec.execute(pluginPlan);
+        exec.execute(pluginPlan);
+        REQUIRE(runs["plugin"] == 2);
+    }
+
+    SECTION("a disabled cache runs every node") {
+        exec.setOptions(ExecutionOptions{});
+        exec.execute(plan);
+        REQUIRE(runs["value"] == 4);
+        REQUIRE(options.cache->stats().hits == 0);
+    }
+}
+
+TEST_CASE("ResultCache evicts and expires entries", "[ResultCache]") {
+    ResultCache cache(2);
+    auto entry = [](int64_t value) {
+        ResultCache::Entry e;
+        e.outputs["value"] = Workload(value);
+        e.fingerprint = static_cast<uint64_t>(value);
+        return e;
+    };
+
+    cache.put(1, entry(1));
+    cache.put(2, entry(2));
+    REQUIRE(cache.find(1));  // 2 is now the least recently used
+    cache.put(3, entry(3));
+    REQUIRE(cache.size() == 2);
+    REQUIRE_FALSE(cache.find(2));
+    REQUIRE(cache.find(3)->outputs.at("value").getInt() == 3);
+
+    auto expired = entry(4);
+    expired.expiresAt = ResultCache::Clock::now() - std::chrono::seconds(1);
+    cache.put(4, expired);
+    REQUIRE_FALSE(cache.find(4));
+
+    REQUIRE(cache.stats().hits == 2);
+    REQUIRE(cache.stats().misses == 2);
+    REQUIRE(ResultCache::uniqueFingerprint() != ResultCache::uniqueFingerprint());
+}
+
+TEST_CASE("ResultCache is bounded by DataFrame bytes", "[ResultCache]") {
+    auto frameEntry = [](size_t rows) {
+        auto df = std::make_shared<dataframe::DataFrame>();
+        df->addDoubleColumn("x");
+        auto col = std::dynamic_pointer_cast<dataframe::DoubleColumn>(df->getColumn("x"));
+        for (size_t i = 0; i < rows; ++i) col->push_back(static_cast<double>(i));
+        ResultCache::Entry e;
+        e.outputs["csv"] = Workload(df);
+        e.outputs["same"] = Workload(df);  // Counted once
+        return e;
+    };
+
+    ResultCache cache(16, 1000 * sizeof(double));
+    cache.put(1, frameEntry(600));
+    REQUIRE(cache.bytes() == 600 * sizeof(double));
+
+    cache.put(2, frameEntry(600));  // Over budget: 1 is evicted
+    REQUIRE(cache.size() == 1);
+    REQUIRE_FALSE(cache.find(1));
+    REQUIRE(cache.find(2));
+
+    cache.put(3, frameEntry(2000));  // Larger than the budget: not cached
+    REQUIRE_FALSE(cache.find(3));
+    REQUIRE(cache.bytes() == 600 * sizeof(double));
+}
+
+// =============================================================================
+// Cancellation
+// =============================================================================
+
+TEST_CASE("NodeExecutor stops when the execution is cancelled", "[NodeExecutor][Cancellation]") {
+    NodeRegistry reg;
+    std::vector<std::string> ran;
+    auto token = std::make_shared<CancellationToken>();
+
+    NodeBuilder("value", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([&ran](NodeContext& ctx) {
+            ran.push_back("value");
+            ctx.setOutput("value", int64_t(1));
+        })
+        .buildAndRegister(reg);
+
+    NodeBuilder("inc", "test")
+        .input("value", Type::Int)
+        .output("value", Type::Int)
+        .onCompile([&ran](NodeContext& ctx) {
+            ran.push_back("inc");
+            ctx.setOutput("value", ctx.getInputWorkload("value").getInt() + 1);
+        })
+        .buildAndRegister(reg);
+
+    // Cancelled while running, reports the cancellation as its own error
+    NodeBuilder("guarded", "test")
+        .output("value", Type::Int)
+        .entryPoint()
+        .onCompile([token](NodeContext& ctx) {
+            token->cancel();
+            try {
+                for (size_t row = 0; row < 10; ++row) {
+                    ctx.checkCancelled(row);
+                }
+                ctx.setOutput("value", int64_t(0));
+            } catch (const std::exception& e) {
+                ctx.setError(e.what());
+            }
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto nValue = graph.addNode("value");
+    auto nInc1 = graph.addNode("inc");
+    auto nInc2 = graph.addNode("inc");
+    graph.connect(nValue, "value", nInc1, "value");
+    graph.connect(nInc1, "value", nInc2, "value");
+
+    ExecutionOptions options;
+    options.cancellation = token;
+
+    SECTION("cancelled between nodes") {
+        NodeExecutor exec(reg);
+        exec.setOptions(options);
+        exec.setExecutionCallback([&](const ExecutionEvent& evt) {
+            if (evt.status == ExecutionStatus::Completed && evt.nodeId == nValue) {
+                token->cancel();
+            }
+        });
+        REQUIRE_THROWS_AS(exec.execute(graph), OperationCancelled);
+        REQUIRE(ran == std::vector<std::string>{"value"});
+    }
+
+    SECTION("deadline already passed") {
+        token->setDeadline(CancellationToken::Clock::now() - std::chrono::milliseconds(1));
+        NodeExecutor exec(reg);
+        exec.setOptions(options);
+        REQUIRE_THROWS_WITH(exec.execute(graph), "Execution timed out");
+        REQUIRE(ran.empty());
+    }
+
+    SECTION("cancellation caught by a node") {
+        NodeGraph guardedGraph;
+        guardedGraph.addNode("guarded");
+
+        NodeExecutor exec(reg);
+        exec.setOptions(options);
+        REQUIRE_THROWS_WITH(exec.execute(guardedGraph), "Execution cancelled");
+    }
+
+    SECTION("parallel") {
+        options.threads = 2;
+        NodeExecutor exec(reg);
+        exec.setOptions(options);
+        token->cancel();
+        REQUIRE_THROWS_AS(exec.execute(graph), OperationCancelled);
+        REQUIRE(ran.empty());
+    }
+}
+
+// =============================================================================
+// Resource accounting
+// =============================================================================
+
+TEST_CASE("NodeExecutor accounts node resources", "[NodeExecutor][Resources]") {
+    NodeRegistry reg;
+
+    NodeBuilder("make_frame", "test")
+        .output("csv", Type::Csv)
+        .entryPoint()
+        .onCompile([](NodeContext& ctx) {
+            auto df = std::make_shared<DataFrame>();
+            df->addIntColumn("id");
+            df->addStringColumn("name");
+            for (int i = 0; i < 100; ++i) {
+                df->addRow({std::to_string(i), "name_" + std::to_string(i % 10)});
+            }
+            ctx.setOutput("csv", Workload(df));
+        })
+        .buildAndRegister(reg);
+
+    // Interns new strings into the pool of its input
+    NodeBuilder("tag", "test")
+        .input("csv", Type::Csv)
+        .output("csv", Type::Csv)
+        .onCompile([](NodeContext& ctx) {
+            auto input = ctx.getInputWorkload("csv").getCsv();
+            auto df = std::make_shared<DataFrame>();
+            df->setStringPool(input->getStringPool());
+            df->addStringColumn("tag");
+            for (size_t i = 0; i < input->rowCount(); ++i) {
+                df->addRow({"tag_" + std::to_string(i % 5)});
+            }
+            ctx.setOutput("csv", Workload(df));
+        })
+        .buildAndRegister(reg);
+
+    NodeGraph graph;
+    auto nMake = graph.addNode("make_frame");
+    auto nTag = graph.addNode("tag");
+    graph.connect(nMake, "csv", nTag, "csv");
+
+    std::unordered_map<std::string, nlohmann::json> events;
+    NodeExecutor exec(reg);
+    exec.setExecutionCallback([&](const ExecutionEvent& evt) {
+        if (evt.status == ExecutionStatus::Completed) {
+            events[evt.nodeId] = evt.toJson();
+        }
+    });
+    exec.execute(graph);
+
+    const auto& make = exec.getResult(nMake)->resources;
+    REQUIRE(make.inputRows == 0);
+    REQUIRE(make.outputRows == 100);
+    REQUIRE(make.outputBytes == static_cast<int64_t>(100 * (sizeof(int) + sizeof(StringPool::StringId))));
+    REQUIRE(make.stringPoolGrowth == 10);
+    REQUIRE(make.allocatedBytes);  // node_tests links AllocationHook.cpp
+    REQUIRE(*make.allocatedBytes > make.outputBytes);
+    REQUIRE(make.cpuUs >= 0);
+    REQUIRE(make.wallUs >= 0);
+
+    const auto& tag = exec.getResult(nTag)->resources;
+    REQUIRE(tag.inputRows == 100);
+    REQUIRE(tag.outputRows == 100);
+    REQUIRE(tag.stringPoolGrowth == 5);
+
+    REQUIRE(events[nTag]["resources"]["string_pool_growth"] == 5);
+    REQUIRE(events[nMake]["resources"].contains("allocated_bytes"));
+}
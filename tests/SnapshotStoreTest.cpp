@@ -0,0 +1,166 @@
+#include <catch2/catch_test_macros.hpp>
+#include "storage/SnapshotStore.hpp"
+#include "dataframe/Column.hpp"
+#include "dataframe/DataFrameIndex.hpp"
+#include "dataframe/TrigramIndex.hpp"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <atomic>
+#include <unistd.h>
+
+using namespace storage;
+using namespace dataframe;
+
+// Unique per process: ctest may run test cases as parallel processes
+static std::string uniqueSuffix() {
+    static std::atomic<int> counter{0};
+    return std::to_string(::getpid()) + "_" + std::to_string(counter++);
+}
+
+// Helper to create a temporary snapshot directory
+class TempSnapshotDir {
+public:
+    TempSnapshotDir() : m_path("/tmp/test_snapshots_" + uniqueSuffix()) {}
+
+    ~TempSnapshotDir() {
+        std::filesystem::remove_all(m_path);
+    }
+
+    const std::string& path() const { return m_path; }
+
+    size_t fileCount(const std::string& extension) const {
+        size_t count = 0;
+        for (const auto& file : std::filesystem::directory_iterator(m_path)) {
+            if (file.path().extension() == extension) count++;
+        }
+        return count;
+    }
+
+private:
+    std::string m_path;
+};
+
+static DataFramePtr makeFrame(int rows) {
+    auto df = std::make_shared<DataFrame>();
+    df->addStringColumn("region");
+    df->addIntColumn("id");
+    for (int i = 0; i < rows; ++i) {
+        df->addRow({"region_" + std::to_string(i % 3), std::to_string(i)});
+    }
+    return df;
+}
+
+// =============================================================================
+// Save / Load Tests
+// =============================================================================
+
+TEST_CASE("SnapshotStore restores frames with a matching fingerprint", "[SnapshotStore]") {
+    TempSnapshotDir dir;
+
+    {
+        SnapshotStore store(dir.path());
+        store.save("perimeter/cache", "v1", {{"users", makeFrame(100)}, {"groups", makeFrame(5)}});
+    }
+
+    // A new store on the same directory (server restart)
+    SnapshotStore store(dir.path());
+    auto frames = store.load("perimeter/cache", "v1");
+    REQUIRE(frames.has_value());
+    REQUIRE(frames->at("users")->rowCount() == 100);
+    REQUIRE(frames->at("groups")->rowCount() == 5);
+    auto region = std::dynamic_pointer_cast<StringColumn>(frames->at("users")->getColumn("region"));
+    REQUIRE(region->at(4) == "region_1");
+
+    REQUIRE_FALSE(store.load("perimeter/cache", "v2").has_value());
+    REQUIRE_FALSE(store.load("unknown", "v1").has_value());
+
+    auto entries = store.list();
+    REQUIRE(entries.size() == 1);
+    REQUIRE(entries[0].name == "perimeter/cache");
+    REQUIRE(entries[0].frameCount == 2);
+    REQUIRE(entries[0].rowCount == 105);
+}
+
+TEST_CASE("SnapshotStore replaces the previous generation", "[SnapshotStore]") {
+    TempSnapshotDir dir;
+    SnapshotStore store(dir.path());
+
+    store.save("dataset", "v1", {{"main", makeFrame(10)}});
+    store.save("dataset", "v2", {{"main", makeFrame(20)}});
+    REQUIRE(dir.fileCount(".adf") == 1);
+    REQUIRE(store.fingerprint("dataset") == "v2");
+    REQUIRE(store.load("dataset", "v2")->at("main")->rowCount() == 20);
+
+    // Orphan of an interrupted save, removed when the directory is reopened
+    std::ofstream(dir.path() + "/dataset.99.0.adf") << "partial";
+    SnapshotStore reopened(dir.path());
+    REQUIRE(dir.fileCount(".adf") == 1);
+
+    reopened.remove("dataset");
+    REQUIRE(dir.fileCount(".adf") == 0);
+    REQUIRE_FALSE(reopened.fingerprint("dataset").has_value());
+}
+
+TEST_CASE("SnapshotStore restores dataset indexes from a section", "[SnapshotStore]") {
+    TempSnapshotDir dir;
+    auto df = makeFrame(30);
+    DataFrameIndex index(df, false);
+    index.build("region", DataFrameIndex::Kind::Hash);
+    index.build("id", DataFrameIndex::Kind::Sorted);
+    index.build("region", DataFrameIndex::Kind::Trigram);
+
+    {
+        SnapshotStore store(dir.path());
+        store.save("dataset", "v1", {{"main", df}},
+                   {{"index", [&index](std::ostream& out) { index.save(out); }}});
+        REQUIRE(dir.fileCount(".bin") == 1);
+    }
+
+    SnapshotStore store(dir.path());
+    auto restored = store.load("dataset", "v1")->at("main");
+    DataFrameIndex restoredIndex(restored, false);
+    auto reader = [&restoredIndex](std::istream& in) { restoredIndex.load(in); };
+    REQUIRE(store.loadSection("dataset", "v1", "index", reader));
+
+    // Without autoBuild, lookups only succeed on restored indexes
+    REQUIRE(restoredIndex.has("region", DataFrameIndex::Kind::Trigram));
+    REQUIRE(restoredIndex.lookup("region", "==", {"region_1"}) == index.lookup("region", "==", {"region_1"}));
+    REQUIRE(*restoredIndex.lookup("id", ">=", {"27"}) == std::vector<size_t>{27, 28, 29});
+    auto trigram = restored->getStringPool()->getTrigramIndex();
+    REQUIRE(trigram);
+    REQUIRE(trigram->indexedCount() == restored->getStringPool()->size());
+
+    REQUIRE_FALSE(store.loadSection("dataset", "v2", "index", reader));
+    REQUIRE_FALSE(store.loadSection("dataset", "v1", "other", reader));
+
+    store.save("dataset", "v2", {{"main", df}});
+    REQUIRE(dir.fileCount(".bin") == 0);
+}
+
+TEST_CASE("SnapshotStore reports corrupted frames", "[SnapshotStore]") {
+    TempSnapshotDir dir;
+    SnapshotStore store(dir.path());
+    store.save("dataset", "v1", {{"main", makeFrame(1000)}});
+
+    for (const auto& file : std::filesystem::directory_iterator(dir.path())) {
+        if (file.path().extension() == ".adf") {
+            std::filesystem::resize_file(file.path(), 64);
+        }
+    }
+    REQUIRE_THROWS_AS(store.load("dataset", "v1"), std::runtime_error);
+}
+
+TEST_CASE("SnapshotStore fingerprints source files", "[SnapshotStore]") {
+    TempSnapshotDir dir;
+    SnapshotStore store(dir.path());
+    std::string csv = dir.path() + "/source.csv";
+    std::ofstream(csv) << "id\n1\n";
+
+    std::string before = SnapshotStore::fileFingerprint(csv);
+    REQUIRE(SnapshotStore::fileFingerprint(csv) == before);
+    std::ofstream(csv, std::ios::app) << "2\n";
+    REQUIRE(SnapshotStore::fileFingerprint(csv) != before);
+
+    REQUIRE_THROWS_AS(SnapshotStore::fileFingerprint(dir.path() + "/missing.csv"), std::runtime_error);
+}
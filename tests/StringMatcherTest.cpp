@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/Column.hpp"
+#include "dataframe/StringMatcher.hpp"
+
+using namespace dataframe;
+
+// =============================================================================
+// Substring Search Tests
+// =============================================================================
+
+TEST_CASE("containsSubstring matches std::string::find", "[StringMatcher]") {
+    std::string haystack = "the quick brown fox jumps over the lazy dog, again and again";
+    const char* needles[] = {
+        "", "t", "the", "fox", "dog,", "again", "gain", "lazy dog", "cat",
+        "againx", "the quick brown fox jumps over the lazy dog, again and again",
+        "the quick brown fox jumps over the lazy dog, again and again!"
+    };
+
+    for (const char* needle : needles) {
+        INFO(needle);
+        bool expected = haystack.find(needle) != std::string::npos;
+        REQUIRE(StringMatcher::containsSubstring(haystack, needle) == expected);
+    }
+}
+
+TEST_CASE("containsSubstring finds match at every offset", "[StringMatcher]") {
+    std::string base(70, 'a');
+    for (size_t pos = 0; pos + 3 <= base.size(); ++pos) {
+        std::string haystack = base;
+        haystack.replace(pos, 3, "xyz");
+        INFO(pos);
+        REQUIRE(StringMatcher::containsSubstring(haystack, "xyz"));
+        REQUIRE_FALSE(StringMatcher::containsSubstring(haystack, "xyy"));
+    }
+}
+
+// =============================================================================
+// Predicate Tests
+// =============================================================================
+
+TEST_CASE("StringMatcher operators", "[StringMatcher]") {
+    REQUIRE(StringMatcher::create("startsWith", "ab")->matches("abc"));
+    REQUIRE_FALSE(StringMatcher::create("startsWith", "ab")->matches("cab"));
+    REQUIRE(StringMatcher::create("endsWith", "@corp.com")->matches("jo@corp.com"));
+    REQUIRE_FALSE(StringMatcher::create("endsWith", "@corp.com")->matches("m"));
+    REQUIRE(StringMatcher::create("regex", "^[a-z]+[0-9]$")->matches("abc1"));
+    REQUIRE_FALSE(StringMatcher::create("regex", "^[a-z]+[0-9]$")->matches("Abc1"));
+    REQUIRE(StringMatcher::create("<", "b")->matches("a"));
+    REQUIRE(StringMatcher::create(">=", "b")->matches("b"));
+    REQUIRE_FALSE(StringMatcher::create("==", "b").has_value());
+}
+
+TEST_CASE("StringMatcher case-insensitive variants", "[StringMatcher]") {
+    REQUIRE(StringMatcher::create("icontains", "LAKE")->matches("Salt lake City"));
+    REQUIRE_FALSE(StringMatcher::create("contains", "LAKE")->matches("Salt lake City"));
+    REQUIRE(StringMatcher::create("istartsWith", "sal")->matches("SALT"));
+    REQUIRE(StringMatcher::create("iendsWith", "CITY")->matches("Salt Lake city"));
+    REQUIRE(StringMatcher::create("iregex", "^salt")->matches("SALT"));
+}
+
+TEST_CASE("StringMatcher invalid regex throws", "[StringMatcher][error]") {
+    REQUIRE_THROWS(StringMatcher::create("regex", "(unclosed"));
+}
+
+TEST_CASE("StringMatcher evaluates dictionary once per id", "[StringMatcher]") {
+    StringPool pool;
+    pool.intern("alpha");
+    pool.intern("beta");
+    pool.intern("alphabet");
+
+    auto bitmap = StringMatcher::create("startsWith", "alpha")->evaluate(pool);
+    REQUIRE(bitmap == std::vector<uint8_t>{1, 0, 1});
+}
+
+// =============================================================================
+// Column Integration Tests
+// =============================================================================
+
+TEST_CASE("filterMatching with pool larger than column", "[StringMatcher]") {
+    auto pool = std::make_shared<StringPool>();
+    for (int i = 0; i < 100; ++i) {
+        pool->intern("other_" + std::to_string(i));
+    }
+
+    StringColumn col("email", pool);
+    col.push_back("a@corp.com");
+    col.push_back("b@home.org");
+    col.push_back("c@corp.com");
+
+    auto rows = col.filterMatching(*StringMatcher::create("endsWith", "@corp.com"));
+    REQUIRE(rows == std::vector<size_t>{0, 2});
+}
+
+TEST_CASE("StringColumn equality does not grow pool", "[StringMatcher]") {
+    auto pool = std::make_shared<StringPool>();
+    StringColumn col("name", pool);
+    col.push_back("Alice");
+    col.push_back("Bob");
+
+    REQUIRE(col.filterEqual("Carol").empty());
+    REQUIRE(col.filterNotEqual("Carol").size() == 2);
+    REQUIRE(pool->size() == 2);
+}
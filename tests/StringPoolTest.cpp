@@ -145,3 +145,13 @@ TEST_CASE("StringPool special characters", "[StringPool]") {
     REQUIRE(pool.getString(id2) == "tab\there");
     REQUIRE(pool.getString(id3) == "unicode: \xC3\xA9\xC3\xA0\xC3\xBC");
 }
+
+TEST_CASE("StringPool find does not intern", "[StringPool]") {
+    StringPool pool;
+
+    auto id = pool.intern("hello");
+
+    REQUIRE(pool.find("hello") == id);
+    REQUIRE(pool.find("world") == StringPool::INVALID_ID);
+    REQUIRE(pool.size() == 1);
+}
@@ -7,6 +7,9 @@
 #include "nodes/nodes/common/MathNodes.hpp"
 #include "dataframe/DataFrame.hpp"
 #include "dataframe/Column.hpp"
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
 
 using namespace nodes;
 using namespace dataframe;
@@ -213,6 +216,37 @@ TEST_CASE("csv_source falls back to test data when no input", "[TestNodes][csv_s
     REQUIRE(csv->rowCount() == 4);
 }
 
+TEST_CASE("csv_source _batch_rows requires _filter", "[TestNodes][csv_source]") {
+    TestNodesFixture fixture;
+    auto root = std::filesystem::temp_directory_path();
+    std::string name = "test_csv_source_" + std::to_string(::getpid()) + ".csv";
+    std::ofstream(root / name) << "id,name\n1,a\n2,b\n3,c\n";
+    setCsvSourceRoot(root.string());
+
+    NodeGraph graph;
+    auto n = graph.addNode("csv_source");
+    graph.setProperty(n, "_path", Workload(name, NodeType::String));
+    graph.setProperty(n, "_batch_rows", Workload(int64_t(2), NodeType::Int));
+
+    SECTION("Rejected without a filter") {
+        NodeExecutor exec(NodeRegistry::instance());
+        exec.execute(graph);
+        REQUIRE(exec.hasErrors());
+    }
+
+    SECTION("Streamed with a filter") {
+        graph.setProperty(n, "_filter",
+            Workload(R"([{"column": "id", "operator": ">=", "value": 2}])", NodeType::String));
+        NodeExecutor exec(NodeRegistry::instance());
+        auto results = exec.execute(graph);
+        REQUIRE_FALSE(exec.hasErrors());
+        REQUIRE(results[n]["csv"].getCsv()->rowCount() == 2);
+    }
+
+    setCsvSourceRoot("");
+    std::filesystem::remove(root / name);
+}
+
 // =============================================================================
 // int_value Tests
 // =============================================================================
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dataframe/Column.hpp"
+#include "dataframe/StringMatcher.hpp"
+#include "dataframe/TrigramIndex.hpp"
+#include <sstream>
+
+using namespace dataframe;
+
+static std::shared_ptr<StringPool> createEmailPool() {
+    auto pool = std::make_shared<StringPool>();
+    pool->intern("alice@espinoza.com");     // 0
+    pool->intern("bob@example.org");        // 1
+    pool->intern("carol@Espinoza.net");     // 2
+    pool->intern("ab");                     // 3
+    pool->intern("dave@lakeside.com");      // 4
+    return pool;
+}
+
+// =============================================================================
+// Candidate Tests
+// =============================================================================
+
+TEST_CASE("TrigramIndex disabled by default", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    REQUIRE(TrigramIndex::forPool(*pool) == nullptr);
+}
+
+TEST_CASE("TrigramIndex candidates are case-insensitive supersets", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    pool->enableTrigramIndex();
+
+    auto index = TrigramIndex::forPool(*pool);
+    REQUIRE(index);
+    REQUIRE(index->indexedCount() == pool->size());
+
+    auto ids = index->candidates("@espinoza");
+    REQUIRE(ids.has_value());
+    REQUIRE(*ids == std::vector<StringPool::StringId>{0, 2});
+
+    REQUIRE(index->candidates("zzz")->empty());
+    REQUIRE_FALSE(index->candidates("ab").has_value());
+}
+
+TEST_CASE("TrigramIndex updates incrementally", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    pool->enableTrigramIndex();
+
+    auto index = TrigramIndex::forPool(*pool);
+    auto newId = pool->intern("erin@espinoza.io");
+
+    auto sameIndex = TrigramIndex::forPool(*pool);
+    REQUIRE(sameIndex == index);
+    REQUIRE(index->indexedCount() == pool->size());
+    REQUIRE(index->candidates("espinoza")->back() == newId);
+}
+
+TEST_CASE("TrigramIndex save and load round trip", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    pool->enableTrigramIndex();
+    auto index = TrigramIndex::forPool(*pool);
+
+    std::stringstream buffer;
+    index->save(buffer);
+    auto loaded = TrigramIndex::load(buffer);
+
+    REQUIRE(loaded->indexedCount() == index->indexedCount());
+    REQUIRE(*loaded->candidates("lakeside") == *index->candidates("lakeside"));
+
+    std::stringstream garbage("not an index");
+    REQUIRE_THROWS(TrigramIndex::load(garbage));
+}
+
+TEST_CASE("TrigramIndex load rejects invalid posting ids", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    pool->enableTrigramIndex();
+    std::stringstream saved;
+    TrigramIndex::forPool(*pool)->save(saved);
+
+    // En-tête valide (magic, version, indexed, fingerprint) suivi d'une seule liste
+    auto withPosting = [&saved](std::vector<StringPool::StringId> ids) {
+        std::string bytes = saved.str().substr(0, 24);
+        auto append = [&bytes](const auto& value) {
+            bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        append(uint64_t{1});
+        append(uint32_t{42});
+        append(uint64_t{ids.size()});
+        for (auto id : ids) append(id);
+        return std::stringstream(bytes);
+    };
+
+    auto valid = withPosting({0, 2, 4});
+    REQUIRE(TrigramIndex::load(valid)->indexedCount() == pool->size());
+
+    auto outOfRange = withPosting({0, 5});
+    REQUIRE_THROWS(TrigramIndex::load(outOfRange));
+
+    auto unsorted = withPosting({2, 1});
+    REQUIRE_THROWS(TrigramIndex::load(unsorted));
+
+    auto duplicate = withPosting({1, 1});
+    REQUIRE_THROWS(TrigramIndex::load(duplicate));
+}
+
+TEST_CASE("TrigramIndex loaded for another pool is rebuilt", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    pool->enableTrigramIndex();
+    std::stringstream buffer;
+    TrigramIndex::forPool(*pool)->save(buffer);
+    std::string saved = buffer.str();
+
+    SECTION("same entries: adopted and extended") {
+        auto copy = createEmailPool();
+        copy->enableTrigramIndex();
+        std::stringstream in(saved);
+        auto loaded = TrigramIndex::load(in);
+        copy->setTrigramIndex(loaded);
+        auto newId = copy->intern("frank@espinoza.fr");
+
+        REQUIRE(TrigramIndex::forPool(*copy) == loaded);
+        REQUIRE(loaded->candidates("espinoza")->back() == newId);
+    }
+
+    SECTION("different entries with more strings: rebuilt") {
+        auto other = std::make_shared<StringPool>();
+        other->enableTrigramIndex();
+        for (const char* s : {"zed@lakeside.com", "yan@example.org", "xia@espinoza.com",
+                              "wes@example.org", "vic@example.org", "uma@example.org"}) {
+            other->intern(s);
+        }
+        std::stringstream in(saved);
+        auto loaded = TrigramIndex::load(in);
+        other->setTrigramIndex(loaded);
+
+        auto index = TrigramIndex::forPool(*other);
+        REQUIRE(index != loaded);
+        REQUIRE(*index->candidates("lakeside") == std::vector<StringPool::StringId>{0});
+    }
+}
+
+// =============================================================================
+// Filter Integration Tests
+// =============================================================================
+
+TEST_CASE("contains filter uses trigram candidates", "[TrigramIndex]") {
+    auto pool = createEmailPool();
+    StringColumn col("email", pool);
+    for (StringPool::StringId id = 0; id < pool->size(); ++id) {
+        col.push_back(id);
+        col.push_back(id);
+    }
+
+    auto scan = col.filterMatching(*StringMatcher::create("icontains", "ESPINOZA"));
+
+    pool->enableTrigramIndex();
+    auto indexed = col.filterMatching(*StringMatcher::create("icontains", "ESPINOZA"));
+    REQUIRE(indexed == scan);
+    REQUIRE(indexed == std::vector<size_t>{0, 1, 4, 5});
+
+    // Case-sensitive contains: candidates verified by the exact predicate
+    auto exact = col.filterContains("@espinoza");
+    REQUIRE(exact == std::vector<size_t>{0, 1});
+}